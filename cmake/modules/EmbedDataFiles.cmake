@@ -0,0 +1,79 @@
+#
+# Copyright 2018 von Karman Institute for Fluid Dynamics (VKI)
+#
+# This file is part of MUlticomponent Thermodynamic And Transport
+# properties for IONized gases in C++ (Mutation++) software package.
+#
+# Mutation++ is free software: you can redistribute it and/or modify
+# it under the terms of the GNU Lesser General Public License as
+# published by the Free Software Foundation, either version 3 of the
+# License, or (at your option) any later version.
+#
+# Mutation++ is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+# GNU Lesser General Public License for more details.
+#
+# You should have received a copy of the GNU Lesser General Public
+# License along with Mutation++.  If not, see
+# <http://www.gnu.org/licenses/>.
+#
+
+#- Generate the source file which embeds data files in the library
+#
+#  EMBED_DATA_FILES(<output> <data_dir> [<file1> ...])
+#
+#  Writes a C++ source file defining Mutation::Utilities::IO::embeddedFiles(),
+#  which returns the contents of the given files (relative to data_dir) sorted
+#  by their path.  Without files, the source defines an empty table.  The
+#  output is only touched when its contents change, and the files are added to
+#  the configure dependencies so that editing them regenerates the table.
+#
+function (embed_data_files output data_dir)
+  set(files ${ARGN})
+  list(SORT files)
+
+  set(arrays "")
+  set(entries "")
+  set(index 0)
+  foreach(file IN LISTS files)
+    set(path "${data_dir}/${file}")
+    file(READ "${path}" hex HEX)
+    string(LENGTH "${hex}" size)
+    math(EXPR size "${size} / 2")
+    # 16 bytes to a line, followed by a terminating null byte
+    string(REGEX REPLACE "(................................)" "\\1\n" hex
+      "${hex}")
+    string(REGEX REPLACE "([0-9a-f][0-9a-f])" "0x\\1," hex "${hex}")
+    set(arrays "${arrays}static const unsigned char s_file_${index}[] = {\n")
+    set(arrays "${arrays}${hex}0x00\n};\n\n")
+    set(entries
+      "${entries}        { \"${file}\", s_file_${index}, ${size} },\n")
+    set_property(DIRECTORY APPEND PROPERTY CMAKE_CONFIGURE_DEPENDS "${path}")
+    math(EXPR index "${index} + 1")
+  endforeach()
+
+  if (index EQUAL 0)
+    set(table "    n = 0;\n    return NULL;\n")
+  else()
+    set(table "    static const EmbeddedFile files[] = {\n${entries}    };\n")
+    set(table "${table}    n = sizeof(files) / sizeof(EmbeddedFile);\n")
+    set(table "${table}    return files;\n")
+  endif()
+
+  file(WRITE "${output}.tmp"
+    "// Generated by cmake/modules/EmbedDataFiles.cmake, do not edit.\n\n"
+    "#include \"EmbeddedData.h\"\n\n"
+    "#include <cstddef>\n\n"
+    "namespace Mutation {\n"
+    "    namespace Utilities {\n"
+    "        namespace IO {\n\n"
+    "${arrays}"
+    "const EmbeddedFile* embeddedFiles(std::size_t& n)\n{\n"
+    "${table}"
+    "}\n\n"
+    "        } // namespace IO\n"
+    "    } // namespace Utilities\n"
+    "} // namespace Mutation\n")
+  configure_file("${output}.tmp" "${output}" COPYONLY)
+endfunction()
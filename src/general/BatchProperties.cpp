@@ -0,0 +1,267 @@
+/**
+ * @file BatchProperties.cpp
+ *
+ * @brief Implementation of the BatchProperties class.
+ */
+
+/*
+ * Copyright 2018 von Karman Institute for Fluid Dynamics (VKI)
+ *
+ * This file is part of MUlticomponent Thermodynamic And Transport
+ * properties for IONized gases in C++ (Mutation++) software package.
+ *
+ * Mutation++ is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as
+ * published by the Free Software Foundation, either version 3 of the
+ * License, or (at your option) any later version.
+ *
+ * Mutation++ is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with Mutation++.  If not, see
+ * <http://www.gnu.org/licenses/>.
+ */
+
+#include "BatchProperties.h"
+#include "Errors.h"
+#include "Mixture.h"
+#include "Utilities.h"
+
+#include <algorithm>
+#include <limits>
+#include <sstream>
+
+namespace Mutation {
+
+// Identifies the properties, in the order of the table below
+enum PropertyId {
+    PROP_T, PROP_TV, PROP_TE, PROP_P, PROP_RHO, PROP_ND, PROP_MW, PROP_H,
+    PROP_E, PROP_CP, PROP_CV, PROP_GAMMA, PROP_A_F, PROP_MU, PROP_LAM_F,
+    PROP_LAM_H, PROP_LAM_E, PROP_LAM_INT, PROP_SIGMA, PROP_X, PROP_Y,
+    PROP_OMEGA, PROP_DM, PROP_CHI, PROP_OMEGA_TRANSFER
+};
+
+static const BatchProperties::Property PROPERTIES[] = {
+    {"T",       "K",        BatchProperties::SCALAR,
+        "heavy particle temperature"},
+    {"Tv",      "K",        BatchProperties::SCALAR,
+        "vibrational temperature"},
+    {"Te",      "K",        BatchProperties::SCALAR,
+        "electron temperature"},
+    {"P",       "Pa",       BatchProperties::SCALAR,
+        "pressure"},
+    {"rho",     "kg/m^3",   BatchProperties::SCALAR,
+        "density"},
+    {"nd",      "1/m^3",    BatchProperties::SCALAR,
+        "number density"},
+    {"Mw",      "kg/mol",   BatchProperties::SCALAR,
+        "molecular weight"},
+    {"h",       "J/kg",     BatchProperties::SCALAR,
+        "mixture enthalpy"},
+    {"e",       "J/kg",     BatchProperties::SCALAR,
+        "mixture energy"},
+    {"cp",      "J/kg-K",   BatchProperties::SCALAR,
+        "frozen specific heat at constant pressure"},
+    {"cv",      "J/kg-K",   BatchProperties::SCALAR,
+        "frozen specific heat at constant volume"},
+    {"gamma",   "",         BatchProperties::SCALAR,
+        "frozen specific heat ratio"},
+    {"a_f",     "m/s",      BatchProperties::SCALAR,
+        "frozen speed of sound"},
+    {"mu",      "Pa-s",     BatchProperties::SCALAR,
+        "dynamic viscosity"},
+    {"lam_f",   "W/m-K",    BatchProperties::SCALAR,
+        "frozen thermal conductivity"},
+    {"lam_h",   "W/m-K",    BatchProperties::SCALAR,
+        "heavy particle translational thermal conductivity"},
+    {"lam_e",   "W/m-K",    BatchProperties::SCALAR,
+        "electron translational thermal conductivity"},
+    {"lam_int", "W/m-K",    BatchProperties::SCALAR,
+        "internal energy thermal conductivity"},
+    {"sigma",   "S/m",      BatchProperties::SCALAR,
+        "electric conductivity"},
+    {"X",       "",         BatchProperties::SPECIES,
+        "mole fractions"},
+    {"Y",       "",         BatchProperties::SPECIES,
+        "mass fractions"},
+    {"omega",   "kg/m^3-s", BatchProperties::SPECIES,
+        "production rates due to reactions"},
+    {"Dm",      "m^2/s",    BatchProperties::SPECIES,
+        "average diffusion coefficients"},
+    {"Chi^h",   "",         BatchProperties::SPECIES,
+        "heavy thermal diffusion ratios"},
+    {"Omega",   "W/m^3",    BatchProperties::TRANSFER,
+        "energy transfer source terms"}
+};
+
+static const int NPROPERTIES = sizeof(PROPERTIES) / sizeof(PROPERTIES[0]);
+
+//==============================================================================
+
+int BatchProperties::nProperties()
+{
+    return NPROPERTIES;
+}
+
+//==============================================================================
+
+const BatchProperties::Property& BatchProperties::property(int i)
+{
+    return PROPERTIES[i];
+}
+
+//==============================================================================
+
+int BatchProperties::propertyIndex(const std::string& name)
+{
+    for (int i = 0; i < NPROPERTIES; ++i)
+        if (name == PROPERTIES[i].name)
+            return i;
+    return -1;
+}
+
+//==============================================================================
+
+BatchProperties::BatchProperties(const Mixture& mix, const std::string& list) :
+    m_ninputs(mix.nMassEqns() + mix.nEnergyEqns()),
+    m_ntransfer(mix.nEnergyEqns() - 1),
+    m_nvalues(0)
+{
+    for (int i = 0; i < mix.nSpecies(); ++i)
+        m_species.push_back(mix.speciesName(i));
+
+    std::vector<std::string> names;
+    Utilities::String::tokenize(list, names, ", ");
+
+    for (int i = 0; i < names.size(); ++i) {
+        const int index = propertyIndex(names[i]);
+        if (index < 0)
+            throw InvalidInputError("property", names[i])
+                << "This property cannot be evaluated in batches.";
+        m_properties.push_back(index);
+        m_nvalues += nValues(PROPERTIES[index]);
+    }
+}
+
+//==============================================================================
+
+int BatchProperties::nValues(const Property& property) const
+{
+    switch (property.size) {
+        case SPECIES:  return m_species.size();
+        case TRANSFER: return m_ntransfer;
+        default:       return 1;
+    }
+}
+
+//==============================================================================
+
+std::string BatchProperties::valueName(int c) const
+{
+    for (int k = 0; k < m_properties.size(); ++k) {
+        const Property& p = PROPERTIES[m_properties[k]];
+        const int n = nValues(p);
+        if (c >= n) {
+            c -= n;
+            continue;
+        }
+
+        std::stringstream name;
+        name << p.name;
+        if (p.size == SPECIES)
+            name << "_" << m_species[c];
+        else if (p.size == TRANSFER)
+            name << "_" << c;
+        if (p.units[0] != '\0')
+            name << "[" << p.units << "]";
+        return name.str();
+    }
+
+    return "";
+}
+
+//==============================================================================
+
+bool BatchProperties::evaluate(
+    Mixture& mix, const double* const p_state, int vars,
+    double* const p_values) const
+{
+    const int ns = m_species.size();
+    double* p = p_values;
+
+    try {
+        mix.setState(p_state, p_state + mix.nMassEqns(), vars);
+
+        for (int k = 0; k < m_properties.size(); ++k) {
+            switch (m_properties[k]) {
+                case PROP_T:       *p++ = mix.T(); break;
+                case PROP_TV:      *p++ = mix.Tv(); break;
+                case PROP_TE:      *p++ = mix.Te(); break;
+                case PROP_P:       *p++ = mix.P(); break;
+                case PROP_RHO:     *p++ = mix.density(); break;
+                case PROP_ND:      *p++ = mix.numberDensity(); break;
+                case PROP_MW:      *p++ = mix.mixtureMw(); break;
+                case PROP_H:       *p++ = mix.mixtureHMass(); break;
+                case PROP_E:       *p++ = mix.mixtureEnergyMass(); break;
+                case PROP_CP:      *p++ = mix.mixtureFrozenCpMass(); break;
+                case PROP_CV:      *p++ = mix.mixtureFrozenCvMass(); break;
+                case PROP_GAMMA:   *p++ = mix.mixtureFrozenGamma(); break;
+                case PROP_A_F:     *p++ = mix.frozenSoundSpeed(); break;
+                case PROP_MU:      *p++ = mix.viscosity(); break;
+                case PROP_LAM_F:
+                    *p++ = mix.frozenThermalConductivity(); break;
+                case PROP_LAM_H:
+                    *p++ = mix.heavyThermalConductivity(); break;
+                case PROP_LAM_E:
+                    *p++ = mix.electronThermalConductivity(); break;
+                case PROP_LAM_INT:
+                    *p++ = mix.internalThermalConductivity(mix.T()); break;
+                case PROP_SIGMA:   *p++ = mix.electricConductivity(); break;
+                case PROP_X:
+                    p = std::copy(mix.X(), mix.X()+ns, p); break;
+                case PROP_Y:
+                    p = std::copy(mix.Y(), mix.Y()+ns, p); break;
+                case PROP_OMEGA:
+                    mix.netProductionRates(p); p += ns; break;
+                case PROP_DM:
+                    mix.averageDiffusionCoeffs(p); p += ns; break;
+                case PROP_CHI:
+                    mix.heavyThermalDiffusionRatios(p); p += ns; break;
+                case PROP_OMEGA_TRANSFER:
+                    if (m_ntransfer > 0)
+                        mix.energyTransferSource(p);
+                    p += m_ntransfer;
+                    break;
+            }
+        }
+    } catch (Error& e) {
+        return false;
+    }
+
+    return true;
+}
+
+//==============================================================================
+
+int BatchProperties::evaluate(
+    Mixture& mix, const double* const p_states, int n, int vars,
+    double* const p_values) const
+{
+    int failed = 0;
+    for (int i = 0; i < n; ++i) {
+        double* const p_state_values = p_values + std::size_t(i)*m_nvalues;
+        if (!evaluate(
+            mix, p_states + std::size_t(i)*m_ninputs, vars, p_state_values)) {
+            std::fill(
+                p_state_values, p_state_values + m_nvalues,
+                std::numeric_limits<double>::quiet_NaN());
+            failed++;
+        }
+    }
+    return failed;
+}
+
+} // namespace Mutation
@@ -0,0 +1,140 @@
+/**
+ * @file BatchProperties.h
+ *
+ * @brief Declaration of the BatchProperties class.
+ */
+
+/*
+ * Copyright 2018 von Karman Institute for Fluid Dynamics (VKI)
+ *
+ * This file is part of MUlticomponent Thermodynamic And Transport
+ * properties for IONized gases in C++ (Mutation++) software package.
+ *
+ * Mutation++ is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as
+ * published by the Free Software Foundation, either version 3 of the
+ * License, or (at your option) any later version.
+ *
+ * Mutation++ is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with Mutation++.  If not, see
+ * <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef GENERAL_BATCH_PROPERTIES_H
+#define GENERAL_BATCH_PROPERTIES_H
+
+#include <string>
+#include <vector>
+
+namespace Mutation {
+
+class Mixture;
+
+/**
+ * Evaluates a list of mixture properties, chosen by name, for states given as
+ * flat arrays of values.  This is the common core of the tools and interfaces
+ * which evaluate properties for many states at once.
+ *
+ * Each state is the mass vector followed by the energy vector passed to
+ * Mixture::setState(), so that a state has nInputs() values.  Each property
+ * gives one value, one value per species, or one value per energy transfer
+ * source term, for a total of nValues() values per state.
+ *
+ * <b>Example usage:</b>
+ * @code
+ * BatchProperties props(mix, "T,mu,X");
+ * std::vector<double> values(props.nValues());
+ * if (!props.evaluate(mix, p_state, 1, &values[0]))
+ *     ... // the state could not be set
+ * @endcode
+ */
+class BatchProperties
+{
+public:
+
+    /// Number of values given by a property.
+    enum Size {
+        SCALAR,   ///< one value
+        SPECIES,  ///< one value per species
+        TRANSFER  ///< one value per energy transfer source term
+    };
+
+    /// Describes a property which can be evaluated.
+    struct Property {
+        const char* name;
+        const char* units;
+        Size size;
+        const char* description;
+    };
+
+    /// Returns the number of available properties.
+    static int nProperties();
+
+    /// Returns the i'th available property.
+    static const Property& property(int i);
+
+    /// Returns the index of the property with the given name, or -1.
+    static int propertyIndex(const std::string& name);
+
+    /**
+     * Selects the properties in the comma separated list for the given
+     * mixture.  Throws an InvalidInputError if a name is not known.
+     */
+    BatchProperties(const Mixture& mix, const std::string& list);
+
+    /// Returns the number of values which define a state.
+    int nInputs() const { return m_ninputs; }
+
+    /// Returns the number of values computed for each state.
+    int nValues() const { return m_nvalues; }
+
+    /// Returns the indices of the selected properties.
+    const std::vector<int>& properties() const { return m_properties; }
+
+    /**
+     * Returns the name of the c'th value, as "name_species[units]" for
+     * species properties.
+     */
+    std::string valueName(int c) const;
+
+    /**
+     * Sets the state of the mixture from the nInputs() values in p_state with
+     * the given variable set, and computes the nValues() values.  Returns
+     * false, without computing the values, if the state cannot be set.
+     */
+    bool evaluate(
+        Mixture& mix, const double* const p_state, int vars,
+        double* const p_values) const;
+
+    /**
+     * Evaluates n states stored one after the other, filling the values of
+     * the states which cannot be set with NaN.  Returns the number of such
+     * states.
+     */
+    int evaluate(
+        Mixture& mix, const double* const p_states, int n, int vars,
+        double* const p_values) const;
+
+private:
+
+    /// Returns the number of values given by a property.
+    int nValues(const Property& property) const;
+
+private:
+
+    std::vector<int> m_properties;
+    std::vector<std::string> m_species;
+    int m_ninputs;
+    int m_ntransfer;
+    int m_nvalues;
+
+}; // class BatchProperties
+
+} // namespace Mutation
+
+#endif // GENERAL_BATCH_PROPERTIES_H
@@ -0,0 +1,167 @@
+/**
+ * @file Diagnostics.cpp
+ *
+ * @brief Implementation of the Diagnostics class.
+ */
+
+/*
+ * Copyright 2014-2018 von Karman Institute for Fluid Dynamics (VKI)
+ *
+ * This file is part of MUlticomponent Thermodynamic And Transport
+ * properties for IONized gases in C++ (Mutation++) software package.
+ *
+ * Mutation++ is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as
+ * published by the Free Software Foundation, either version 3 of the
+ * License, or (at your option) any later version.
+ *
+ * Mutation++ is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with Mutation++.  If not, see
+ * <http://www.gnu.org/licenses/>.
+ */
+
+#include "Diagnostics.h"
+
+#include <algorithm>
+#include <iostream>
+
+namespace Mutation {
+
+// Buffered messages are written once they reach this size
+static const std::string::size_type BUFFER_SIZE = 4096;
+
+// Callback given to new Diagnostics objects
+static Diagnostics::Callback s_default_callback = NULL;
+static void* sp_default_callback_data = NULL;
+
+//==============================================================================
+
+Diagnostics::Diagnostics() :
+    m_total(0),
+    m_last(NONE),
+    m_severity(WARNING),
+    m_limit(10),
+    mp_callback(s_default_callback),
+    mp_callback_data(sp_default_callback_data)
+{
+    std::fill(m_counts, m_counts+N_EVENTS, 0);
+}
+
+//==============================================================================
+
+Diagnostics::~Diagnostics()
+{
+    flush();
+}
+
+//==============================================================================
+
+Diagnostics::Message Diagnostics::report(Event event)
+{
+    const int count = ++m_counts[event];
+    m_total++;
+    m_last = event;
+
+    // Only format the messages which will be written
+    if (severity(event) < m_severity || (m_limit >= 0 && count > m_limit))
+        return Message(NULL, event);
+
+    m_message.str("");
+    return Message(this, event);
+}
+
+//==============================================================================
+
+void Diagnostics::clear()
+{
+    std::fill(m_counts, m_counts+N_EVENTS, 0);
+    m_total = 0;
+    m_last = NONE;
+}
+
+//==============================================================================
+
+void Diagnostics::flush()
+{
+    if (m_buffer.empty())
+        return;
+
+    std::cerr << m_buffer << std::flush;
+    m_buffer.clear();
+}
+
+//==============================================================================
+
+void Diagnostics::setCallback(Callback callback, void* p_data)
+{
+    flush();
+    mp_callback = callback;
+    mp_callback_data = p_data;
+}
+
+//==============================================================================
+
+void Diagnostics::setDefaultCallback(Callback callback, void* p_data)
+{
+    s_default_callback = callback;
+    sp_default_callback_data = p_data;
+}
+
+//==============================================================================
+
+Diagnostics::Severity Diagnostics::severity(Event event)
+{
+    switch (event) {
+    case NONE:                  return INFO;
+    case NEWTON_NOT_CONVERGED:  return INFO;
+    case MODEL_NOT_IMPLEMENTED: return FAILURE;
+    default:                    return WARNING;
+    }
+}
+
+//==============================================================================
+
+const char* Diagnostics::name(Event event)
+{
+    switch (event) {
+    case TEMPERATURE_NOT_CONVERGED: return "temperature-not-converged";
+    case TEMPERATURE_CLAMPED:       return "temperature-clamped";
+    case EQUILIBRIUM_NOT_CONVERGED: return "equilibrium-not-converged";
+    case NEWTON_NOT_CONVERGED:      return "newton-not-converged";
+    case INVALID_ORDER:             return "invalid-order";
+    case MODEL_NOT_IMPLEMENTED:     return "model-not-implemented";
+    default:                        return "none";
+    }
+}
+
+//==============================================================================
+
+void Diagnostics::write(Event event)
+{
+    if (m_counts[event] == m_limit)
+        m_message << " (further messages of this type are suppressed)";
+
+    if (mp_callback != NULL) {
+        mp_callback(severity(event), event, m_message.str(), mp_callback_data);
+        return;
+    }
+
+    m_buffer += (severity(event) == FAILURE ? "Error [" :
+        (severity(event) == WARNING ? "Warning [" : "Info ["));
+    m_buffer += name(event);
+    m_buffer += "]: ";
+    m_buffer += m_message.str();
+    m_buffer += '\n';
+
+    if (m_buffer.size() >= BUFFER_SIZE || severity(event) == FAILURE)
+        flush();
+}
+
+//==============================================================================
+
+} // namespace Mutation
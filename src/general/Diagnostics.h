@@ -0,0 +1,222 @@
+/**
+ * @file Diagnostics.h
+ *
+ * @brief Declaration of the Diagnostics class.
+ */
+
+/*
+ * Copyright 2014-2018 von Karman Institute for Fluid Dynamics (VKI)
+ *
+ * This file is part of MUlticomponent Thermodynamic And Transport
+ * properties for IONized gases in C++ (Mutation++) software package.
+ *
+ * Mutation++ is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as
+ * published by the Free Software Foundation, either version 3 of the
+ * License, or (at your option) any later version.
+ *
+ * Mutation++ is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with Mutation++.  If not, see
+ * <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef GENERAL_DIAGNOSTICS_H
+#define GENERAL_DIAGNOSTICS_H
+
+#include <sstream>
+#include <string>
+
+namespace Mutation {
+
+/**
+ * Collects the non-fatal problems encountered while computing properties,
+ * such as energy equations which did not converge, in place of writing them
+ * straight to the standard streams from inside the solvers.
+ *
+ * Every occurrence of an event is counted, so that host codes can check the
+ * outcome of a call through count(), total(), and last().  Messages are only
+ * written for events at or above the minimum severity, and only for the first
+ * few occurrences of each event (see setMessageLimit()).  Written messages are
+ * passed to the callback if one is set, and are otherwise buffered and
+ * written to standard error in blocks, when the buffer fills up, a failure is
+ * reported, flush() is called, or the object is destroyed.
+ *
+ * Each Mixture owns its own Diagnostics object, so that a thread working with
+ * its own mixture never synchronizes with other threads except when the
+ * buffer is actually written.
+ *
+ * <b>Example usage:</b>
+ * @code
+ * mix.diagnostics().report(Diagnostics::TEMPERATURE_CLAMPED)
+ *     << "energy too low, T = " << T;
+ * ...
+ * if (mix.diagnostics().count(Diagnostics::TEMPERATURE_CLAMPED) > 0)
+ *     ...
+ * @endcode
+ */
+class Diagnostics
+{
+public:
+
+    /// Severity levels of the events.
+    enum Severity {
+        INFO,
+        WARNING,
+        FAILURE,
+        SILENT ///< only used as minimum severity, to suppress all messages
+    };
+
+    /// Types of events which are reported.
+    enum Event {
+        NONE = -1,
+        TEMPERATURE_NOT_CONVERGED,
+        TEMPERATURE_CLAMPED,
+        EQUILIBRIUM_NOT_CONVERGED,
+        NEWTON_NOT_CONVERGED,
+        INVALID_ORDER,
+        MODEL_NOT_IMPLEMENTED,
+        N_EVENTS
+    };
+
+    /**
+     * Type of the function called with every message which is written.  The
+     * message does not end with a new line.  The last argument is the data
+     * pointer given to setCallback().
+     */
+    typedef void (*Callback)(
+        Severity severity, Event event, const std::string& message,
+        void* p_data);
+
+    /**
+     * Formats the message of one event.  Returned by Diagnostics::report(),
+     * it collects the message through operator<<() and hands it back when it
+     * goes out of scope, at the end of the statement.  Nothing is formatted
+     * for events whose message is not written.
+     */
+    class Message
+    {
+    public:
+        Message(Diagnostics* p_diagnostics, Event event) :
+            mp_diagnostics(p_diagnostics), m_event(event)
+        { }
+
+        /// Transfers the message, so that it is only written once.
+        Message(const Message& message) :
+            mp_diagnostics(message.mp_diagnostics), m_event(message.m_event)
+        {
+            message.mp_diagnostics = NULL;
+        }
+
+        ~Message() {
+            if (mp_diagnostics != NULL)
+                mp_diagnostics->write(m_event);
+        }
+
+        /// Appends to the message.
+        template <typename T>
+        Message& operator << (const T& value) {
+            if (mp_diagnostics != NULL)
+                mp_diagnostics->m_message << value;
+            return *this;
+        }
+
+    private:
+        Message& operator = (const Message&);
+
+        mutable Diagnostics* mp_diagnostics;
+        Event m_event;
+    };
+
+    /**
+     * Creates a Diagnostics object which writes warnings and failures and at
+     * most 10 messages per event, using the default callback.
+     */
+    Diagnostics();
+
+    /// Writes any buffered messages.
+    ~Diagnostics();
+
+    /**
+     * Counts an occurrence of the event and returns the Message used to
+     * describe it.
+     */
+    Message report(Event event);
+
+    /// Returns the number of times the event occurred since the last clear().
+    int count(Event event) const {
+        return (event > NONE && event < N_EVENTS ? m_counts[event] : 0);
+    }
+
+    /// Returns the number of events which occurred since the last clear().
+    int total() const { return m_total; }
+
+    /// Returns the last event which occurred, or NONE since the last clear().
+    Event last() const { return m_last; }
+
+    /// Resets the counters.  Events which were silenced are written again.
+    void clear();
+
+    /// Writes the buffered messages to standard error.
+    void flush();
+
+    /// Sets the minimum severity of the events whose messages are written.
+    void setSeverity(Severity severity) { m_severity = severity; }
+
+    /**
+     * Sets the number of messages written for each event between two calls to
+     * clear().  A negative limit writes every message.
+     */
+    void setMessageLimit(int limit) { m_limit = limit; }
+
+    /**
+     * Sets the function receiving the written messages instead of standard
+     * error.  Passing NULL restores the default behavior.
+     */
+    void setCallback(Callback callback, void* p_data = NULL);
+
+    /**
+     * Sets the callback used by Diagnostics objects created from now on, for
+     * example before the mixtures of every thread are loaded.
+     */
+    static void setDefaultCallback(Callback callback, void* p_data = NULL);
+
+    /// Returns the severity of the event.
+    static Severity severity(Event event);
+
+    /// Returns the name of the event.
+    static const char* name(Event event);
+
+private:
+
+    /// Writes the message held in m_message for the event.
+    void write(Event event);
+
+    // Not copyable
+    Diagnostics(const Diagnostics&);
+    Diagnostics& operator = (const Diagnostics&);
+
+private:
+
+    int m_counts[N_EVENTS];
+    int m_total;
+    Event m_last;
+
+    Severity m_severity;
+    int m_limit;
+
+    Callback mp_callback;
+    void* mp_callback_data;
+
+    std::ostringstream m_message;
+    std::string m_buffer;
+
+}; // class Diagnostics
+
+} // namespace Mutation
+
+#endif // GENERAL_DIAGNOSTICS_H
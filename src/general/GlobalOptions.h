@@ -60,6 +60,50 @@ public:
         getInstance().m_working_directory = dir;
     }
 
+    /**
+     * Gets the location used to share immutable data tables between processes
+     * on the same node.  An empty string disables sharing, "shm" places the
+     * tables in POSIX shared memory, and any other value is taken as the
+     * directory in which memory-mapped table files are kept.
+     */
+    static const std::string& sharedTables() {
+        return getInstance().m_shared_tables;
+    }
+
+    /// Sets the location used to share immutable data tables.
+    static void sharedTables(const std::string& location) {
+        getInstance().m_shared_tables = location;
+    }
+
+    /**
+     * Gets the directory in which generated data tables (such as tabulated
+     * collision integrals) are cached between runs.  An empty string disables
+     * the cache.
+     */
+    static const std::string& tableCache() {
+        return getInstance().m_table_cache;
+    }
+
+    /// Sets the directory in which generated data tables are cached.
+    static void tableCache(const std::string& dir) {
+        getInstance().m_table_cache = dir;
+    }
+
+    /**
+     * Gets whether the data files embedded in the library (when it is built
+     * with EMBED_DATA_FILES) are used in place of those in the data
+     * directory.  Setting the MPP_EMBEDDED_DATA environment variable to 0
+     * disables them.
+     */
+    static bool embeddedData() {
+        return getInstance().m_embedded_data;
+    }
+
+    /// Sets whether the data files embedded in the library are used.
+    static void embeddedData(bool use) {
+        getInstance().m_embedded_data = use;
+    }
+
     /// Gets the file separator character.
     static const char separator() {
         return getInstance().m_separator;
@@ -79,6 +123,9 @@ private:
     void resetOptions() {
         m_data_directory = getEnvironmentVariable("MPP_DATA_DIRECTORY");
         m_working_directory = "";
+        m_shared_tables = getEnvironmentVariable("MPP_SHARED_TABLES");
+        m_table_cache = getEnvironmentVariable("MPP_TABLE_CACHE");
+        m_embedded_data = getEnvironmentVariable("MPP_EMBEDDED_DATA") != "0";
 #ifdef _WIN32
         m_separator = '\\';
 #else
@@ -104,6 +151,15 @@ private:
     /// Working directory
     std::string m_working_directory;
 
+    /// Shared table location
+    std::string m_shared_tables;
+
+    /// Table cache directory
+    std::string m_table_cache;
+
+    /// Use the data files embedded in the library
+    bool m_embedded_data;
+
     /// File separator character
     char m_separator;
 
@@ -43,11 +43,13 @@ Mixture::Mixture(const MixtureOptions& options)
     : Thermodynamics::Thermodynamics(
         options.getSpeciesDescriptor(),
         options.getThermodynamicDatabase(),
-        options.getStateModel()),
+        options.getStateModel(),
+        options.getThermodynamicTables()),
       Transport(
         *this,
         options.getViscosityAlgorithm(),
-        options.getThermalConductivityAlgorithm()),
+        options.getThermalConductivityAlgorithm(),
+        options.getLoadTransport()),
       Kinetics(
         static_cast<const Thermodynamics&>(*this),
         options.getMechanism()),
@@ -63,10 +65,17 @@ Mixture::Mixture(const MixtureOptions& options)
     // Set default composition if available
     if (options.hasDefaultComposition())
         setDefaultComposition(m_compositions[options.getDefaultComposition()]);
-    
-    // Instantiate a new energy transfer model
-    state()->initializeTransferModel(*this);
-    
+}
+
+//==============================================================================
+
+void Mixture::initializeTransferModel()
+{
+    try {
+        state()->initializeTransferModel(*this);
+    } catch (...) {
+        m_transfer_error = std::current_exception();
+    }
 }
 
 //==============================================================================
@@ -28,6 +28,8 @@
 #ifndef MUTATION_MIXTURE_H
 #define MUTATION_MIXTURE_H
 
+#include <exception>
+#include <mutex>
 #include <vector>
 
 #include "Thermodynamics.h"
@@ -46,6 +48,14 @@ namespace Mutation {
  * Thermodynamics, Transport, and Kinetics classes.  A Mixture object can be
  * constructed using a mixture file name or a MixtureOptions object.
  *
+ * Only the thermodynamic database is loaded by the constructor.  The transport
+ * data, the reaction mechanism, the gas surface interaction file and the
+ * energy transfer models are each loaded when they are first used, so that
+ * tools which only need thermodynamics or equilibrium do not pay for them.
+ * Transport properties can also be disabled altogether with
+ * MixtureOptions::setLoadTransport(), and the mechanism and gas surface
+ * interaction file are not loaded when they are "none".
+ *
  * @see Thermodynamics::Thermodynamics
  * @see Transport::Transport
  * @see Kinetics::Kinetics
@@ -77,9 +87,22 @@ public:
      * mixture.
      */
     void energyTransferSource(double* const p_source) {
+         loadTransferModel();
          state()->energyTransferSource(p_source);
     }
 
+    /**
+     * Provides the Jacobian of the energy transfer source terms with respect
+     * to the species densities and the T and Tv temperatures based on the
+     * current state of the mixture.
+     *
+     * @see StateModel::energyTransferJacobian()
+     */
+    void energyTransferJacobian(double* const p_jac) {
+         loadTransferModel();
+         state()->energyTransferJacobian(p_jac);
+    }
+
     /**
      * Add a named element composition to the mixture which may be retrieved
      * with getComposition().
@@ -99,10 +122,26 @@ public:
             Mutation::Thermodynamics::Composition::MOLE) const;
 
 
+private:
+
+    /// Creates the energy transfer models of the state model on first use.
+    void loadTransferModel() {
+        std::call_once(
+            m_transfer_flag, &Mixture::initializeTransferModel, this);
+        if (m_transfer_error)
+            std::rethrow_exception(m_transfer_error);
+    }
+
+    /// Creates the energy transfer models, keeping any error for later uses.
+    void initializeTransferModel();
+
 private:
 
     std::vector<Mutation::Thermodynamics::Composition> m_compositions;
 
+    std::once_flag m_transfer_flag;
+    std::exception_ptr m_transfer_error;
+
 }; // class Mixture
 
 } // namespace Mutation
@@ -43,10 +43,12 @@ void swap(MixtureOptions& opt1, MixtureOptions& opt2)
     std::swap(opt1.m_species_descriptor, opt2.m_species_descriptor);
     std::swap(opt1.m_compositions, opt2.m_compositions);
     std::swap(opt1.m_default_composition, opt2.m_default_composition);
+    std::swap(opt1.m_load_transport, opt2.m_load_transport);
     //std::swap(opt1.m_has_default_composition, opt2.m_has_default_composition);
     std::swap(opt1.m_source, opt2.m_source);
     std::swap(opt1.m_state_model, opt2.m_state_model);
     std::swap(opt1.m_thermo_db, opt2.m_thermo_db);
+    std::swap(opt1.m_thermo_tables, opt2.m_thermo_tables);
     std::swap(opt1.m_mechanism, opt2.m_mechanism);
     std::swap(opt1.m_viscosity, opt2.m_viscosity);
     std::swap(opt1.m_thermal_conductivity, opt2.m_thermal_conductivity);
@@ -79,9 +81,11 @@ void MixtureOptions::setDefaultOptions()
 {
     m_species_descriptor = "";
     m_default_composition = -1;
+    m_load_transport = true;
     m_source = "";
     m_state_model = "ChemNonEq1T";
     m_thermo_db   = "RRHO";
+    m_thermo_tables = false;
     m_mechanism   = "none";
     m_viscosity   = "Chapmann-Enskog_LDLT";
     m_thermal_conductivity = "Chapmann-Enskog_LDLT";
@@ -115,6 +119,7 @@ void MixtureOptions::loadFromXmlElement(IO::XmlElement& element)
     
     // Get the type of thermodynamic database to use
     element.getAttribute("thermo_db", m_thermo_db, m_thermo_db);
+    element.getAttribute("thermo_tables", m_thermo_tables, m_thermo_tables);
     
     // Get the viscosity algorithm
     element.getAttribute("viscosity", m_viscosity, m_viscosity);
@@ -63,6 +63,7 @@ public:
           m_source(options.m_source),
           m_state_model(options.m_state_model),
           m_thermo_db(options.m_thermo_db),
+          m_thermo_tables(options.m_thermo_tables),
           m_mechanism(options.m_mechanism),
           m_viscosity(options.m_viscosity),
           m_thermal_conductivity(options.m_thermal_conductivity),
@@ -167,6 +168,23 @@ public:
     void setThermodynamicDatabase(const std::string& thermo_db) {
         m_thermo_db = thermo_db;
     }
+
+    /**
+     * Returns true if the thermodynamic database should tabulate the species
+     * properties of each energy mode.
+     */
+    bool getThermodynamicTables() const {
+        return m_thermo_tables;
+    }
+
+    /**
+     * Sets whether the thermodynamic database should tabulate the species
+     * properties of each energy mode, if it supports it.  A warning is
+     * written when a mode cannot be tabulated to the accuracy of the database.
+     */
+    void setThermodynamicTables(bool tabulate) {
+        m_thermo_tables = tabulate;
+    }
     
     /**
      * Gets the name of the reaction mechanism to use.
@@ -182,6 +200,23 @@ public:
         m_mechanism = mechanism;
     }
 
+    /**
+     * Returns true if transport properties can be computed.  The transport
+     * data are only loaded when a transport property is first needed.
+     */
+    bool getLoadTransport() const {
+        return m_load_transport;
+    }
+
+    /**
+     * Sets whether transport properties can be computed.  Disabling them
+     * skips checking the transport algorithms, and asking for a transport
+     * property then throws an error.
+     */
+    void setLoadTransport(bool load) {
+        m_load_transport = load;
+    }
+
     /**
      * Gets the viscosity algorithm to use.
      */
@@ -219,6 +254,13 @@ public:
         return m_gsi_mechanism;
     }
 
+    /**
+     * Sets the Gas-Surface Interaction mechanism to use.
+     */
+    void setGSIMechanism(const std::string& gsi_mechanism) {
+        m_gsi_mechanism = gsi_mechanism;
+    }
+
 //    /**
 //     * Sets the default mixture composition in elemental mole fractions.
 //     */
@@ -345,6 +387,7 @@ private:
 	std::string m_source;
     std::string m_state_model;
     std::string m_thermo_db;
+    bool m_thermo_tables;
     std::string m_mechanism;
     std::string m_viscosity;
     std::string m_thermal_conductivity;
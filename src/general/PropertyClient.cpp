@@ -0,0 +1,246 @@
+/**
+ * @file PropertyClient.cpp
+ *
+ * @brief Implementation of the PropertyClient class.
+ */
+
+/*
+ * Copyright 2018 von Karman Institute for Fluid Dynamics (VKI)
+ *
+ * This file is part of MUlticomponent Thermodynamic And Transport
+ * properties for IONized gases in C++ (Mutation++) software package.
+ *
+ * Mutation++ is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as
+ * published by the Free Software Foundation, either version 3 of the
+ * License, or (at your option) any later version.
+ *
+ * Mutation++ is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with Mutation++.  If not, see
+ * <http://www.gnu.org/licenses/>.
+ */
+
+#include "PropertyClient.h"
+#include "Errors.h"
+
+#include <algorithm>
+#include <cerrno>
+#include <cstring>
+#include <sstream>
+
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <unistd.h>
+
+using namespace Mutation::PropertyProtocol;
+
+namespace Mutation {
+
+//==============================================================================
+
+PropertyClient::PropertyClient(
+    const std::string& socket_path, const std::string& mixture) :
+    m_socket_path(socket_path),
+    m_mixture(mixture),
+    m_fd(-1),
+    m_ninputs(0)
+{
+    sockaddr_un address;
+    std::memset(&address, 0, sizeof(address));
+    address.sun_family = AF_UNIX;
+    if (socket_path.empty() || socket_path.size() >= sizeof(address.sun_path))
+        throw InvalidInputError("socket path", socket_path)
+            << "The socket path must have between 1 and "
+            << sizeof(address.sun_path) - 1 << " characters.";
+    std::strcpy(address.sun_path, socket_path.c_str());
+
+    m_fd = socket(AF_UNIX, SOCK_STREAM, 0);
+    if (m_fd < 0 ||
+        connect(m_fd, reinterpret_cast<sockaddr*>(&address),
+            sizeof(address)) != 0) {
+        const std::string reason = std::strerror(errno);
+        if (m_fd >= 0)
+            close(m_fd);
+        throw Error("server connection")
+            << "Cannot connect to " << socket_path << ": " << reason;
+    }
+    disableSigpipe(m_fd);
+
+    if (mixture.size() > MAX_LIST_BYTES) {
+        close(m_fd);
+        throw InvalidInputError("mixture", mixture)
+            << "The mixture name is too long.";
+    }
+
+    // Select the mixture and ask for its description
+    RequestHeader request = RequestHeader();
+    request.type = INFO;
+    request.list_bytes = mixture.size();
+
+    ResponseHeader response;
+    std::string names;
+    try {
+        send(request, mixture.c_str(), mixture.size(), NULL, 0);
+        response = receive(INFO);
+        names.resize(response.payload_bytes);
+        receive(&names[0], names.size());
+    } catch (...) {
+        // The destructor is not called when the constructor throws
+        close(m_fd);
+        throw;
+    }
+
+    m_ninputs = response.nvalues;
+    std::istringstream in(names);
+    std::string name;
+    while (std::getline(in, name))
+        m_species.push_back(name);
+}
+
+//==============================================================================
+
+PropertyClient::~PropertyClient()
+{
+    close(m_fd);
+}
+
+//==============================================================================
+
+int PropertyClient::evaluate(
+    const std::string& properties, const double* const p_states, int n,
+    std::vector<double>& values, int vars)
+{
+    if (properties.size() > MAX_LIST_BYTES)
+        throw InvalidInputError("properties", properties)
+            << "The property list is too long.";
+
+    RequestHeader request = RequestHeader();
+    request.type = EVALUATE;
+    request.vars = vars;
+    request.list_bytes = properties.size();
+
+    // Larger batches are split into the largest requests the server accepts
+    int failed = 0, first = 0;
+    do {
+        request.nstates =
+            std::min(std::size_t(n - first), std::size_t(MAX_REQUEST_STATES));
+        send(
+            request, properties.c_str(), properties.size(),
+            p_states + std::size_t(first)*m_ninputs,
+            std::size_t(request.nstates)*m_ninputs*sizeof(double));
+
+        const ResponseHeader response = receive(EVALUATE);
+        if (first == 0)
+            values.resize(std::size_t(n)*response.nvalues);
+        if (response.nstates != request.nstates ||
+            values.size() != std::size_t(n)*response.nvalues ||
+            response.payload_bytes !=
+                std::size_t(response.nstates)*response.nvalues*sizeof(double))
+            throw Error("server request")
+                << "Unexpected response from " << m_socket_path << ".";
+
+        receive(
+            values.data() + std::size_t(first)*response.nvalues,
+            response.payload_bytes);
+
+        failed += response.nfailed;
+        first += request.nstates;
+    } while (first < n);
+
+    return failed;
+}
+
+//==============================================================================
+
+std::vector<std::string> PropertyClient::mixtures()
+{
+    RequestHeader request = RequestHeader();
+    request.type = MIXTURES;
+    send(request, NULL, 0, NULL, 0);
+
+    const ResponseHeader response = receive(MIXTURES);
+    std::string names(response.payload_bytes, '\0');
+    receive(&names[0], names.size());
+
+    std::vector<std::string> mixtures;
+    std::istringstream in(names);
+    std::string name;
+    while (std::getline(in, name))
+        mixtures.push_back(name);
+    return mixtures;
+}
+
+//==============================================================================
+
+Statistics PropertyClient::statistics()
+{
+    RequestHeader request = RequestHeader();
+    request.type = STATS;
+    send(request, NULL, 0, NULL, 0);
+
+    const ResponseHeader response = receive(STATS);
+    if (response.payload_bytes != sizeof(Statistics))
+        throw Error("server request")
+            << "Unexpected response from " << m_socket_path << ".";
+
+    Statistics stats;
+    receive(&stats, sizeof(stats));
+    return stats;
+}
+
+//==============================================================================
+
+void PropertyClient::send(
+    const RequestHeader& request,
+    const void* const p_data1, std::size_t bytes1,
+    const void* const p_data2, std::size_t bytes2)
+{
+    RequestHeader header = request;
+    header.magic = MAGIC;
+    header.version = VERSION;
+    header.reserved = 0;
+
+    if (!writeBytes(m_fd, &header, sizeof(header)) ||
+        !writeBytes(m_fd, p_data1, bytes1) ||
+        !writeBytes(m_fd, p_data2, bytes2))
+        throw Error("server connection")
+            << "Lost the connection to " << m_socket_path << ".";
+}
+
+//==============================================================================
+
+ResponseHeader PropertyClient::receive(uint16_t type)
+{
+    ResponseHeader response;
+    receive(&response, sizeof(response));
+
+    if (response.magic != MAGIC || response.type != type)
+        throw Error("server request")
+            << "Unexpected response from " << m_socket_path << ".";
+
+    if (response.status != STATUS_OK) {
+        std::string message(response.payload_bytes, '\0');
+        receive(&message[0], message.size());
+        throw Error("server request") << message;
+    }
+
+    return response;
+}
+
+//==============================================================================
+
+void PropertyClient::receive(void* const p_data, std::size_t n)
+{
+    if (!readBytes(m_fd, p_data, n))
+        throw Error("server connection")
+            << "Lost the connection to " << m_socket_path << ".";
+}
+
+//==============================================================================
+
+} // namespace Mutation
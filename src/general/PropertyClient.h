@@ -0,0 +1,128 @@
+/**
+ * @file PropertyClient.h
+ *
+ * @brief Declaration of the PropertyClient class.
+ */
+
+/*
+ * Copyright 2018 von Karman Institute for Fluid Dynamics (VKI)
+ *
+ * This file is part of MUlticomponent Thermodynamic And Transport
+ * properties for IONized gases in C++ (Mutation++) software package.
+ *
+ * Mutation++ is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as
+ * published by the Free Software Foundation, either version 3 of the
+ * License, or (at your option) any later version.
+ *
+ * Mutation++ is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with Mutation++.  If not, see
+ * <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef GENERAL_PROPERTY_CLIENT_H
+#define GENERAL_PROPERTY_CLIENT_H
+
+#include "PropertyProtocol.h"
+
+#include <string>
+#include <vector>
+
+namespace Mutation {
+
+/**
+ * Evaluates properties through a PropertyServer running on the same machine,
+ * instead of loading a Mixture in the calling process.  The properties and
+ * states are given as to BatchProperties.
+ *
+ * <b>Example usage:</b>
+ * @code
+ * PropertyClient client("/tmp/mpp.sock", "air_11");
+ * std::vector<double> values;
+ * int failed = client.evaluate("T,mu,X", p_states, n, values);
+ * @endcode
+ */
+class PropertyClient
+{
+public:
+
+    /**
+     * Connects to the server listening on the given socket and selects one of
+     * its mixtures by name, or the first one if the name is empty.  Throws an
+     * Error if the server cannot be reached or does not serve the mixture.
+     */
+    explicit PropertyClient(
+        const std::string& socket_path, const std::string& mixture = "");
+
+    /// Closes the connection.
+    ~PropertyClient();
+
+    /// Returns the number of values which define a state.
+    int nInputs() const { return m_ninputs; }
+
+    /// Returns the name of the mixture, as given to the constructor.
+    const std::string& mixture() const { return m_mixture; }
+
+    /// Returns the number of species in the selected mixture.
+    int nSpecies() const { return m_species.size(); }
+
+    /// Returns the name of the i'th species.
+    const std::string& speciesName(int i) const { return m_species[i]; }
+
+    /**
+     * Evaluates the comma separated list of properties for n states stored
+     * one after the other, resizing values to hold the values of every
+     * state.  Batches larger than the server accepts at once are sent as
+     * several requests.  Returns the number of states which could not be set,
+     * whose values are NaN.  Throws an Error if the server rejects the
+     * request.
+     */
+    int evaluate(
+        const std::string& properties, const double* const p_states, int n,
+        std::vector<double>& values, int vars = 1);
+
+    /// Returns the names of all the mixtures served by the server.
+    std::vector<std::string> mixtures();
+
+    /// Returns the statistics kept by the server for this connection.
+    PropertyProtocol::Statistics statistics();
+
+private:
+
+    // Not copyable
+    PropertyClient(const PropertyClient&);
+    PropertyClient& operator=(const PropertyClient&);
+
+    /// Sends a request header followed by the given payloads.
+    void send(
+        const PropertyProtocol::RequestHeader& request,
+        const void* const p_data1, std::size_t bytes1,
+        const void* const p_data2, std::size_t bytes2);
+
+    /**
+     * Receives the header of the response to a request of the given type.
+     * Throws the error message sent by the server when the request failed.
+     */
+    PropertyProtocol::ResponseHeader receive(uint16_t type);
+
+    /// Receives exactly n bytes of payload.
+    void receive(void* const p_data, std::size_t n);
+
+private:
+
+    std::string m_socket_path;
+    std::string m_mixture;
+    int m_fd;
+    int m_ninputs;
+    std::vector<std::string> m_species;
+
+}; // class PropertyClient
+
+} // namespace Mutation
+
+#endif // GENERAL_PROPERTY_CLIENT_H
@@ -0,0 +1,95 @@
+/**
+ * @file PropertyProtocol.cpp
+ *
+ * @brief Socket helpers shared by the PropertyServer and PropertyClient.
+ */
+
+/*
+ * Copyright 2018 von Karman Institute for Fluid Dynamics (VKI)
+ *
+ * This file is part of MUlticomponent Thermodynamic And Transport
+ * properties for IONized gases in C++ (Mutation++) software package.
+ *
+ * Mutation++ is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as
+ * published by the Free Software Foundation, either version 3 of the
+ * License, or (at your option) any later version.
+ *
+ * Mutation++ is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with Mutation++.  If not, see
+ * <http://www.gnu.org/licenses/>.
+ */
+
+#include "PropertyProtocol.h"
+
+#include <cerrno>
+#include <csignal>
+#include <sys/socket.h>
+#include <sys/types.h>
+
+// A closed peer must not kill the process with SIGPIPE: each send is flagged
+// with MSG_NOSIGNAL where it exists, otherwise see disableSigpipe()
+#ifdef MSG_NOSIGNAL
+#define SEND_FLAGS MSG_NOSIGNAL
+#else
+#define SEND_FLAGS 0
+#endif
+
+namespace Mutation {
+    namespace PropertyProtocol {
+
+//==============================================================================
+
+bool readBytes(int fd, void* const p_data, std::size_t n)
+{
+    char* p = static_cast<char*>(p_data);
+    while (n > 0) {
+        const ssize_t nread = recv(fd, p, n, 0);
+        if (nread < 0 && errno == EINTR)
+            continue;
+        if (nread <= 0)
+            return false;
+        p += nread;
+        n -= nread;
+    }
+    return true;
+}
+
+//==============================================================================
+
+bool writeBytes(int fd, const void* const p_data, std::size_t n)
+{
+    const char* p = static_cast<const char*>(p_data);
+    while (n > 0) {
+        const ssize_t nwritten = send(fd, p, n, SEND_FLAGS);
+        if (nwritten < 0 && errno == EINTR)
+            continue;
+        if (nwritten <= 0)
+            return false;
+        p += nwritten;
+        n -= nwritten;
+    }
+    return true;
+}
+
+//==============================================================================
+
+void disableSigpipe(int fd)
+{
+#if defined(SO_NOSIGPIPE)
+    int on = 1;
+    setsockopt(fd, SOL_SOCKET, SO_NOSIGPIPE, &on, sizeof(on));
+#elif !defined(MSG_NOSIGNAL)
+    std::signal(SIGPIPE, SIG_IGN);
+#endif
+}
+
+//==============================================================================
+
+    } // namespace PropertyProtocol
+} // namespace Mutation
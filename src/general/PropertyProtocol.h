@@ -0,0 +1,150 @@
+/**
+ * @file PropertyProtocol.h
+ *
+ * @brief Messages exchanged between the PropertyServer and its clients.
+ */
+
+/*
+ * Copyright 2018 von Karman Institute for Fluid Dynamics (VKI)
+ *
+ * This file is part of MUlticomponent Thermodynamic And Transport
+ * properties for IONized gases in C++ (Mutation++) software package.
+ *
+ * Mutation++ is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as
+ * published by the Free Software Foundation, either version 3 of the
+ * License, or (at your option) any later version.
+ *
+ * Mutation++ is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with Mutation++.  If not, see
+ * <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef GENERAL_PROPERTY_PROTOCOL_H
+#define GENERAL_PROPERTY_PROTOCOL_H
+
+#include <cstddef>
+#include <stdint.h>
+
+namespace Mutation {
+    namespace PropertyProtocol {
+
+/**
+ * @defgroup property_protocol Property Server Protocol
+ *
+ * Clients talk to a PropertyServer through a UNIX domain stream socket.  Both
+ * ends live on the same machine, so every field is sent in the native byte
+ * order and doubles are sent as raw IEEE values.  A client sends a
+ * RequestHeader, followed by
+ *
+ *  - nothing, for MIXTURES and STATS requests,
+ *  - list_bytes characters holding the name of the mixture to use for the
+ *    following requests of the connection, for INFO requests (an empty name
+ *    selects the first mixture of the server),
+ *  - list_bytes characters holding the comma separated property list and then
+ *    nstates states of nInputs() doubles each, for EVALUATE requests.
+ *
+ * The server answers each request, in order, with a ResponseHeader followed by
+ * payload_bytes bytes:
+ *
+ *  - the species names, each followed by a new line, for INFO requests, with
+ *    nvalues giving the number of inputs per state and nstates the number of
+ *    species,
+ *  - nstates rows of nvalues doubles for EVALUATE requests, where the nfailed
+ *    states which could not be set are filled with NaN,
+ *  - a Statistics record for STATS requests,
+ *  - the mixture names, each followed by a new line, for MIXTURES requests,
+ *    with nstates giving the number of mixtures,
+ *  - an error message when status is not STATUS_OK.
+ * @{
+ */
+
+/// Identifies the messages of the protocol ("MPPS").
+const uint32_t MAGIC = 0x5350504d;
+
+/// Incremented when the messages change.
+const uint16_t VERSION = 2;
+
+/// Largest number of states in a single EVALUATE request.
+const uint32_t MAX_REQUEST_STATES = 1 << 20;
+
+/// Largest property list or mixture name in a single request.
+const uint32_t MAX_LIST_BYTES = 4096;
+
+/// Request types.
+enum RequestType {
+    INFO     = 1, ///< selects a mixture, its number of inputs and species
+    EVALUATE = 2, ///< properties of a batch of states
+    STATS    = 3, ///< statistics of the connection
+    MIXTURES = 4  ///< names of the mixtures of the server
+};
+
+/// Response status.
+enum Status {
+    STATUS_OK    = 0,
+    STATUS_ERROR = 1
+};
+
+/// Header of a request.
+struct RequestHeader {
+    uint32_t magic;
+    uint16_t version;
+    uint16_t type;
+    uint32_t vars;
+    uint32_t nstates;
+    uint32_t list_bytes;
+    uint32_t reserved;
+};
+
+/// Header of a response.
+struct ResponseHeader {
+    uint32_t magic;
+    uint16_t status;
+    uint16_t type;
+    uint32_t nstates;
+    uint32_t nvalues;
+    uint32_t nfailed;
+    uint32_t reserved;
+    uint64_t payload_bytes;
+};
+
+/// Statistics kept by the server for each connection.
+struct Statistics {
+    uint64_t requests;     ///< requests answered
+    uint64_t states;       ///< states evaluated
+    uint64_t failed;       ///< states which could not be set
+    uint64_t bytes_in;     ///< bytes received from the client
+    uint64_t bytes_out;    ///< bytes sent to the client
+    double busy_seconds;   ///< time spent answering requests
+};
+
+/**
+ * Reads exactly n bytes from the socket, returning false if the connection is
+ * closed or broken first.
+ */
+bool readBytes(int fd, void* const p_data, std::size_t n);
+
+/**
+ * Writes exactly n bytes to the socket, returning false if the connection is
+ * closed or broken first.
+ */
+bool writeBytes(int fd, const void* const p_data, std::size_t n);
+
+/**
+ * Makes sure that writing to the socket once the peer has closed it returns
+ * an error instead of raising SIGPIPE.  Where neither MSG_NOSIGNAL nor
+ * SO_NOSIGPIPE are available, SIGPIPE is ignored by the whole process.
+ */
+void disableSigpipe(int fd);
+
+/// @}
+
+    } // namespace PropertyProtocol
+} // namespace Mutation
+
+#endif // GENERAL_PROPERTY_PROTOCOL_H
@@ -0,0 +1,516 @@
+/**
+ * @file PropertyServer.cpp
+ *
+ * @brief Implementation of the PropertyServer class.
+ */
+
+/*
+ * Copyright 2018 von Karman Institute for Fluid Dynamics (VKI)
+ *
+ * This file is part of MUlticomponent Thermodynamic And Transport
+ * properties for IONized gases in C++ (Mutation++) software package.
+ *
+ * Mutation++ is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as
+ * published by the Free Software Foundation, either version 3 of the
+ * License, or (at your option) any later version.
+ *
+ * Mutation++ is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with Mutation++.  If not, see
+ * <http://www.gnu.org/licenses/>.
+ */
+
+#include "PropertyServer.h"
+#include "BatchProperties.h"
+#include "Errors.h"
+#include "Mixture.h"
+
+#include <algorithm>
+#include <cerrno>
+#include <chrono>
+#include <cstring>
+#include <iostream>
+#include <memory>
+
+#include <sys/socket.h>
+#include <sys/stat.h>
+#include <sys/un.h>
+#include <unistd.h>
+
+using namespace Mutation::PropertyProtocol;
+
+namespace Mutation {
+
+// Number of states in each task given to the workers
+#define TASK_STATES 256
+
+struct PropertyServer::Task {
+    int mixture;
+    const BatchProperties* p_props;
+    const double* p_states;
+    int n;
+    int vars;
+    double* p_values;
+    Batch* p_batch;
+};
+
+struct PropertyServer::Batch {
+    int remaining;
+    int failed;
+};
+
+struct PropertyServer::Connection {
+    std::thread thread;
+    int fd;
+    int client;
+    bool finished;
+};
+
+//==============================================================================
+
+// Sends a response with the given payload
+static bool respond(
+    int fd, ResponseHeader header, const void* const p_payload,
+    Statistics& stats)
+{
+    header.magic = MAGIC;
+    header.reserved = 0;
+    if (!writeBytes(fd, &header, sizeof(header)) ||
+        !writeBytes(fd, p_payload, header.payload_bytes))
+        return false;
+    stats.bytes_out += sizeof(header) + header.payload_bytes;
+    return true;
+}
+
+// Sends an error message in response to a request
+static bool respondError(
+    int fd, uint16_t type, const std::string& message, Statistics& stats)
+{
+    ResponseHeader header = ResponseHeader();
+    header.status = STATUS_ERROR;
+    header.type = type;
+    header.payload_bytes = message.size();
+    return respond(fd, header, message.c_str(), stats);
+}
+
+//==============================================================================
+
+// Deletes the copies of the mixtures of each worker
+static void deleteMixtures(std::vector< std::vector<Mixture*> >& mixtures)
+{
+    for (int i = 0; i < mixtures.size(); ++i)
+        for (int j = 0; j < mixtures[i].size(); ++j)
+            delete mixtures[i][j];
+    mixtures.clear();
+}
+
+//==============================================================================
+
+PropertyServer::PropertyServer(
+    const std::vector<std::string>& names,
+    const std::vector<MixtureOptions>& options,
+    const std::string& socket_path, int nworkers) :
+    m_socket_path(socket_path),
+    m_listen_fd(-1),
+    m_verbose(false),
+    m_stopping(false),
+    m_names(names),
+    m_nclients(0)
+{
+    initialize(options, nworkers);
+}
+
+//==============================================================================
+
+PropertyServer::PropertyServer(
+    const MixtureOptions& options, const std::string& socket_path,
+    int nworkers) :
+    m_socket_path(socket_path),
+    m_listen_fd(-1),
+    m_verbose(false),
+    m_stopping(false),
+    m_nclients(0)
+{
+    // Name the mixture after its file
+    std::string name = options.getSource();
+    name = name.substr(name.find_last_of("/\\") + 1);
+    m_names.push_back(name.substr(0, name.rfind(".xml")));
+
+    initialize(std::vector<MixtureOptions>(1, options), nworkers);
+}
+
+//==============================================================================
+
+void PropertyServer::initialize(
+    const std::vector<MixtureOptions>& options, int nworkers)
+{
+    if (options.empty() || options.size() != m_names.size())
+        throw InvalidInputError("number of mixtures", options.size())
+            << "The server needs one name for each of its mixtures.";
+    for (int i = 0; i < m_names.size(); ++i)
+        if (std::count(m_names.begin(), m_names.end(), m_names[i]) > 1)
+            throw InvalidInputError("mixture name", m_names[i])
+                << "The mixture names of the server must be unique.";
+
+    sockaddr_un address;
+    std::memset(&address, 0, sizeof(address));
+    address.sun_family = AF_UNIX;
+    if (m_socket_path.empty() ||
+        m_socket_path.size() >= sizeof(address.sun_path))
+        throw InvalidInputError("socket path", m_socket_path)
+            << "The socket path must have between 1 and "
+            << sizeof(address.sun_path) - 1 << " characters.";
+    std::strcpy(address.sun_path, m_socket_path.c_str());
+
+    // Load the mixtures first, so that clients never see a half-ready server
+    m_mixtures.resize(std::max(nworkers, 1));
+    try {
+        for (int i = 0; i < m_mixtures.size(); ++i)
+            for (int j = 0; j < options.size(); ++j)
+                m_mixtures[i].push_back(new Mixture(options[j]));
+    } catch (...) {
+        deleteMixtures(m_mixtures);
+        throw;
+    }
+
+    // Only a stale socket may be replaced, never a regular file
+    struct stat st;
+    if (lstat(m_socket_path.c_str(), &st) == 0 && S_ISSOCK(st.st_mode))
+        unlink(m_socket_path.c_str());
+
+    m_listen_fd = socket(AF_UNIX, SOCK_STREAM, 0);
+    if (m_listen_fd < 0 ||
+        bind(m_listen_fd, reinterpret_cast<sockaddr*>(&address),
+            sizeof(address)) != 0 ||
+        listen(m_listen_fd, SOMAXCONN) != 0) {
+        const std::string reason = std::strerror(errno);
+        if (m_listen_fd >= 0)
+            close(m_listen_fd);
+        deleteMixtures(m_mixtures);
+        throw Error("server socket")
+            << "Cannot listen on " << m_socket_path << ": " << reason;
+    }
+
+    for (int i = 0; i < m_mixtures.size(); ++i)
+        m_workers.push_back(std::thread(&PropertyServer::work, this, i));
+}
+
+//==============================================================================
+
+PropertyServer::~PropertyServer()
+{
+    stop();
+
+    {
+        std::lock_guard<std::mutex> lock(m_task_mutex);
+        m_task_ready.notify_all();
+    }
+    for (int i = 0; i < m_workers.size(); ++i)
+        m_workers[i].join();
+
+    close(m_listen_fd);
+    unlink(m_socket_path.c_str());
+
+    deleteMixtures(m_mixtures);
+}
+
+//==============================================================================
+
+void PropertyServer::run()
+{
+    while (!m_stopping) {
+        const int fd = accept(m_listen_fd, NULL, NULL);
+        if (fd < 0) {
+            if (errno == EINTR || errno == ECONNABORTED)
+                continue;
+            break;
+        }
+
+        std::lock_guard<std::mutex> lock(m_connection_mutex);
+        if (m_stopping) {
+            close(fd);
+            break;
+        }
+
+        // Forget the connections which are over
+        std::list<Connection*>::iterator iter = m_connections.begin();
+        while (iter != m_connections.end()) {
+            if ((*iter)->finished) {
+                (*iter)->thread.join();
+                delete *iter;
+                iter = m_connections.erase(iter);
+            } else
+                ++iter;
+        }
+
+        disableSigpipe(fd);
+
+        Connection* p_connection = new Connection();
+        p_connection->fd = fd;
+        p_connection->client = ++m_nclients;
+        p_connection->finished = false;
+        p_connection->thread =
+            std::thread(&PropertyServer::serve, this, p_connection);
+        m_connections.push_back(p_connection);
+    }
+
+    // Wake up the connections blocked on their clients and wait for them
+    std::list<Connection*> connections;
+    {
+        std::lock_guard<std::mutex> lock(m_connection_mutex);
+        connections.swap(m_connections);
+        std::list<Connection*>::iterator iter = connections.begin();
+        for ( ; iter != connections.end(); ++iter)
+            if (!(*iter)->finished)
+                shutdown((*iter)->fd, SHUT_RDWR);
+    }
+
+    std::list<Connection*>::iterator iter = connections.begin();
+    for ( ; iter != connections.end(); ++iter) {
+        (*iter)->thread.join();
+        delete *iter;
+    }
+}
+
+//==============================================================================
+
+void PropertyServer::stop()
+{
+    std::lock_guard<std::mutex> lock(m_connection_mutex);
+    if (m_stopping.exchange(true))
+        return;
+
+    // Makes accept() return in run()
+    shutdown(m_listen_fd, SHUT_RDWR);
+}
+
+//==============================================================================
+
+void PropertyServer::work(int worker)
+{
+    const std::vector<Mixture*>& mixtures = m_mixtures[worker];
+
+    std::unique_lock<std::mutex> lock(m_task_mutex);
+    while (true) {
+        while (m_tasks.empty() && !m_stopping)
+            m_task_ready.wait(lock);
+        if (m_tasks.empty())
+            return;
+
+        Task* const p_task = m_tasks.front();
+        m_tasks.pop_front();
+
+        lock.unlock();
+        const int failed = p_task->p_props->evaluate(
+            *mixtures[p_task->mixture], p_task->p_states, p_task->n,
+            p_task->vars, p_task->p_values);
+        lock.lock();
+
+        p_task->p_batch->failed += failed;
+        if (--p_task->p_batch->remaining == 0)
+            m_task_done.notify_all();
+    }
+}
+
+//==============================================================================
+
+int PropertyServer::evaluate(
+    int mixture, const BatchProperties& props,
+    const double* const p_states, int n, int vars,
+    double* const p_values)
+{
+    if (n == 0)
+        return 0;
+
+    const int ntasks = (n + TASK_STATES - 1) / TASK_STATES;
+    std::vector<Task> tasks(ntasks);
+    Batch batch = { ntasks, 0 };
+
+    std::unique_lock<std::mutex> lock(m_task_mutex);
+    for (int i = 0; i < ntasks; ++i) {
+        const int first = i*TASK_STATES;
+        tasks[i].mixture = mixture;
+        tasks[i].p_props = &props;
+        tasks[i].p_states = p_states + std::size_t(first)*props.nInputs();
+        tasks[i].n = std::min(TASK_STATES, n - first);
+        tasks[i].vars = vars;
+        tasks[i].p_values = p_values + std::size_t(first)*props.nValues();
+        tasks[i].p_batch = &batch;
+        m_tasks.push_back(&tasks[i]);
+    }
+    m_task_ready.notify_all();
+
+    while (batch.remaining > 0)
+        m_task_done.wait(lock);
+
+    return batch.failed;
+}
+
+//==============================================================================
+
+void PropertyServer::serve(Connection* p_connection)
+{
+    typedef std::chrono::steady_clock clock;
+
+    const int fd = p_connection->fd;
+
+    // Connections start with the first mixture, until a client selects one
+    int mixture = 0;
+    const Mixture* p_mix = m_mixtures[0][0];
+
+    Statistics stats = Statistics();
+    std::string list;
+    std::unique_ptr<BatchProperties> p_props;
+    std::vector<double> states, values;
+
+    RequestHeader request;
+    while (readBytes(fd, &request, sizeof(request))) {
+        const clock::time_point start = clock::now();
+        stats.requests++;
+        stats.bytes_in += sizeof(request);
+
+        if (request.magic != MAGIC || request.version != VERSION) {
+            respondError(fd, request.type, "Bad request header.", stats);
+            break;
+        }
+
+        ResponseHeader response = ResponseHeader();
+        response.status = STATUS_OK;
+        response.type = request.type;
+        bool ok = true;
+
+        if (request.nstates > MAX_REQUEST_STATES ||
+            request.list_bytes > MAX_LIST_BYTES) {
+            respondError(fd, request.type, "Request is too large.", stats);
+            break;
+        }
+
+        switch (request.type) {
+        case INFO: {
+            std::string name(request.list_bytes, '\0');
+            if (!readBytes(fd, &name[0], name.size())) {
+                ok = false;
+                break;
+            }
+            stats.bytes_in += name.size();
+
+            // Select the mixture used by the next requests
+            if (!name.empty()) {
+                const int i = std::find(m_names.begin(), m_names.end(), name)
+                    - m_names.begin();
+                if (i == m_names.size()) {
+                    ok = respondError(
+                        fd, request.type, "Unknown mixture " + name + ".",
+                        stats);
+                    break;
+                }
+                if (i != mixture)
+                    p_props.reset();
+                mixture = i;
+                p_mix = m_mixtures[0][i];
+            }
+
+            std::string names;
+            for (int i = 0; i < p_mix->nSpecies(); ++i)
+                names += p_mix->speciesName(i) + "\n";
+            response.nstates = p_mix->nSpecies();
+            response.nvalues = p_mix->nMassEqns() + p_mix->nEnergyEqns();
+            response.payload_bytes = names.size();
+            ok = respond(fd, response, names.c_str(), stats);
+            break;
+        }
+        case MIXTURES: {
+            std::string names;
+            for (int i = 0; i < m_names.size(); ++i)
+                names += m_names[i] + "\n";
+            response.nstates = m_names.size();
+            response.payload_bytes = names.size();
+            ok = respond(fd, response, names.c_str(), stats);
+            break;
+        }
+        case EVALUATE: {
+            // Read the property list and the states
+            std::string new_list(request.list_bytes, '\0');
+            const int nin = p_mix->nMassEqns() + p_mix->nEnergyEqns();
+            states.resize(std::size_t(request.nstates)*nin);
+            if (!readBytes(fd, &new_list[0], new_list.size()) ||
+                !readBytes(fd, states.data(), states.size()*sizeof(double))) {
+                ok = false;
+                break;
+            }
+            stats.bytes_in += new_list.size() + states.size()*sizeof(double);
+
+            // Clients usually ask for the same properties every time
+            if (!p_props || new_list != list) {
+                try {
+                    p_props.reset(new BatchProperties(*p_mix, new_list));
+                    list = new_list;
+                } catch (InvalidInputError& e) {
+                    p_props.reset();
+                    ok = respondError(
+                        fd, request.type,
+                        "Unknown property " + e.inputValue() + ".", stats);
+                    break;
+                }
+            }
+
+            values.resize(std::size_t(request.nstates)*p_props->nValues());
+            response.nstates = request.nstates;
+            response.nvalues = p_props->nValues();
+            response.nfailed = evaluate(
+                mixture, *p_props, states.data(), request.nstates,
+                request.vars, values.data());
+            response.payload_bytes = values.size()*sizeof(double);
+            ok = respond(fd, response, values.data(), stats);
+
+            stats.states += response.nstates;
+            stats.failed += response.nfailed;
+            break;
+        }
+        case STATS:
+            response.payload_bytes = sizeof(stats);
+            ok = respond(fd, response, &stats, stats);
+            break;
+        default:
+            respondError(fd, request.type, "Unknown request type.", stats);
+            ok = false;
+        }
+
+        stats.busy_seconds +=
+            std::chrono::duration<double>(clock::now() - start).count();
+
+        if (!ok)
+            break;
+    }
+
+    if (m_verbose)
+        report(p_connection->client, stats);
+
+    // Closed under the lock so that run() never shuts down a reused descriptor
+    std::lock_guard<std::mutex> lock(m_connection_mutex);
+    close(fd);
+    p_connection->finished = true;
+}
+
+//==============================================================================
+
+void PropertyServer::report(int client, const Statistics& stats)
+{
+    static std::mutex report_mutex;
+    std::lock_guard<std::mutex> lock(report_mutex);
+
+    std::cerr << "Client " << client << ": " << stats.requests
+              << " requests, " << stats.states << " states ("
+              << stats.failed << " failed), " << stats.bytes_in
+              << " bytes in, " << stats.bytes_out << " bytes out, "
+              << stats.busy_seconds << " s busy" << std::endl;
+}
+
+//==============================================================================
+
+} // namespace Mutation
@@ -0,0 +1,184 @@
+/**
+ * @file PropertyServer.h
+ *
+ * @brief Declaration of the PropertyServer class.
+ */
+
+/*
+ * Copyright 2018 von Karman Institute for Fluid Dynamics (VKI)
+ *
+ * This file is part of MUlticomponent Thermodynamic And Transport
+ * properties for IONized gases in C++ (Mutation++) software package.
+ *
+ * Mutation++ is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as
+ * published by the Free Software Foundation, either version 3 of the
+ * License, or (at your option) any later version.
+ *
+ * Mutation++ is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with Mutation++.  If not, see
+ * <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef GENERAL_PROPERTY_SERVER_H
+#define GENERAL_PROPERTY_SERVER_H
+
+#include "PropertyProtocol.h"
+
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <list>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace Mutation {
+
+class BatchProperties;
+class Mixture;
+class MixtureOptions;
+
+/**
+ * Loads a set of mixtures once and evaluates batches of states for any number
+ * of local client processes, which connect with a PropertyClient through a
+ * UNIX domain socket (see @ref property_protocol).  Each mixture is known by
+ * a name, which clients use to select it.
+ *
+ * The requests of all clients are split into small tasks which are evaluated
+ * by a pool of worker threads, each with its own copy of the mixtures.  Every
+ * connection is served by its own thread, which keeps the statistics of the
+ * connection.
+ *
+ * <b>Example usage:</b>
+ * @code
+ * std::vector<std::string> names;
+ * std::vector<MixtureOptions> options;
+ * names.push_back("air_5");
+ * options.push_back(MixtureOptions("air_5"));
+ * names.push_back("air_11");
+ * options.push_back(MixtureOptions("air_11"));
+ *
+ * PropertyServer server(names, options, "/tmp/mpp.sock", 4);
+ * server.run(); // until server.stop() is called from another thread
+ * @endcode
+ */
+class PropertyServer
+{
+public:
+
+    /**
+     * Loads nworkers copies of each named mixture and starts listening on the
+     * given socket path.  A stale socket left at that path is replaced.
+     * Throws an Error if the names are not unique or the socket cannot be
+     * created.
+     */
+    PropertyServer(
+        const std::vector<std::string>& names,
+        const std::vector<MixtureOptions>& options,
+        const std::string& socket_path, int nworkers = 1);
+
+    /**
+     * Serves a single mixture, named after its mixture file without directory
+     * and extension (for instance air_11), if it has one.
+     */
+    PropertyServer(
+        const MixtureOptions& options, const std::string& socket_path,
+        int nworkers = 1);
+
+    /// Stops the server and removes its socket.
+    ~PropertyServer();
+
+    /// Returns the path of the socket.
+    const std::string& socketPath() const { return m_socket_path; }
+
+    /// Returns the number of worker threads.
+    int nWorkers() const { return m_mixtures.size(); }
+
+    /// Returns the number of mixtures served.
+    int nMixtures() const { return m_names.size(); }
+
+    /// Returns the name of the i'th mixture.
+    const std::string& mixtureName(int i) const { return m_names[i]; }
+
+    /// Reports the statistics of each connection on the standard error.
+    void setVerbose(bool verbose) { m_verbose = verbose; }
+
+    /**
+     * Accepts and serves clients until stop() is called, then waits for the
+     * open connections to finish.
+     */
+    void run();
+
+    /// Makes run() return.  May be called from any thread.
+    void stop();
+
+private:
+
+    /// A block of states evaluated by one worker.
+    struct Task;
+
+    /// Keeps track of the tasks of one request.
+    struct Batch;
+
+    /// A connection thread and its socket.
+    struct Connection;
+
+    // Not copyable
+    PropertyServer(const PropertyServer&);
+    PropertyServer& operator=(const PropertyServer&);
+
+    /// Loads the mixtures and starts listening, for the constructors.
+    void initialize(
+        const std::vector<MixtureOptions>& options, int nworkers);
+
+    /// Evaluates tasks with the given worker's mixtures until the server stops.
+    void work(int worker);
+
+    /// Answers the requests of a client until it disconnects.
+    void serve(Connection* p_connection);
+
+    /**
+     * Splits n states into tasks for the workers and waits for them to finish,
+     * returning the number of states which could not be set.
+     */
+    int evaluate(
+        int mixture, const BatchProperties& props,
+        const double* const p_states, int n, int vars,
+        double* const p_values);
+
+    /// Reports the statistics of a closed connection.
+    void report(int client, const PropertyProtocol::Statistics& stats);
+
+private:
+
+    std::string m_socket_path;
+    int m_listen_fd;
+    bool m_verbose;
+    std::atomic<bool> m_stopping;
+
+    // Names of the mixtures, and copies of every mixture for each worker
+    std::vector<std::string> m_names;
+    std::vector< std::vector<Mixture*> > m_mixtures;
+    std::vector<std::thread> m_workers;
+
+    std::mutex m_task_mutex;
+    std::condition_variable m_task_ready;
+    std::condition_variable m_task_done;
+    std::deque<Task*> m_tasks;
+
+    std::mutex m_connection_mutex;
+    std::list<Connection*> m_connections;
+    int m_nclients;
+
+}; // class PropertyServer
+
+} // namespace Mutation
+
+#endif // GENERAL_PROPERTY_SERVER_H
@@ -27,6 +27,7 @@
  */
 
 #include "mutation++.h"
+#include <cmath>
 #include <iostream>
 #include <eigen3/Eigen/Dense>
 
@@ -34,6 +35,10 @@
 #include <fenv.h>
 #endif
 
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
 using namespace std;
 using namespace Mutation;
 using namespace Mutation::Thermodynamics;
@@ -43,8 +48,8 @@ using namespace Mutation::Utilities;
  * @page bprime B' Solver (bprime)
  * __Usage__:
  *
- *    bprime -T \f$T_1:\Delta T:T_2\f$ -p
- *    \f$p\f$ -b \f$B'_g\f$ -m mixture -bl BL -py Pyrolysis
+ *    bprime -T \f$T_1:\Delta T:T_2\f$ -P
+ *    \f$p\f$ -b \f$B'_g\f$ -m mixture -bl BL -py Pyrolysis [-o file]
  *
  * This program generates a so-called "B-prime" table for a given temperature
  * range and stepsize in K, a fixed pressure in Pa, a value of \f$B'_g\f$
@@ -56,19 +61,27 @@ using namespace Mutation::Utilities;
  * represent the boundary layer edge and pyrolysis gases respectively. The
  * produced table provides values of \f$B'_c\f$, the wall enthalpy in MJ/kg, and
  * the species mole fractions at the wall versus temperature.
+ *
+ * The pressure and \f$B'_g\f$ can also be given as ranges, or as comma
+ * separated lists such as `-P 100,1000,10000`, in which case one temperature
+ * line is computed for each pair of values.  The lines are computed in
+ * parallel when Mutation++ is built with `ENABLE_OPENMP`, and the
+ * equilibrium calculations along each line are warm-started from the
+ * previous temperature.  With `-o`, the table is written to a binary file
+ * which can be loaded by Thermodynamics::BprimeTable to interpolate
+ * \f$B'_c\f$, \f$h_w\f$ and the wall composition, instead of being
+ * printed.
  */
 // Simply stores the command line options
 typedef struct {
-    double T1;
-    double T2;
-    double dT;
-
-    double P1;
-    double Bg;
+    std::vector<double> T;
+    std::vector<double> P;
+    std::vector<double> Bg;
 
     std::string mixture;
     std::string boundary_layer_comp;
     std::string pyrolysis_composition;
+    std::string output_file;
 
     bool pyrolysis_exist = false;
 } Options;
@@ -108,16 +121,18 @@ void printHelpMessage(const char* const name)
     cout << endl;
     cout << tab << "-h, --help          prints this help message" << endl;
     cout << tab << "-T                  temperature range in K \"T1:dT:T2\" or simply T (default = 300:100:5000 K)" << endl;
-    cout << tab << "-P                  pressure in Pa P (default = 1 atm)" << endl;
-    cout << tab << "-b                  pyrolysis non-dimensional mass blowing rate (default = 0)" << endl;
+    cout << tab << "-P                  pressure in Pa P, range \"P1:dP:P2\", or list \"P1,P2,...\" (default = 1 atm)" << endl;
+    cout << tab << "-b                  pyrolysis non-dimensional mass blowing rate, range, or list (default = 0)" << endl;
     cout << tab << "-m                  mixture name" << endl;
     cout << tab << "-bl                 boundary layer edge composition name" << endl;
     cout << tab << "-py                 pyrolysis composition name (default = null)" << endl;
+    cout << tab << "-o                  write the table to this binary file instead of printing it" << endl;
 
 
     cout << endl;
     cout << "Example:" << endl;
     cout << tab << name << " -T 300:100:5000 -P 101325 -b 10 -m carbonPhenol -bl BLedge -py Gas" << endl;
+    cout << tab << name << " -T 300:50:5000 -P 100,1000,10000,101325 -b 0:0.5:10 -m carbonPhenol -bl BLedge -py Gas -o carbonPhenol.bprime" << endl;
     cout << endl;
     cout << "Mixture file:" << endl;
     cout << tab << "carbonPhenol - corresponds to the name of the mixture" << endl;
@@ -128,15 +143,26 @@ void printHelpMessage(const char* const name)
     exit(0);
 }
 
-// Parses a temperature or pressure range
-bool parseRange(const std::string& range, double& x1, double& x2, double& dx)
+// Parses a range "x1:dx:x2", a list "x1,x2,...", or a single value
+bool parseRange(const std::string& range, std::vector<double>& values)
 {
     std::vector<std::string> tokens;
-    String::tokenize(range, tokens, ":");
+    values.clear();
 
+    if (range.find(',') != std::string::npos) {
+        String::tokenize(range, tokens, ",");
+        if (!String::isNumeric(tokens))
+            return false;
+        for (int i = 0; i < tokens.size(); ++i)
+            values.push_back(atof(tokens[i].c_str()));
+        return true;
+    }
+
+    String::tokenize(range, tokens, ":");
     if (!String::isNumeric(tokens))
         return false;
 
+    double x1, x2, dx;
     switch (tokens.size()) {
         case 1:
             x1 = atof(tokens[0].c_str());
@@ -152,27 +178,16 @@ bool parseRange(const std::string& range, double& x1, double& x2, double& dx)
             return false;
     }
 
-    if (dx == 0.0) {
+    if (dx <= 0.0) {
         x2 = x1;
         dx = 1.0;
     }
 
-    return true;
-}
-
-
-bool parseRange(const std::string& range, double& x1)
-{
-    std::vector<std::string> tokens;
-    String::tokenize(range, tokens, ":");
-
-    if (!String::isNumeric(tokens))
-        return false;
-
-    x1 = atof(tokens[0].c_str());
-
+    const int n = int(std::floor((x2 - x1) / dx + 1.0e-6)) + 1;
+    for (int i = 0; i < n; ++i)
+        values.push_back(x1 + i*dx);
 
-    return true;
+    return !values.empty();
 }
 
 // Parse the command line options to determine what the user wants to do
@@ -189,37 +204,32 @@ Options parseOptions(int argc, char** argv)
 
     // Get the temperature range
     if (optionExists(argc, argv, "-T")) {
-        if (!parseRange(
-                getOption(argc, argv, "-T"), opts.T1, opts.T2, opts.dT)) {
+        if (!parseRange(getOption(argc, argv, "-T"), opts.T)) {
             cout << "Bad format for temperature range!" << endl;
             printHelpMessage(argv[0]);
         }
     } else {
-        opts.T1 = 300.0;
-        opts.T2 = 15000.0;
-        opts.dT = 100.0;
+        parseRange("300:100:15000", opts.T);
     }
 
     // Get the pressure range
     if (optionExists(argc, argv, "-P")) {
-        if (!parseRange(
-                getOption(argc, argv, "-P"), opts.P1)) {
+        if (!parseRange(getOption(argc, argv, "-P"), opts.P)) {
             cout << "Bad format for pressure !" << endl;
             printHelpMessage(argv[0]);
         }
     } else {
-        opts.P1 = ONEATM;
+        opts.P.push_back(ONEATM);
     }
 
-    // Get the pressure range
+    // Get the pyrolysis blowing rate range
     if (optionExists(argc, argv, "-b")) {
-        if (!parseRange(
-                getOption(argc, argv, "-b"), opts.Bg)) {
-            cout << "Bad format for pressure !" << endl;
+        if (!parseRange(getOption(argc, argv, "-b"), opts.Bg)) {
+            cout << "Bad format for B'g !" << endl;
             printHelpMessage(argv[0]);
         }
     } else {
-        opts.Bg = 0;
+        opts.Bg.push_back(0.0);
     }
 
     if (optionExists(argc, argv, "-m")) {
@@ -240,6 +250,9 @@ Options parseOptions(int argc, char** argv)
         opts.pyrolysis_exist= true;
     }
 
+    if (optionExists(argc, argv, "-o"))
+        opts.output_file = getOption(argc, argv, "-o");
+
     return opts;
 }
 
@@ -259,21 +272,54 @@ int main(int argc, char* argv[])
     
     std::vector<double> Yke (ne,0);
     std::vector<double> Ykg (ne,0);
-    std::vector<double> Xw (ns,0);
-
-    // Run conditions
-    double T1 = opts.T1;
-    double T2 = opts.T2;
-    double dt = opts.dT;
-    double P  = opts.P1;
-    double Bg = opts.Bg;
-    double Bc, hw;
     
     mix.getComposition(opts.boundary_layer_comp, Yke.data(), Composition::MASS);
 
     if(opts.pyrolysis_exist)
         mix.getComposition(opts.pyrolysis_composition, Ykg.data(), Composition::MASS);
 
+    // Each thread solves whole temperature lines with its own mixture
+    const int np = opts.P.size();
+    const int nb = opts.Bg.size();
+    const int nlines = np*nb;
+    BprimeTable table(mix, opts.T, opts.P, opts.Bg);
+
+#ifdef _OPENMP
+    const int nthreads = std::max(1, std::min(omp_get_max_threads(), nlines));
+#else
+    const int nthreads = 1;
+#endif
+    std::vector<Mixture*> mixtures(1, &mix);
+    for (int i = 1; i < nthreads; ++i)
+        mixtures.push_back(new Mixture(opts.mixture));
+
+#ifdef _OPENMP
+    #pragma omp parallel for schedule(dynamic) num_threads(nthreads)
+#endif
+    for (int line = 0; line < nlines; ++line) {
+#ifdef _OPENMP
+        Mixture& thread_mix = *mixtures[omp_get_thread_num()];
+#else
+        Mixture& thread_mix = mix;
+#endif
+        table.compute(
+            thread_mix, Yke.data(), Ykg.data(), line % np, line / np);
+    }
+
+    for (int i = 1; i < nthreads; ++i)
+        delete mixtures[i];
+
+    if (!opts.output_file.empty()) {
+        table.save(opts.output_file);
+        cout << "Wrote " << opts.T.size() << " x " << np << " x " << nb
+             << " B' table to " << opts.output_file << endl;
+        return 0;
+    }
+
+    // Print the table, with the pressure and B'g columns only if they vary
+    const bool print_lines = (nlines > 1);
+    if (print_lines)
+        cout << setw(15) << "\"P[Pa]\"" << setw(15) << "\"B'g\"";
     cout << setw(10) << "\"Tw[K]\""
          << setw(15) << "\"B'c\""
          << setw(15) << "\"hw[MJ/kg]\"";
@@ -281,12 +327,20 @@ int main(int argc, char* argv[])
         cout << setw(25) << "\"" + mix.speciesName(i) + "\"";
     cout << endl;
     
-    for (double T = T1; T < T2 + 1.0e-6; T += dt) {
-        mix.surfaceMassBalance(Yke.data(), Ykg.data(), T, P, Bg, Bc, hw, Xw.data());
-        cout << setw(10) << T << setw(15) << Bc << setw(15) << hw / 1.0e6;
-        for (int i = 0; i < ns; ++i)
-            cout << setw(25) << Xw[i];
-        cout << endl;
+    for (int ib = 0; ib < nb; ++ib) {
+        for (int ip = 0; ip < np; ++ip) {
+            for (int it = 0; it < opts.T.size(); ++it) {
+                if (print_lines)
+                    cout << setw(15) << opts.P[ip] << setw(15) << opts.Bg[ib];
+                cout << setw(10) << opts.T[it]
+                     << setw(15) << table.Bc(it, ip, ib)
+                     << setw(15) << table.hw(it, ip, ib) / 1.0e6;
+                const double* const p_Xw = table.Xw(it, ip, ib);
+                for (int i = 0; i < ns; ++i)
+                    cout << setw(25) << p_Xw[i];
+                cout << endl;
+            }
+        }
     }
 
 }
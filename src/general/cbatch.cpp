@@ -0,0 +1,258 @@
+/**
+ * @file cbatch.cpp
+ *
+ * @brief Implementation of the C batch interface.
+ */
+
+/*
+ * Copyright 2018 von Karman Institute for Fluid Dynamics (VKI)
+ *
+ * This file is part of MUlticomponent Thermodynamic And Transport
+ * properties for IONized gases in C++ (Mutation++) software package.
+ *
+ * Mutation++ is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as
+ * published by the Free Software Foundation, either version 3 of the
+ * License, or (at your option) any later version.
+ *
+ * Mutation++ is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with Mutation++.  If not, see
+ * <http://www.gnu.org/licenses/>.
+ */
+
+#include "cbatch.h"
+#include "BatchProperties.h"
+#include "Errors.h"
+#include "Mixture.h"
+
+#include <algorithm>
+#include <limits>
+#include <string>
+#include <vector>
+
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+using namespace Mutation;
+
+struct mpp_batch {
+    std::vector<Mixture*> mixtures;
+};
+
+// Message of the last error in each thread
+static thread_local std::string sm_error;
+
+// Sets the error message from an exception, returning the error value
+template <typename T>
+static T fail(const std::exception& e, T value)
+{
+    sm_error = e.what();
+    return value;
+}
+
+// Returns the first and last rows evaluated by the calling thread
+static void threadRows(
+    ptrdiff_t n, int thread, int nthreads, ptrdiff_t& first, ptrdiff_t& last)
+{
+    first = n*thread / nthreads;
+    last  = n*(thread+1) / nthreads;
+}
+
+//==============================================================================
+
+mpp_batch* mpp_batch_create(
+    const char* mixture, const char* state_model, int nthreads)
+{
+#ifdef _OPENMP
+    if (nthreads < 1)
+        nthreads = omp_get_max_threads();
+#else
+    nthreads = 1;
+#endif
+
+    mpp_batch* p_batch = new mpp_batch();
+    try {
+        MixtureOptions opts(mixture);
+        if (state_model != NULL && state_model[0] != '\0')
+            opts.setStateModel(state_model);
+        for (int i = 0; i < std::max(nthreads, 1); ++i)
+            p_batch->mixtures.push_back(new Mixture(opts));
+    } catch (std::exception& e) {
+        mpp_batch_destroy(p_batch);
+        return fail(e, (mpp_batch*) NULL);
+    }
+
+    return p_batch;
+}
+
+//==============================================================================
+
+void mpp_batch_destroy(mpp_batch* p_batch)
+{
+    if (p_batch == NULL)
+        return;
+    for (int i = 0; i < p_batch->mixtures.size(); ++i)
+        delete p_batch->mixtures[i];
+    delete p_batch;
+}
+
+//==============================================================================
+
+const char* mpp_batch_error(void)
+{
+    return sm_error.c_str();
+}
+
+//==============================================================================
+
+int mpp_batch_nspecies(const mpp_batch* p_batch)
+{
+    return p_batch->mixtures[0]->nSpecies();
+}
+
+//==============================================================================
+
+const char* mpp_batch_species_name(const mpp_batch* p_batch, int i)
+{
+    const Mixture& mix = *p_batch->mixtures[0];
+    if (i < 0 || i >= mix.nSpecies())
+        return NULL;
+    return mix.speciesName(i).c_str();
+}
+
+//==============================================================================
+
+int mpp_batch_ninputs(const mpp_batch* p_batch)
+{
+    const Mixture& mix = *p_batch->mixtures[0];
+    return mix.nMassEqns() + mix.nEnergyEqns();
+}
+
+//==============================================================================
+
+int mpp_batch_nthreads(const mpp_batch* p_batch)
+{
+    return p_batch->mixtures.size();
+}
+
+//==============================================================================
+
+int mpp_batch_nvalues(const mpp_batch* p_batch, const char* properties)
+{
+    try {
+        return BatchProperties(*p_batch->mixtures[0], properties).nValues();
+    } catch (std::exception& e) {
+        return fail(e, -1);
+    }
+}
+
+//==============================================================================
+
+ptrdiff_t mpp_batch_evaluate(
+    mpp_batch* p_batch, const char* properties, int vars, ptrdiff_t n,
+    const double* states, ptrdiff_t state_row_stride,
+    ptrdiff_t state_col_stride, double* values, ptrdiff_t value_row_stride,
+    ptrdiff_t value_col_stride)
+{
+    BatchProperties* p_props;
+    try {
+        p_props = new BatchProperties(*p_batch->mixtures[0], properties);
+    } catch (std::exception& e) {
+        return fail(e, ptrdiff_t(-1));
+    }
+
+    const int nin = p_props->nInputs();
+    const int nout = p_props->nValues();
+    ptrdiff_t nfailed = 0;
+
+    // Each thread evaluates a contiguous block of rows, gathering each state
+    // and scattering its values so that any strides are accepted
+#ifdef _OPENMP
+    const int nthreads = p_batch->mixtures.size();
+    #pragma omp parallel num_threads(nthreads) reduction(+:nfailed)
+#endif
+    {
+#ifdef _OPENMP
+        const int thread = omp_get_thread_num();
+        const int nt = omp_get_num_threads();
+#else
+        const int thread = 0;
+        const int nt = 1;
+#endif
+        Mixture& mix = *p_batch->mixtures[thread];
+        std::vector<double> state(nin), row(nout);
+
+        ptrdiff_t first, last;
+        threadRows(n, thread, nt, first, last);
+        for (ptrdiff_t i = first; i < last; ++i) {
+            const double* const p_in = states + i*state_row_stride;
+            for (int j = 0; j < nin; ++j)
+                state[j] = p_in[j*state_col_stride];
+
+            if (!p_props->evaluate(mix, state.data(), vars, row.data())) {
+                std::fill(
+                    row.begin(), row.end(),
+                    std::numeric_limits<double>::quiet_NaN());
+                nfailed++;
+            }
+
+            double* const p_out = values + i*value_row_stride;
+            for (int j = 0; j < nout; ++j)
+                p_out[j*value_col_stride] = row[j];
+        }
+    }
+
+    delete p_props;
+    return nfailed;
+}
+
+//==============================================================================
+
+ptrdiff_t mpp_batch_equilibrate(
+    mpp_batch* p_batch, ptrdiff_t n, const double* T, ptrdiff_t T_stride,
+    const double* P, ptrdiff_t P_stride, double* X, ptrdiff_t X_row_stride,
+    ptrdiff_t X_col_stride)
+{
+    const int ns = p_batch->mixtures[0]->nSpecies();
+    ptrdiff_t nfailed = 0;
+
+#ifdef _OPENMP
+    const int nthreads = p_batch->mixtures.size();
+    #pragma omp parallel num_threads(nthreads) reduction(+:nfailed)
+#endif
+    {
+#ifdef _OPENMP
+        const int thread = omp_get_thread_num();
+        const int nt = omp_get_num_threads();
+#else
+        const int thread = 0;
+        const int nt = 1;
+#endif
+        Mixture& mix = *p_batch->mixtures[thread];
+
+        ptrdiff_t first, last;
+        threadRows(n, thread, nt, first, last);
+        for (ptrdiff_t i = first; i < last; ++i) {
+            bool ok = true;
+            try {
+                mix.equilibrate(T[i*T_stride], P[i*P_stride]);
+            } catch (Error& e) {
+                ok = false;
+                nfailed++;
+            }
+
+            double* const p_out = X + i*X_row_stride;
+            for (int j = 0; j < ns; ++j)
+                p_out[j*X_col_stride] = (ok ? mix.X()[j] :
+                    std::numeric_limits<double>::quiet_NaN());
+        }
+    }
+
+    return nfailed;
+}
@@ -0,0 +1,131 @@
+/**
+ * @file cbatch.h
+ *
+ * @brief C interface which evaluates mixture properties for arrays of states.
+ */
+
+/*
+ * Copyright 2018 von Karman Institute for Fluid Dynamics (VKI)
+ *
+ * This file is part of MUlticomponent Thermodynamic And Transport
+ * properties for IONized gases in C++ (Mutation++) software package.
+ *
+ * Mutation++ is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as
+ * published by the Free Software Foundation, either version 3 of the
+ * License, or (at your option) any later version.
+ *
+ * Mutation++ is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with Mutation++.  If not, see
+ * <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef GENERAL_CBATCH_H
+#define GENERAL_CBATCH_H
+
+#include <stddef.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @defgroup CBatchAPI C Batch API
+ *
+ * These functions evaluate mixture properties for whole arrays of states in a
+ * single call, so that they can be called from other languages (for instance
+ * from Python with ctypes, see `src/python/mutationpp_batch.py`) without
+ * paying the cost of a call per state.  Unlike the Fortran wrapper, any number
+ * of mixtures may be loaded at once, each behind its own handle.
+ *
+ * Arrays are read and written in place.  Row i, column j of a two-dimensional
+ * array p is p[i*row_stride + j*col_stride], with strides counted in doubles,
+ * so that C and Fortran ordered arrays and slices of larger arrays can be
+ * passed without copying them.  Each row of the input is a state given as to
+ * Mixture::setState() and each row of the output holds the values of a state.
+ *
+ * The states are evaluated in parallel when Mutation++ is built with
+ * `ENABLE_OPENMP`, each thread with its own copy of the mixture.  A handle must
+ * not be used by several threads at once.
+ *
+ * Functions returning a handle or a count signal errors with NULL or -1, and
+ * mpp_batch_error() then describes the error.
+ *
+ * @{
+ */
+
+/// Opaque handle to a loaded mixture.
+typedef struct mpp_batch mpp_batch;
+
+/**
+ * Loads a mixture with the given state model (or the default one of the
+ * mixture if NULL or empty), for evaluations with nthreads threads (or the
+ * OpenMP default if nthreads < 1).  Returns NULL on error.
+ */
+mpp_batch* mpp_batch_create(
+    const char* mixture, const char* state_model, int nthreads);
+
+/// Frees a handle returned by mpp_batch_create().
+void mpp_batch_destroy(mpp_batch* p_batch);
+
+/**
+ * Returns the message of the last error raised in the calling thread, or an
+ * empty string.
+ */
+const char* mpp_batch_error(void);
+
+/// Returns the number of species in the mixture.
+int mpp_batch_nspecies(const mpp_batch* p_batch);
+
+/// Returns the name of the i'th species, or NULL if i is out of range.
+const char* mpp_batch_species_name(const mpp_batch* p_batch, int i);
+
+/// Returns the number of values which define a state.
+int mpp_batch_ninputs(const mpp_batch* p_batch);
+
+/// Returns the number of threads used for the evaluations.
+int mpp_batch_nthreads(const mpp_batch* p_batch);
+
+/**
+ * Returns the number of values computed for each state by the comma separated
+ * list of properties (as listed by mppbatch -h), or -1 if a property is not
+ * known.
+ */
+int mpp_batch_nvalues(const mpp_batch* p_batch, const char* properties);
+
+/**
+ * Sets the state of the mixture to each of the n rows of states with the given
+ * variable set, and writes the properties to the corresponding row of values.
+ * The values of states which cannot be set are NaN.  Returns the number of
+ * such states, or -1 if a property is not known.
+ */
+ptrdiff_t mpp_batch_evaluate(
+    mpp_batch* p_batch, const char* properties, int vars, ptrdiff_t n,
+    const double* states, ptrdiff_t state_row_stride,
+    ptrdiff_t state_col_stride, double* values, ptrdiff_t value_row_stride,
+    ptrdiff_t value_col_stride);
+
+/**
+ * Computes the equilibrium mole fractions of the mixture at the n temperatures
+ * T[i*T_stride] and pressures P[i*P_stride], with the default elemental
+ * fractions of the mixture, and writes them to the rows of X.  The rows of
+ * the states which cannot be equilibrated are NaN.  Returns the number of such
+ * states.
+ */
+ptrdiff_t mpp_batch_equilibrate(
+    mpp_batch* p_batch, ptrdiff_t n, const double* T, ptrdiff_t T_stride,
+    const double* P, ptrdiff_t P_stride, double* X, ptrdiff_t X_row_stride,
+    ptrdiff_t X_col_stride);
+
+/// @}
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // GENERAL_CBATCH_H
@@ -0,0 +1,530 @@
+/**
+ * @file mppbatch.cpp
+ *
+ * @brief Utility which evaluates mixture properties for a stream of states.
+ * @see @ref mppbatch
+ */
+
+/*
+ * Copyright 2018 von Karman Institute for Fluid Dynamics (VKI)
+ *
+ * This file is part of MUlticomponent Thermodynamic And Transport
+ * properties for IONized gases in C++ (Mutation++) software package.
+ *
+ * Mutation++ is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as
+ * published by the Free Software Foundation, either version 3 of the
+ * License, or (at your option) any later version.
+ *
+ * Mutation++ is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with Mutation++.  If not, see
+ * <http://www.gnu.org/licenses/>.
+ */
+
+#include "mutation++.h"
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <sstream>
+#include <vector>
+
+#ifndef _WIN32
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+using std::cerr;
+using std::cout;
+using std::endl;
+
+using namespace Mutation;
+using namespace Mutation::Utilities;
+
+// Number of states evaluated between writes to the output
+#define CHUNK_STATES 4096
+
+/**
+ * @page mppbatch Mutation++ Batch Evaluation (mppbatch)
+ *
+ * __Usage:__
+ *
+ * mppbatch [OPTIONS] mixture
+ *
+ * Evaluates a list of mixture properties for every state read from a file, or
+ * from the standard input.  Each state is the set of variables passed to
+ * Mixture::setState(), for instance the species densities followed by the
+ * temperatures with the default variable set of the ChemNonEq1T and
+ * ChemNonEqTTv state models.  States are either text lines of comma or space
+ * separated values, or records of raw doubles.  The states are evaluated in
+ * chunks, in parallel when Mutation++ is built with `ENABLE_OPENMP`, and the
+ * results are written in the order of the input.  Use
+ *
+ *     mppbatch -h
+ *
+ * for a full list of options.
+ */
+
+// Simply stores the command line options
+typedef struct {
+    std::string input_file;
+    std::string output_file;
+    std::string properties;
+
+    int vars;
+    bool binary_input;
+    bool binary_output;
+    bool header;
+    bool verbose;
+    int precision;
+
+    Mutation::MixtureOptions* p_mixture_opts;
+} Options;
+
+// Checks if an option is present
+bool optionExists(int argc, char** argv, const std::string& option)
+{
+    return (std::find(argv, argv+argc, option) != argv+argc);
+}
+
+// Returns the value associated with a particular option
+std::string getOption(int argc, char** argv, const std::string& option)
+{
+    std::string value;
+    char** ptr = std::find(argv, argv+argc, option);
+
+    if (ptr == argv+argc || ptr+1 == argv+argc)
+        value = "";
+    else
+        value = *(ptr+1);
+
+    return value;
+}
+
+// Prints the program's usage information and exits.
+void printHelpMessage(const char* const name)
+{
+    std::string tab("    ");
+
+    cout.setf(std::ios::left, std::ios::adjustfield);
+
+    cout << endl;
+    cout << "Usage: " << name << " [OPTIONS] mixture" << endl;
+    cout << "Evaluate mixture properties for a stream of states using the "
+         << "Mutation++ library." << endl;
+    cout << endl;
+    cout << tab << "-h, --help          prints this help message" << endl;
+    cout << tab << "-v, --verbose       reports the throughput on the standard error" << endl;
+    cout << tab << "-i                  input file (default = standard input)" << endl;
+    cout << tab << "-o                  output file (default = standard output)" << endl;
+    cout << tab << "-q                  comma separated list of values to output (default = P,rho,h)" << endl;
+    cout << tab << "    --vars          variable set given to Mixture::setState() (default = 1)" << endl;
+    cout << tab << "    --state-model   overrides the state model of the mixture" << endl;
+    cout << tab << "    --species-list  instead of mixture name, use this to list species in mixture" << endl;
+    cout << tab << "    --binary-in     states are records of raw doubles instead of text lines" << endl;
+    cout << tab << "    --binary-out    results are written as records of raw doubles" << endl;
+    cout << tab << "    --no-header     no header line will be written to text output" << endl;
+    cout << tab << "    --precision     number of significant digits of text output (default = 10)" << endl;
+    cout << endl;
+    cout << "Values:" << endl;
+
+    for (int i = 0; i < BatchProperties::nProperties(); ++i) {
+        const BatchProperties::Property& p = BatchProperties::property(i);
+        cout << tab << std::setw(10) << p.name << std::setw(12)
+             << (p.units[0] == '\0' ? "[-]" : "[" + std::string(p.units) + "]")
+             << p.description
+             << (p.size == BatchProperties::SPECIES ? " (one per species)" :
+                (p.size == BatchProperties::TRANSFER ?
+                 " (one per energy equation but the total)" : ""))
+             << endl;
+    }
+
+    cout << endl;
+    cout << "Example:" << endl;
+    cout << tab << name << " --state-model ChemNonEqTTv -q T,Tv,mu,lam_f,omega -i states.csv air_11" << endl;
+    cout << tab << name << " --binary-in --binary-out -q mu,Dm -i states.bin -o props.bin air_11" << endl;
+    cout << endl;
+
+    exit(0);
+}
+
+// Parse the command line options to determine what the user wants to do
+Options parseOptions(int argc, char** argv)
+{
+    Options opts;
+
+    // Print the help message and exit if desired
+    if (argc < 2 || optionExists(argc, argv, "-h") ||
+        optionExists(argc, argv, "--help"))
+        printHelpMessage(argv[0]);
+
+    opts.verbose =
+        optionExists(argc, argv, "-v") || optionExists(argc, argv, "--verbose");
+    opts.header = !optionExists(argc, argv, "--no-header");
+    opts.binary_input = optionExists(argc, argv, "--binary-in");
+    opts.binary_output = optionExists(argc, argv, "--binary-out");
+    opts.input_file = getOption(argc, argv, "-i");
+    opts.output_file = getOption(argc, argv, "-o");
+
+    // The mixture name is given as the last argument (unless --species-list
+    // option is present)
+    if (optionExists(argc, argv, "--species-list")) {
+        opts.p_mixture_opts = new Mutation::MixtureOptions();
+        opts.p_mixture_opts->setSpeciesDescriptor(
+            getOption(argc, argv, "--species-list"));
+    } else {
+        opts.p_mixture_opts = new Mutation::MixtureOptions(argv[argc-1]);
+    }
+
+    if (optionExists(argc, argv, "--state-model"))
+        opts.p_mixture_opts->setStateModel(
+            getOption(argc, argv, "--state-model"));
+
+    opts.vars = 1;
+    if (optionExists(argc, argv, "--vars"))
+        opts.vars = atoi(getOption(argc, argv, "--vars").c_str());
+
+    opts.precision = 10;
+    if (optionExists(argc, argv, "--precision"))
+        opts.precision = atoi(getOption(argc, argv, "--precision").c_str());
+
+    opts.properties = "P,rho,h";
+    if (optionExists(argc, argv, "-q"))
+        opts.properties = getOption(argc, argv, "-q");
+
+    return opts;
+}
+
+//==============================================================================
+
+/**
+ * Reads the states in chunks of records of a fixed number of values.
+ */
+class StateReader
+{
+public:
+    StateReader(int nv) : m_nv(nv) { }
+    virtual ~StateReader() { }
+
+    /**
+     * Returns a pointer to the next n <= max records, with n = 0 at the end of
+     * the input.
+     */
+    virtual const double* next(int max, int& n) = 0;
+
+protected:
+    const int m_nv;
+    std::vector<double> m_buffer;
+};
+
+/**
+ * Reads lines of comma or space separated values.  Empty lines, lines starting
+ * with '#' and a leading header line are skipped.
+ */
+class TextReader : public StateReader
+{
+public:
+    TextReader(std::istream& in, int nv) :
+        StateReader(nv), m_in(in), m_line(0)
+    { }
+
+    const double* next(int max, int& n)
+    {
+        m_buffer.resize(std::size_t(max)*m_nv);
+        std::string line;
+        n = 0;
+
+        while (n < max && std::getline(m_in, line)) {
+            m_line++;
+
+            // Skip blank and comment lines
+            const std::size_t first = line.find_first_not_of(" \t\r");
+            if (first == std::string::npos || line[first] == '#')
+                continue;
+
+            char* p = &line[0];
+            char* end;
+            double* const p_record = &m_buffer[std::size_t(n)*m_nv];
+            int k = 0;
+            for ( ; k < m_nv; ++k) {
+                while (*p == ',' || *p == ' ' || *p == '\t')
+                    p++;
+                p_record[k] = std::strtod(p, &end);
+                if (end == p)
+                    break;
+                p = end;
+            }
+
+            // Allow for a header line
+            if (k == 0 && m_line == 1)
+                continue;
+
+            while (*p == ',' || *p == ' ' || *p == '\t' || *p == '\r')
+                p++;
+            if (k < m_nv || *p != '\0') {
+                cerr << "Line " << m_line << ": expected " << m_nv
+                     << " values!" << endl;
+                exit(1);
+            }
+
+            n++;
+        }
+
+        return m_buffer.data();
+    }
+
+private:
+    std::istream& m_in;
+    int m_line;
+};
+
+/**
+ * Reads records of raw doubles from a stream.
+ */
+class BinaryReader : public StateReader
+{
+public:
+    BinaryReader(std::istream& in, int nv) : StateReader(nv), m_in(in) { }
+
+    const double* next(int max, int& n)
+    {
+        m_buffer.resize(std::size_t(max)*m_nv);
+        m_in.read(
+            reinterpret_cast<char*>(m_buffer.data()),
+            m_buffer.size()*sizeof(double));
+
+        const std::size_t values = m_in.gcount() / sizeof(double);
+        if (m_in.gcount() % (m_nv*sizeof(double)) != 0) {
+            cerr << "The input ends with an incomplete record!" << endl;
+            exit(1);
+        }
+
+        n = values / m_nv;
+        return m_buffer.data();
+    }
+
+private:
+    std::istream& m_in;
+};
+
+#ifndef _WIN32
+/**
+ * Reads records of raw doubles from a memory-mapped file, so that large inputs
+ * are not copied.
+ */
+class MappedReader : public StateReader
+{
+public:
+    MappedReader(void* p_map, std::size_t bytes, int nv) :
+        StateReader(nv), mp_map(p_map), m_bytes(bytes), m_next(0)
+    {
+        if (bytes % (nv*sizeof(double)) != 0) {
+            cerr << "The input ends with an incomplete record!" << endl;
+            exit(1);
+        }
+        m_records = bytes / (nv*sizeof(double));
+        madvise(p_map, bytes, MADV_SEQUENTIAL);
+    }
+
+    ~MappedReader() { munmap(mp_map, m_bytes); }
+
+    /**
+     * Maps the given file, or returns NULL if it cannot be mapped.
+     */
+    static MappedReader* open(const std::string& file_name, int nv)
+    {
+        const int fd = ::open(file_name.c_str(), O_RDONLY);
+        if (fd < 0)
+            return NULL;
+
+        struct stat st;
+        void* p_map = MAP_FAILED;
+        if (fstat(fd, &st) == 0 && st.st_size > 0)
+            p_map = mmap(NULL, st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+        close(fd);
+
+        if (p_map == MAP_FAILED)
+            return NULL;
+        return new MappedReader(p_map, st.st_size, nv);
+    }
+
+    const double* next(int max, int& n)
+    {
+        n = std::min(std::size_t(max), m_records - m_next);
+        const double* const p_states =
+            static_cast<const double*>(mp_map) + m_next*m_nv;
+        m_next += n;
+        return p_states;
+    }
+
+private:
+    void* mp_map;
+    std::size_t m_bytes;
+    std::size_t m_records;
+    std::size_t m_next;
+};
+#endif
+
+//==============================================================================
+
+int main(int argc, char** argv)
+{
+    // Parse the command line options and load the mixture
+    Options opts = parseOptions(argc, argv);
+    Mutation::Mixture mix(*opts.p_mixture_opts);
+
+    // Select the properties to compute
+    BatchProperties* p_props = NULL;
+    try {
+        p_props = new BatchProperties(mix, opts.properties);
+    } catch (InvalidInputError& e) {
+        cerr << "Unknown value " << e.inputValue() << "!" << endl;
+        exit(1);
+    }
+
+    const int nin = p_props->nInputs();
+    const int nout = p_props->nValues();
+
+    // Open the input, mapping binary files into memory when possible
+    StateReader* p_reader = NULL;
+    std::ifstream in_file;
+    if (!opts.input_file.empty()) {
+#ifndef _WIN32
+        if (opts.binary_input)
+            p_reader = MappedReader::open(opts.input_file, nin);
+#endif
+        if (p_reader == NULL) {
+            in_file.open(opts.input_file.c_str(), std::ios::binary);
+            if (!in_file.is_open()) {
+                cerr << "Could not open " << opts.input_file << "!" << endl;
+                exit(1);
+            }
+        }
+    }
+
+    std::istream& in = (in_file.is_open() ? in_file : std::cin);
+    if (p_reader == NULL) {
+        if (opts.binary_input)
+            p_reader = new BinaryReader(in, nin);
+        else
+            p_reader = new TextReader(in, nin);
+    }
+
+    // Open the output
+    std::ofstream out_file;
+    if (!opts.output_file.empty()) {
+        out_file.open(opts.output_file.c_str(), std::ios::binary);
+        if (!out_file.is_open()) {
+            cerr << "Could not open " << opts.output_file << "!" << endl;
+            exit(1);
+        }
+    }
+
+    std::ostream& out = (out_file.is_open() ? out_file : cout);
+    out.precision(opts.precision);
+
+    if (opts.header && !opts.binary_output) {
+        for (int i = 0; i < nout; ++i)
+            out << (i > 0 ? "," : "") << p_props->valueName(i);
+        out << '\n';
+    }
+
+    // Each thread evaluates states with its own mixture
+#ifdef _OPENMP
+    const int nthreads = std::max(1, omp_get_max_threads());
+#else
+    const int nthreads = 1;
+#endif
+    std::vector<Mutation::Mixture*> mixtures(1, &mix);
+    for (int i = 1; i < nthreads; ++i)
+        mixtures.push_back(new Mutation::Mixture(*opts.p_mixture_opts));
+    delete opts.p_mixture_opts;
+
+    std::vector<double> results(std::size_t(CHUNK_STATES)*nout);
+
+    const std::chrono::steady_clock::time_point start =
+        std::chrono::steady_clock::now();
+    std::size_t nstates = 0, nfailed = 0;
+
+    int n;
+    const double* p_states;
+    while ((p_states = p_reader->next(CHUNK_STATES, n)), n > 0) {
+        // Each thread evaluates a contiguous block of the chunk
+#ifdef _OPENMP
+        #pragma omp parallel num_threads(nthreads) reduction(+:nfailed)
+#endif
+        {
+#ifdef _OPENMP
+            const int thread = omp_get_thread_num();
+            const int nt = omp_get_num_threads();
+#else
+            const int thread = 0;
+            const int nt = 1;
+#endif
+            const int first = std::size_t(n)*thread / nt;
+            const int last  = std::size_t(n)*(thread+1) / nt;
+            nfailed += p_props->evaluate(
+                *mixtures[thread], p_states + std::size_t(first)*nin,
+                last - first, opts.vars,
+                results.data() + std::size_t(first)*nout);
+        }
+
+        // Write the results in the order of the input
+        if (opts.binary_output) {
+            out.write(
+                reinterpret_cast<const char*>(results.data()),
+                std::size_t(n)*nout*sizeof(double));
+        } else {
+            for (int k = 0; k < n; ++k) {
+                const double* const p_row =
+                    results.data() + std::size_t(k)*nout;
+                for (int i = 0; i < nout; ++i) {
+                    if (i > 0)
+                        out << ',';
+                    out << p_row[i];
+                }
+                out << '\n';
+            }
+        }
+
+        nstates += n;
+    }
+
+    out.flush();
+
+    const double seconds = std::chrono::duration<double>(
+        std::chrono::steady_clock::now() - start).count();
+
+    if (opts.verbose) {
+        cerr << "Evaluated " << nstates << " states in " << seconds << " s ("
+             << (seconds > 0.0 ? nstates / seconds : 0.0) << " states/s, "
+             << nthreads << (nthreads > 1 ? " threads" : " thread") << ")"
+             << endl;
+    }
+
+    if (nfailed > 0)
+        cerr << "Warning: " << nfailed << " states could not be set and were "
+             << "given NaN values." << endl;
+
+    // Clean up storage
+    delete p_reader;
+    delete p_props;
+    for (int i = 1; i < nthreads; ++i)
+        delete mixtures[i];
+
+    return 0;
+}
@@ -31,6 +31,7 @@
 #include <iomanip>
 #include <sstream>
 #include <cstdlib>
+#include <vector>
 
 #include <eigen3/Eigen/Dense>
 using namespace Eigen;
@@ -39,6 +40,10 @@ using namespace Eigen;
 #include <fenv.h>
 #endif
 
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
 using std::cout;
 using std::endl;
 using std::setw;
@@ -48,6 +53,9 @@ using namespace Mutation::Utilities;
 
 #define COLUMN_WIDTH 14
 
+// Number of grid points evaluated between writes to the output
+#define CHUNK_POINTS 4096
+
 // Defines a value that can be printed
 struct OutputQuantity {
     std::string name;
@@ -188,6 +196,8 @@ typedef struct {
 
     bool use_scientific;
     int  precision;
+
+    std::string binary_file;
 } Options;
 
 // Checks if an option is present
@@ -237,6 +247,7 @@ void printHelpMessage(const char* const name)
     cout << tab << "    --elem-comp     set elemental composition with a name from the mixture file" << endl;
     cout << tab << "    --thermo-db     overrides thermodynamic database type (NASA-7, NASA-9, RRHO)" << endl;
     cout << tab << "    --scientific    outputs in scientific format with given precision" << endl;
+    cout << tab << "    --binary        writes the values to this file as binary columns with a JSON header" << endl;
     //cout << tab << "-c             element fractions (ie: \"N:0.79,O:0.21\")" << endl;
     cout << endl;
     cout << "Mixture values (example format: \"1-3,7,9-11\"):" << endl;
@@ -281,6 +292,7 @@ void printHelpMessage(const char* const name)
     cout << endl;
     cout << "Example:" << endl;
     cout << tab << name << " -T 300:100:15000 -P 101325 -m 1-3,8 air11" << endl;
+    cout << tab << name << " -T 300:1:15000 -P 100:100:101325 -s 0,3 --binary air11.bin air11" << endl;
     cout << endl;
 
     exit(0);
@@ -497,15 +509,26 @@ Options parseOptions(int argc, char** argv)
         opts.precision      = 0;
     }
 
-    // If
+    // Write the values to a binary file instead of the console
+    if (optionExists(argc, argv, "--binary"))
+        opts.binary_file = getOption(argc, argv, "--binary");
 
     return opts;
 }
 
-// Write out the column headers
-void writeHeader(
+// Adds a column to the output, wide enough for its name
+void addColumn(
+    const std::string& name, int width, std::vector<std::string>& names,
+    std::vector<int>& widths)
+{
+    names.push_back(name);
+    widths.push_back(std::max(width, static_cast<int>(name.length())+2));
+}
+
+// Determines the column names and widths of the output
+void getColumns(
     const Options& opts, const Mutation::Mixture& mix,
-    std::vector<int>& column_widths)
+    std::vector<std::string>& names, std::vector<int>& widths)
 {
     std::string name;
     int width = (opts.use_scientific ? opts.precision + 8 : COLUMN_WIDTH);
@@ -515,10 +538,7 @@ void writeHeader(
         name = mixture_quantities[*iter].name +
             (mixture_quantities[*iter].units == "" ?
                 "" : "[" + mixture_quantities[*iter].units + "]");
-        column_widths.push_back(
-            std::max(width, static_cast<int>(name.length())+2));
-        if (opts.header)
-            cout << setw(column_widths.back()) << name;
+        addColumn(name, width, names, widths);
     }
 
     iter = opts.species_indices.begin();
@@ -527,10 +547,7 @@ void writeHeader(
             name = "\"" + species_quantities[*iter].name + "_" + mix.speciesName(i) +
                 (species_quantities[*iter].units == "" ?
                     "" : "[" + species_quantities[*iter].units + "]") + "\"";
-            column_widths.push_back(
-                std::max(width, static_cast<int>(name.length())+2));
-            if (opts.header)
-                cout << setw(column_widths.back()) << name;
+            addColumn(name, width, names, widths);
         }
     }
 
@@ -542,10 +559,7 @@ void writeHeader(
             name = reaction_quantities[*iter].name + "_" + buff +
                 (reaction_quantities[*iter].units == "" ?
                     "" : "[" + reaction_quantities[*iter].units + "]");
-            column_widths.push_back(
-                std::max(width, static_cast<int>(name.length())+2));
-            if (opts.header)
-                cout << setw(column_widths.back()) << name;
+            addColumn(name, width, names, widths);
         }
     }
 
@@ -556,54 +570,35 @@ void writeHeader(
                 for (int j = 0; j < mix.nSpecies(); ++j) {
                     name = "D_{" + mix.speciesName(i) + "," + mix.speciesName(j)
                         + "}";
-                    column_widths.push_back(
-                        std::max(width, static_cast<int>(name.length())+2));
-                    if (opts.header)
-                        cout << setw(column_widths.back()) << name;
+                    addColumn(name, width, names, widths);
                 }
             }
         } else if (other_quantities[*iter].name == "pi_i") {
             for (int i = 0; i < mix.nElements(); ++i) {
                 name = "pi_" + mix.elementName(i);
-                column_widths.push_back(
-                    std::max(width, static_cast<int>(name.length())+2));
-                if (opts.header)
-                    cout << setw(column_widths.back()) << name;
+                addColumn(name, width, names, widths);
             }
         } else if (other_quantities[*iter].name == "N_p") {
             for (int i = 0; i < mix.nPhases(); ++i) {
                 std::stringstream ss;
                 ss << "N_p" << i; ss >> name;
-                column_widths.push_back(
-                    std::max(width, static_cast<int>(name.length())+2));
-                if (opts.header)
-                    cout << setw(column_widths.back()) << name;
+                addColumn(name, width, names, widths);
             }
         } else if (other_quantities[*iter].name == "iters") {
-            column_widths.push_back(width);
-            if (opts.header)
-                cout << setw(column_widths.back()) << "iters";
+            addColumn("iters", width, names, widths);
         } else if (other_quantities[*iter].name == "newts") {
-            column_widths.push_back(width);
-            if (opts.header)
-                cout << setw(column_widths.back()) << "newts";
+            addColumn("newts", width, names, widths);
         } else if (other_quantities[*iter].name == "Fp_k") {
             for (int i = 0; i < mix.nElements(); ++i) {
                 std::stringstream ss;
                 ss << "Fp_" << mix.elementName(i) << "[kg/m-Pa-s]"; ss >> name;
-                column_widths.push_back(
-                    std::max(width, static_cast<int>(name.length())+2));
-                if (opts.header)
-                    cout << setw(column_widths.back()) << name;
+                addColumn(name, width, names, widths);
             }
         } else if (other_quantities[*iter].name == "Ft_k") {
             for (int i = 0; i < mix.nElements(); ++i) {
                 std::stringstream ss;
                 ss << "Ft_" << mix.elementName(i) << "[kg/m-K-s]"; ss >> name;
-                column_widths.push_back(
-                    std::max(width, static_cast<int>(name.length())+2));
-                if (opts.header)
-                    cout << setw(column_widths.back()) << name;
+                addColumn(name, width, names, widths);
             }
         } else if (other_quantities[*iter].name == "Fz_k") {
             for (int l = 0; l < mix.nElements(); ++l) {
@@ -611,39 +606,434 @@ void writeHeader(
                     std::stringstream ss;
                     ss << "F(" << mix.elementName(l) << ")_" <<
                        mix.elementName(k) << "[kg/m-s]"; ss >> name;
-                    column_widths.push_back(
-                        std::max(width, static_cast<int>(name.length())+2));
-                    if (opts.header)
-                        cout << setw(column_widths.back()) << name;
+                    addColumn(name, width, names, widths);
                 }
             }
         } else if (other_quantities[*iter].name == "sigmaB") {
-            column_widths.push_back(std::max(width, 10));
-            if (opts.header)
-                cout << setw(column_widths.back()) << "sig_par";
-            column_widths.push_back(std::max(width, 10));
-            if (opts.header)
-                cout << setw(column_widths.back()) << "sig_perp";
-            column_widths.push_back(std::max(width, 10));
-            if (opts.header)
-                cout << setw(column_widths.back()) << "sig_tran";
+            addColumn("sig_par", width, names, widths);
+            addColumn("sig_perp", width, names, widths);
+            addColumn("sig_tran", width, names, widths);
         } else if (other_quantities[*iter].name == "lamB_e") {
-            column_widths.push_back(std::max(width, 10));
-            if (opts.header)
-                cout << setw(column_widths.back()) << "lamB_par";
-            column_widths.push_back(std::max(width, 10));
-            if (opts.header)
-                cout << setw(column_widths.back()) << "lamB_perp";
-            column_widths.push_back(std::max(width, 10));
-            if (opts.header)
-                cout << setw(column_widths.back()) << "lamB_tran";
+            addColumn("lamB_par", width, names, widths);
+            addColumn("lamB_perp", width, names, widths);
+            addColumn("lamB_tran", width, names, widths);
+        }
+    }
+}
+
+// Scratch storage for the evaluation of the output values
+struct Workspace {
+    std::vector<double> species_values;
+    std::vector<double> reaction_values;
+    std::vector<double> temp;
+    std::vector<double> temp2;
+
+    Workspace(const Mutation::Mixture& mix) :
+        species_values(mix.nSpecies()),
+        reaction_values(mix.nReactions()),
+        temp(std::max(mix.nSpecies(), mix.nElements()*mix.nElements())),
+        temp2(mix.nSpecies())
+    { }
+};
+
+// Computes the equilibrium state at (T, P) and evaluates every output column
+void computeValues(
+    const Options& opts, Mutation::Mixture& mix, double T, double P,
+    Workspace& ws, double* const p_values)
+{
+    std::vector<int>::const_iterator iter;
+    std::string name, units;
+    double value;
+    int cw = 0;
+
+    // Compute the equilibrium composition
+    mix.setState(&P, &T, 1);
+
+    // Mixture properties
+    iter = opts.mixture_indices.begin();
+    for ( ; iter < opts.mixture_indices.end(); ++iter) {
+        name  = mixture_quantities[*iter].name;
+        units = mixture_quantities[*iter].units;
+
+        if (name == "Th")
+            value = mix.T();
+        else if (name == "P")
+            value = mix.P();
+        else if (name == "B")
+            value = mix.getBField();
+        else if (name == "rho")
+            value = mix.density();
+        else if (name == "nd")
+            value = mix.numberDensity();
+        else if (name == "Mw")
+            value = mix.mixtureMw();
+        else if (name == "H") {
+            if (units == "J/mol")
+                value = mix.mixtureHMole();
+            else if (units == "J/kg")
+                value = mix.mixtureHMass();
+        } else if (name == "H-H0") {
+            value = mix.mixtureHMinusH0Mass();
+        } else if (name == "S") {
+            if (units == "J/mol-K")
+                value = mix.mixtureSMole();
+            else if (units == "J/kg-K")
+                value = mix.mixtureSMass();
+        } else if (name == "Cp") {
+            if (units == "J/mol-K")
+                value = mix.mixtureFrozenCpMole();
+            else if (units == "J/kg-K")
+                value = mix.mixtureFrozenCpMass();
+        } else if (name == "Cp_eq") {
+            if (units == "J/mol-K")
+                value = mix.mixtureEquilibriumCpMole();
+            else if (units == "J/kg-K")
+                value = mix.mixtureEquilibriumCpMass();
+        } else if (name == "Cv") {
+            if (units == "J/mol-K")
+                value = mix.mixtureFrozenCvMole();
+            else if (units == "J/kg-K")
+                value = mix.mixtureFrozenCvMass();
+        } else if (name == "Cv_eq") {
+            value = mix.mixtureEquilibriumCvMass();
+        } else if (name == "gam_eq")
+            value = mix.mixtureEquilibriumGamma();
+        else if (name == "gamma")
+            value = mix.mixtureFrozenGamma();
+        else if (name == "mu")
+            value = mix.viscosity();
+        else if (name == "lambda")
+            value = mix.equilibriumThermalConductivity();
+        else if (name == "lam_reac")
+            value = mix.reactiveThermalConductivity();
+        else if (name == "lam_bb")
+            value = mix.butlerBrokawThermalConductivity();
+        else if (name == "lam_soret")
+            value = mix.soretThermalConductivity();
+        else if (name == "lam_int")
+            value = mix.internalThermalConductivity(T);
+        else if (name == "lam_h")
+            value = mix.heavyThermalConductivity();
+        else if (name == "lam_e")
+            value = mix.electronThermalConductivity();
+        else if (name == "sigma")
+            value = mix.electricConductivity();
+//                else if (name == "sigma_para")
+//                    value = mix.sigmaParallel();
+//                else if (name == "sigma_perp")
+//                    value = mix.sigmaPerpendicular();
+//                else if (name == "sigma_trans")
+//                    value = mix.sigmaTransverse();
+        else if (name == "Ht") {
+            mix.speciesHOverRT(ws.temp.data(), ws.species_values.data());
+            value = 0.0;
+            for (int i = 0; i < mix.nSpecies(); ++i)
+                value += ws.species_values[i] * RU * T * mix.X()[i];
+            if (units == "J/kg")
+                value /= mix.mixtureMw();
+        } else if (name == "Hr") {
+            mix.speciesHOverRT(ws.temp.data(), NULL, ws.species_values.data());
+            value = 0.0;
+            for (int i = 0; i < mix.nSpecies(); ++i)
+                value += ws.species_values[i] * RU * T * mix.X()[i];
+            if (units == "J/kg")
+                value /= mix.mixtureMw();
+        } else if (name == "Hv") {
+            mix.speciesHOverRT(ws.temp.data(), NULL, NULL, ws.species_values.data());
+            value = 0.0;
+            for (int i = 0; i < mix.nSpecies(); ++i)
+                value += ws.species_values[i] * RU * T * mix.X()[i];
+            if (units == "J/kg")
+                value /= mix.mixtureMw();
+        } else if (name == "Hel") {
+            mix.speciesHOverRT(ws.temp.data(), NULL, NULL, NULL, ws.species_values.data());
+            value = 0.0;
+            for (int i = 0; i < mix.nSpecies(); ++i)
+                value += ws.species_values[i] * RU * T * mix.X()[i];
+            if (units == "J/kg")
+                value /= mix.mixtureMw();
+        } else if (name == "Hf") {
+            mix.speciesHOverRT(
+                ws.temp.data(), NULL, NULL, NULL, NULL, ws.species_values.data());
+            value = 0.0;
+            for (int i = 0; i < mix.nSpecies(); ++i)
+                value += ws.species_values[i] * RU * T * mix.X()[i];
+            if (units == "J/kg")
+                value /= mix.mixtureMw();
+        } else if (name == "e") {
+            if (units == "J/mol")
+                value = mix.mixtureEnergyMole();
+            else if (units == "J/kg")
+                value = mix.mixtureEnergyMass();
+        } else if (name == "a_f")
+            value = mix.frozenSoundSpeed();
+        else if (name == "a_eq")
+            value = mix.equilibriumSoundSpeed();
+        else if (name == "Eam") {
+            mix.dXidT(ws.temp.data());
+            mix.stefanMaxwell(ws.temp.data(), ws.temp2.data(), value);
+        } else if (name == "drho/dP")
+            value = mix.dRhodP();
+//                else if (name == "l")
+//                    value = mix.meanFreePath();
+//                else if (name == "le")
+//                    value = mix.electronMeanFreePath();
+//                else if (name == "Vh")
+//                    value = mix.averageHeavyThermalSpeed();
+//                else if (name == "Ve")
+//                    value = mix.electronThermalSpeed();
+//                else if (name == "tau_eh")
+//                    value = mix.electronHeavyCollisionFreq();
+//                else if (name == "tau_a")
+//                    value = mix.averageHeavyCollisionFreq();
+
+        p_values[cw++] = value;
+    }
+
+    // Species properties
+    iter = opts.species_indices.begin();
+    for ( ; iter < opts.species_indices.end(); ++iter) {
+        name  = species_quantities[*iter].name;
+        units = species_quantities[*iter].units;
+
+        if (name == "X")
+            std::copy(mix.X(), mix.X()+mix.nSpecies(), ws.species_values.data());
+        else if (name == "dX/dT")
+            mix.dXidT(ws.species_values.data());
+        else if (name == "Y")
+            std::copy(mix.Y(), mix.Y()+mix.nSpecies(), ws.species_values.data());
+        else if (name == "rho") {
+            std::copy(mix.Y(), mix.Y()+mix.nSpecies(), ws.species_values.data());
+            for (int i = 0; i < mix.nSpecies(); ++i)
+                ws.species_values[i] *= mix.density();
+        } else if (name == "conc") {
+            double conc = mix.density() / mix.mixtureMw();
+            for (int i = 0; i < mix.nSpecies(); ++i)
+                ws.species_values[i] = mix.X()[i] * conc;
+        } else if (name == "Cp") {
+            mix.speciesCpOverR(ws.species_values.data());
+            if (units == "J/mol-K")
+                for (int i = 0; i < mix.nSpecies(); ++i)
+                    ws.species_values[i] *= RU;
+            else if (units == "J/kg-K")
+                for (int i = 0; i < mix.nSpecies(); ++i)
+                    ws.species_values[i] *= (RU / mix.speciesMw(i));
+        } else if (name == "H") {
+            mix.speciesHOverRT(ws.species_values.data());
+            if (units == "J/mol")
+                for (int i = 0; i < mix.nSpecies(); ++i)
+                    ws.species_values[i] *= (RU * T);
+            else if (units == "J/kg")
+                for (int i = 0; i < mix.nSpecies(); ++i)
+                    ws.species_values[i] *= (RU * T / mix.speciesMw(i));
+        } else if (name == "S") {
+            mix.speciesSOverR(ws.species_values.data());
+            if (units == "J/mol-K")
+                for (int i = 0; i < mix.nSpecies(); ++i)
+                    ws.species_values[i] *= RU;
+            else if (units == "J/kg-K")
+                for (int i = 0; i < mix.nSpecies(); ++i)
+                    ws.species_values[i] *= (RU / mix.speciesMw(i));
+        } else if (name == "G") {
+            mix.speciesGOverRT(ws.species_values.data());
+            if (units == "J/mol")
+                for (int i = 0; i < mix.nSpecies(); ++i)
+                    ws.species_values[i] *= (RU * T);
+            else if (units == "J/kg")
+                for (int i = 0; i < mix.nSpecies(); ++i)
+                    ws.species_values[i] *= (RU * T / mix.speciesMw(i));
+        } else if (name == "J") {
+            double E, rho;
+            mix.dXidT(ws.temp.data());
+            mix.stefanMaxwell(ws.temp.data(), ws.species_values.data(), E);
+            rho = mix.density();
+            for (int i = 0; i < mix.nSpecies(); ++i)
+                ws.species_values[i] *= rho * mix.Y()[i];
+        } else if (name == "omega") {
+            mix.netProductionRates(ws.species_values.data());
+        } else if (name == "Omega11") {
+            Map<ArrayXd>(ws.species_values.data(),mix.nSpecies()) =
+                (ArrayXd(mix.nSpecies()) << mix.collisionDB().Q11ee(),mix.collisionDB().Q11ii()).finished();
+        } else if (name == "Omega22") {
+            Map<ArrayXd>(ws.species_values.data(),mix.nSpecies()) =
+                (ArrayXd(mix.nSpecies()) << mix.collisionDB().Q22ee(),mix.collisionDB().Q22ii()).finished();
+        } else if (name == "Chi^h") {
+            mix.heavyThermalDiffusionRatios(ws.species_values.data());
+        } else if (name == "Dm") {
+            mix.averageDiffusionCoeffs(ws.species_values.data());
+        }
+
+        for (int i = 0; i < mix.nSpecies(); ++i)
+            p_values[cw++] = ws.species_values[i];
+    }
+
+    // Reaction properties
+    iter = opts.reaction_indices.begin();
+    for ( ; iter < opts.reaction_indices.end(); ++iter) {
+        name  = reaction_quantities[*iter].name;
+
+        if (name == "kf")
+            mix.forwardRateCoefficients(ws.reaction_values.data());
+        else if (name == "kb")
+            mix.backwardRateCoefficients(ws.reaction_values.data());
+
+        for (int i = 0; i < mix.nReactions(); ++i)
+            p_values[cw++] = ws.reaction_values[i];
+    }
+
+    // Other properties
+    iter = opts.other_indices.begin();
+    for ( ; iter < opts.other_indices.end(); ++iter) {
+        name  = other_quantities[*iter].name;
+
+        if (name == "Dij") {
+            const Eigen::MatrixXd& Dij = mix.diffusionMatrix();
+            for (int i = 0; i < mix.nSpecies(); ++i)
+                for (int j = 0; j < mix.nSpecies(); ++j)
+                    p_values[cw++] = Dij(i,j);
+        } else if (name == "pi_i") {
+            mix.elementPotentials(ws.species_values.data());
+            for (int i = 0; i < mix.nElements(); ++i)
+                p_values[cw++] = ws.species_values[i];
+        } else if (name == "N_p") {
+            mix.phaseMoles(ws.species_values.data());
+            for (int i = 0; i < mix.nPhases(); ++i)
+                p_values[cw++] = ws.species_values[i];
+        } else if (name == "iters") {
+            p_values[cw++] = mix.nEquilibriumSteps();
+        } else if (name == "newts") {
+            p_values[cw++] = mix.nEquilibriumNewtons();
+        } else if (name == "Fp_k") {
+            mix.equilDiffFluxFacsP(ws.temp.data());
+            for (int i = 0; i < mix.nElements(); ++i)
+                p_values[cw++] = ws.temp[i];
+        } else if (name == "Ft_k") {
+            mix.equilDiffFluxFacsT(ws.temp.data());
+            for (int i = 0; i < mix.nElements(); ++i)
+                p_values[cw++] = ws.temp[i];
+        } else if (name == "Fz_k") {
+            mix.equilDiffFluxFacsZ(ws.temp.data());
+            for (int k = 0; k < mix.nElements()*mix.nElements(); ++k)
+                p_values[cw++] = ws.temp[k];
+        } else if (name == "sigmaB") {
+            Eigen::Vector3d sigma = mix.electricConductivityB();
+            for (int i = 0; i < 3; ++i)
+                p_values[cw++] = sigma(i);
+        } else if (name == "lamB_e") {
+            Eigen::Vector3d lambda = mix.electronThermalConductivityB();
+            for (int i = 0; i < 3; ++i)
+                p_values[cw++] = lambda(i);
         }
     }
+}
 
-    if (opts.header)
-        cout << endl;
+// Escapes a column name for the JSON header of the binary output
+std::string jsonString(const std::string& str)
+{
+    std::string quoted("\"");
+    for (int i = 0; i < str.size(); ++i) {
+        if (str[i] == '"')
+            continue;
+        if (str[i] == '\\')
+            quoted += '\\';
+        quoted += str[i];
+    }
+    return quoted + "\"";
 }
 
+/**
+ * Writes the output values to a binary file as columns of raw doubles, in the
+ * byte order of the machine.  The file starts with a JSON header which
+ * describes the grid and the columns, padded with spaces to a multiple of 64
+ * bytes and ended by a newline.  The values of column c at the grid points
+ * follow, starting at data_offset + 8*c*rows bytes.  The grid points are
+ * ordered with the temperature varying fastest, as in the text output.
+ */
+class BinaryWriter
+{
+public:
+
+    BinaryWriter(
+        const std::string& file_name, const Mutation::Mixture& mix,
+        const std::vector<std::string>& names, const std::vector<double>& T,
+        const std::vector<double>& P) :
+        m_file(file_name.c_str(), std::ios::binary), m_nc(names.size()),
+        m_rows(T.size()*P.size())
+    {
+        if (!m_file.is_open()) {
+            cout << "Could not open " << file_name << " for writing!" << endl;
+            exit(1);
+        }
+
+        // The size of the header depends on the offset it contains
+        std::string header;
+        m_offset = 0;
+        while (true) {
+            header = jsonHeader(mix, names, T, P);
+            const std::size_t offset = (header.size() / 64 + 1) * 64;
+            if (offset == m_offset)
+                break;
+            m_offset = offset;
+        }
+
+        header.resize(m_offset - 1, ' ');
+        header += '\n';
+        m_file.write(header.c_str(), header.size());
+    }
+
+    /**
+     * Writes the n rows of values in p_rows starting at the given grid point.
+     */
+    void write(int start, int n, const double* const p_rows)
+    {
+        m_column.resize(n);
+        for (int c = 0; c < m_nc; ++c) {
+            for (int k = 0; k < n; ++k)
+                m_column[k] = p_rows[k*m_nc + c];
+            m_file.seekp(m_offset + (std::size_t(c)*m_rows + start)*8);
+            m_file.write(
+                reinterpret_cast<const char*>(m_column.data()), n*8);
+        }
+    }
+
+private:
+
+    std::string jsonHeader(
+        const Mutation::Mixture& mix, const std::vector<std::string>& names,
+        const std::vector<double>& T, const std::vector<double>& P) const
+    {
+        const int one = 1;
+        const bool little = *reinterpret_cast<const char*>(&one) == 1;
+
+        std::stringstream ss;
+        ss.precision(17);
+        ss << "{\"format\": \"mppequil\", \"version\": 1, "
+           << "\"dtype\": \"" << (little ? "<f8" : ">f8") << "\", "
+           << "\"layout\": \"columns\", \"rows\": " << m_rows << ", "
+           << "\"data_offset\": " << m_offset << ", \"grid\": {"
+           << "\"order\": [\"P\", \"T\"], \"T\": [";
+        for (int i = 0; i < T.size(); ++i)
+            ss << (i > 0 ? ", " : "") << T[i];
+        ss << "], \"P\": [";
+        for (int i = 0; i < P.size(); ++i)
+            ss << (i > 0 ? ", " : "") << P[i];
+        ss << "]}, \"species\": [";
+        for (int i = 0; i < mix.nSpecies(); ++i)
+            ss << (i > 0 ? ", " : "") << jsonString(mix.speciesName(i));
+        ss << "], \"columns\": [";
+        for (int i = 0; i < names.size(); ++i)
+            ss << (i > 0 ? ", " : "") << jsonString(names[i]);
+        ss << "]}";
+
+        return ss.str();
+    }
+
+    std::ofstream m_file;
+    std::size_t m_offset;
+    const int m_nc;
+    const std::size_t m_rows;
+    std::vector<double> m_column;
+};
 
 /**
  * @page mppequil Mutation++ Equilibrium Properties (mppequil)
@@ -657,7 +1047,10 @@ void writeHeader(
  *
  *     mppequil -h
  *
- * for a full list of options.
+ * for a full list of options.  The grid points are evaluated in parallel when
+ * Mutation++ is built with `ENABLE_OPENMP`.  With `--binary file`, the values
+ * are written to the file as columns of raw doubles following a JSON header
+ * which describes the grid and the columns, instead of being printed.
  */
 
 
@@ -672,374 +1065,94 @@ int main(int argc, char** argv)
     Options opts = parseOptions(argc, argv);
     Mutation::Mixture mix(*opts.p_mixture_opts);
     mix.setBField(opts.B);
-    delete opts.p_mixture_opts;
 
-    // Write out the column headers (and compute the column sizes)
+    // Determine the output columns
+    std::vector<std::string> names;
     std::vector<int> column_widths;
-    writeHeader(opts, mix, column_widths);
-
-    // Now we can actually perform the computations
-    std::vector<int>::const_iterator iter;
-    double value;
-    int cw;
-    std::string name, units;
-
-    double* species_values = new double [mix.nSpecies()];
-    double* temp           = new double [
-		std::max(mix.nSpecies(), mix.nElements()*mix.nElements())];
-    double* sjac_exact     = new double [mix.nSpecies()*mix.nSpecies()];
-    double* sjac_fd        = new double [mix.nSpecies()*mix.nSpecies()];
-    double* temp2          = new double [mix.nSpecies()];
-    double* reaction_values = new double [mix.nReactions()];
-
-    /*ofstream jac_file("jac.dat");
-
-    for (int i = 0; i < mix.nSpecies(); ++i)
-        jac_file << setw(15) << mix.speciesName(i);
-    jac_file << endl;*/
-
-    if (opts.use_scientific) {
-        cout.precision(opts.precision);
-        cout << std::scientific;
+    getColumns(opts, mix, names, column_widths);
+    const int nc = names.size();
+
+    // Grid points, with the temperature varying fastest
+    std::vector<double> Ts, Ps;
+    for (double P = opts.P1; P <= opts.P2; P += opts.dP)
+        Ps.push_back(P);
+    for (double T = opts.T1; T <= opts.T2; T += opts.dT)
+        Ts.push_back(T);
+    const int nt = Ts.size();
+    const int npoints = nt*Ps.size();
+
+    // Each thread evaluates grid points with its own mixture
+#ifdef _OPENMP
+    const int nthreads = std::max(1, std::min(omp_get_max_threads(), npoints));
+#else
+    const int nthreads = 1;
+#endif
+    std::vector<Mutation::Mixture*> mixtures(1, &mix);
+    for (int i = 1; i < nthreads; ++i) {
+        mixtures.push_back(new Mutation::Mixture(*opts.p_mixture_opts));
+        mixtures.back()->setBField(opts.B);
     }
+    delete opts.p_mixture_opts;
 
-    for (double P = opts.P1; P <= opts.P2; P += opts.dP) {
-        for (double T = opts.T1; T <= opts.T2; T += opts.dT) {
-            // Compute the equilibrium composition
-            mix.setState(&P, &T, 1);
-            cw = 0;
-
-            // Mixture properties
-            iter = opts.mixture_indices.begin();
-            for ( ; iter < opts.mixture_indices.end(); ++iter) {
-                name  = mixture_quantities[*iter].name;
-                units = mixture_quantities[*iter].units;
-
-                if (name == "Th")
-                    value = mix.T();
-                else if (name == "P")
-                    value = mix.P();
-                else if (name == "B")
-                    value = mix.getBField();
-                else if (name == "rho")
-                    value = mix.density();
-                else if (name == "nd")
-                    value = mix.numberDensity();
-                else if (name == "Mw")
-                    value = mix.mixtureMw();
-                else if (name == "H") {
-                    if (units == "J/mol")
-                        value = mix.mixtureHMole();
-                    else if (units == "J/kg")
-                        value = mix.mixtureHMass();
-                } else if (name == "H-H0") {
-                    value = mix.mixtureHMinusH0Mass();
-                } else if (name == "S") {
-                    if (units == "J/mol-K")
-                        value = mix.mixtureSMole();
-                    else if (units == "J/kg-K")
-                        value = mix.mixtureSMass();
-                } else if (name == "Cp") {
-                    if (units == "J/mol-K")
-                        value = mix.mixtureFrozenCpMole();
-                    else if (units == "J/kg-K")
-                        value = mix.mixtureFrozenCpMass();
-                } else if (name == "Cp_eq") {
-                    if (units == "J/mol-K")
-                        value = mix.mixtureEquilibriumCpMole();
-                    else if (units == "J/kg-K")
-                        value = mix.mixtureEquilibriumCpMass();
-                } else if (name == "Cv") {
-                    if (units == "J/mol-K")
-                        value = mix.mixtureFrozenCvMole();
-                    else if (units == "J/kg-K")
-                        value = mix.mixtureFrozenCvMass();
-                } else if (name == "Cv_eq") {
-                    value = mix.mixtureEquilibriumCvMass();
-                } else if (name == "gam_eq")
-                    value = mix.mixtureEquilibriumGamma();
-                else if (name == "gamma")
-                    value = mix.mixtureFrozenGamma();
-                else if (name == "mu")
-                    value = mix.viscosity();
-                else if (name == "lambda")
-                    value = mix.equilibriumThermalConductivity();
-                else if (name == "lam_reac")
-                    value = mix.reactiveThermalConductivity();
-                else if (name == "lam_bb")
-                    value = mix.butlerBrokawThermalConductivity();
-                else if (name == "lam_soret")
-                    value = mix.soretThermalConductivity();
-                else if (name == "lam_int")
-                    value = mix.internalThermalConductivity(T);
-                else if (name == "lam_h")
-                    value = mix.heavyThermalConductivity();
-                else if (name == "lam_e")
-                    value = mix.electronThermalConductivity();
-                else if (name == "sigma")
-                    value = mix.electricConductivity();
-//                else if (name == "sigma_para")
-//                    value = mix.sigmaParallel();
-//                else if (name == "sigma_perp")
-//                    value = mix.sigmaPerpendicular();
-//                else if (name == "sigma_trans")
-//                    value = mix.sigmaTransverse();
-                else if (name == "Ht") {
-                    mix.speciesHOverRT(temp, species_values);
-                    value = 0.0;
-                    for (int i = 0; i < mix.nSpecies(); ++i)
-                        value += species_values[i] * RU * T * mix.X()[i];
-                    if (units == "J/kg")
-                        value /= mix.mixtureMw();
-                } else if (name == "Hr") {
-                    mix.speciesHOverRT(temp, NULL, species_values);
-                    value = 0.0;
-                    for (int i = 0; i < mix.nSpecies(); ++i)
-                        value += species_values[i] * RU * T * mix.X()[i];
-                    if (units == "J/kg")
-                        value /= mix.mixtureMw();
-                } else if (name == "Hv") {
-                    mix.speciesHOverRT(temp, NULL, NULL, species_values);
-                    value = 0.0;
-                    for (int i = 0; i < mix.nSpecies(); ++i)
-                        value += species_values[i] * RU * T * mix.X()[i];
-                    if (units == "J/kg")
-                        value /= mix.mixtureMw();
-                } else if (name == "Hel") {
-                    mix.speciesHOverRT(temp, NULL, NULL, NULL, species_values);
-                    value = 0.0;
-                    for (int i = 0; i < mix.nSpecies(); ++i)
-                        value += species_values[i] * RU * T * mix.X()[i];
-                    if (units == "J/kg")
-                        value /= mix.mixtureMw();
-                } else if (name == "Hf") {
-                    mix.speciesHOverRT(
-                        temp, NULL, NULL, NULL, NULL, species_values);
-                    value = 0.0;
-                    for (int i = 0; i < mix.nSpecies(); ++i)
-                        value += species_values[i] * RU * T * mix.X()[i];
-                    if (units == "J/kg")
-                        value /= mix.mixtureMw();
-                } else if (name == "e") {
-                    if (units == "J/mol")
-                        value = mix.mixtureEnergyMole();
-                    else if (units == "J/kg")
-                        value = mix.mixtureEnergyMass();
-                } else if (name == "a_f")
-                    value = mix.frozenSoundSpeed();
-                else if (name == "a_eq")
-                    value = mix.equilibriumSoundSpeed();
-                else if (name == "Eam") {
-                    mix.dXidT(temp);
-                    mix.stefanMaxwell(temp, temp2, value);
-                } else if (name == "drho/dP")
-                    value = mix.dRhodP();
-//                else if (name == "l")
-//                    value = mix.meanFreePath();
-//                else if (name == "le")
-//                    value = mix.electronMeanFreePath();
-//                else if (name == "Vh")
-//                    value = mix.averageHeavyThermalSpeed();
-//                else if (name == "Ve")
-//                    value = mix.electronThermalSpeed();
-//                else if (name == "tau_eh")
-//                    value = mix.electronHeavyCollisionFreq();
-//                else if (name == "tau_a")
-//                    value = mix.averageHeavyCollisionFreq();
-
-                cout << setw(column_widths[cw++]) << value;
-            }
+    std::vector<Workspace> workspaces(nthreads, Workspace(mix));
 
-            // Species properties
-            iter = opts.species_indices.begin();
-            for ( ; iter < opts.species_indices.end(); ++iter) {
-                name  = species_quantities[*iter].name;
-                units = species_quantities[*iter].units;
-
-                if (name == "X")
-                    std::copy(mix.X(), mix.X()+mix.nSpecies(), species_values);
-                else if (name == "dX/dT")
-                    mix.dXidT(species_values);
-                else if (name == "Y")
-                    std::copy(mix.Y(), mix.Y()+mix.nSpecies(), species_values);
-                else if (name == "rho") {
-                    std::copy(mix.Y(), mix.Y()+mix.nSpecies(), species_values);
-                    for (int i = 0; i < mix.nSpecies(); ++i)
-                        species_values[i] *= mix.density();
-                } else if (name == "conc") {
-                    double conc = mix.density() / mix.mixtureMw();
-                    for (int i = 0; i < mix.nSpecies(); ++i)
-                        species_values[i] = mix.X()[i] * conc;
-                } else if (name == "Cp") {
-                    mix.speciesCpOverR(species_values);
-                    if (units == "J/mol-K")
-                        for (int i = 0; i < mix.nSpecies(); ++i)
-                            species_values[i] *= RU;
-                    else if (units == "J/kg-K")
-                        for (int i = 0; i < mix.nSpecies(); ++i)
-                            species_values[i] *= (RU / mix.speciesMw(i));
-                } else if (name == "H") {
-                    mix.speciesHOverRT(species_values);
-                    if (units == "J/mol")
-                        for (int i = 0; i < mix.nSpecies(); ++i)
-                            species_values[i] *= (RU * T);
-                    else if (units == "J/kg")
-                        for (int i = 0; i < mix.nSpecies(); ++i)
-                            species_values[i] *= (RU * T / mix.speciesMw(i));
-                } else if (name == "S") {
-                    mix.speciesSOverR(species_values);
-                    if (units == "J/mol-K")
-                        for (int i = 0; i < mix.nSpecies(); ++i)
-                            species_values[i] *= RU;
-                    else if (units == "J/kg-K")
-                        for (int i = 0; i < mix.nSpecies(); ++i)
-                            species_values[i] *= (RU / mix.speciesMw(i));
-                } else if (name == "G") {
-                    mix.speciesGOverRT(species_values);
-                    if (units == "J/mol")
-                        for (int i = 0; i < mix.nSpecies(); ++i)
-                            species_values[i] *= (RU * T);
-                    else if (units == "J/kg")
-                        for (int i = 0; i < mix.nSpecies(); ++i)
-                            species_values[i] *= (RU * T / mix.speciesMw(i));
-                } else if (name == "J") {
-                    double E, rho;
-                    mix.dXidT(temp);
-                    mix.stefanMaxwell(temp, species_values, E);
-                    rho = mix.density();
-                    for (int i = 0; i < mix.nSpecies(); ++i)
-                        species_values[i] *= rho * mix.Y()[i];
-                } else if (name == "omega") {
-                    mix.netProductionRates(species_values);
-                } else if (name == "Omega11") {
-                    Map<ArrayXd>(species_values,mix.nSpecies()) =
-                        (ArrayXd(mix.nSpecies()) << mix.collisionDB().Q11ee(),mix.collisionDB().Q11ii()).finished();
-                } else if (name == "Omega22") {
-                    Map<ArrayXd>(species_values,mix.nSpecies()) =
-                        (ArrayXd(mix.nSpecies()) << mix.collisionDB().Q22ee(),mix.collisionDB().Q22ii()).finished();
-                } else if (name == "Chi^h") {
-                    mix.heavyThermalDiffusionRatios(species_values);
-                } else if (name == "Dm") {
-                    mix.averageDiffusionCoeffs(species_values);
-                }
-
-                for (int i = 0; i < mix.nSpecies(); ++i)
-                    cout << setw(column_widths[cw++]) << species_values[i];
-            }
-
-            // Reaction properties
-            iter = opts.reaction_indices.begin();
-            for ( ; iter < opts.reaction_indices.end(); ++iter) {
-                name  = reaction_quantities[*iter].name;
+    BinaryWriter* p_writer = NULL;
+    if (!opts.binary_file.empty()) {
+        p_writer = new BinaryWriter(opts.binary_file, mix, names, Ts, Ps);
+    } else {
+        if (opts.header) {
+            for (int c = 0; c < nc; ++c)
+                cout << setw(column_widths[c]) << names[c];
+            cout << endl;
+        }
 
-                if (name == "kf")
-                    mix.forwardRateCoefficients(reaction_values);
-                else if (name == "kb")
-                    mix.backwardRateCoefficients(reaction_values);
+        if (opts.use_scientific) {
+            cout.precision(opts.precision);
+            cout << std::scientific;
+        }
+    }
 
-                for (int i = 0; i < mix.nReactions(); ++i)
-                    cout << setw(column_widths[cw++]) << reaction_values[i];
-            }
+    // The grid is evaluated in chunks so that the memory stays bounded
+    const int chunk = std::max(1, std::min(npoints, CHUNK_POINTS));
+    std::vector<double> rows(std::size_t(chunk)*nc);
 
-            // Other properties
-            iter = opts.other_indices.begin();
-            for ( ; iter < opts.other_indices.end(); ++iter) {
-                name  = other_quantities[*iter].name;
-
-                if (name == "Dij") {
-                    const Eigen::MatrixXd& Dij = mix.diffusionMatrix();
-                    for (int i = 0; i < mix.nSpecies(); ++i)
-                        for (int j = 0; j < mix.nSpecies(); ++j)
-                            cout << setw(column_widths[cw++]) << Dij(i,j);
-                } else if (name == "pi_i") {
-                    mix.elementPotentials(species_values);
-                    for (int i = 0; i < mix.nElements(); ++i)
-                        cout << setw(column_widths[cw++]) << species_values[i];
-                } else if (name == "N_p") {
-                    mix.phaseMoles(species_values);
-                    for (int i = 0; i < mix.nPhases(); ++i)
-                        cout << setw(column_widths[cw++]) << species_values[i];
-                } else if (name == "iters") {
-                    cout << setw(column_widths[cw++]) << mix.nEquilibriumSteps();
-                } else if (name == "newts") {
-                    cout << setw(column_widths[cw++]) << mix.nEquilibriumNewtons();
-                } else if (name == "Fp_k") {
-                    mix.equilDiffFluxFacsP(temp);
-                    for (int i = 0; i < mix.nElements(); ++i)
-                        cout << setw(column_widths[cw++]) << temp[i];
-                } else if (name == "Ft_k") {
-                    mix.equilDiffFluxFacsT(temp);
-                    for (int i = 0; i < mix.nElements(); ++i)
-                        cout << setw(column_widths[cw++]) << temp[i];
-                } else if (name == "Fz_k") {
-                    mix.equilDiffFluxFacsZ(temp);
-                    for (int k = 0; k < mix.nElements()*mix.nElements(); ++k)
-                        cout << setw(column_widths[cw++]) << temp[k];
-                } else if (name == "sigmaB") {
-                    Eigen::Vector3d sigma = mix.electricConductivityB();
-                    for (int i = 0; i < 3; ++i)
-                        cout << setw(column_widths[cw++]) << sigma(i);
-                } else if (name == "lamB_e") {
-                    Eigen::Vector3d lambda = mix.electronThermalConductivityB();
-                    for (int i = 0; i < 3; ++i)
-                        cout << setw(column_widths[cw++]) << lambda(i);
-                }
-            }
+    for (int start = 0; start < npoints; start += chunk) {
+        const int n = std::min(chunk, npoints - start);
 
-            cout << endl;
+        // Static scheduling keeps the results independent of the timing, since
+        // each equilibrium solution depends slightly on the previous one
+#ifdef _OPENMP
+        #pragma omp parallel for schedule(static) num_threads(nthreads)
+#endif
+        for (int k = 0; k < n; ++k) {
+#ifdef _OPENMP
+            const int thread = omp_get_thread_num();
+#else
+            const int thread = 0;
+#endif
+            const int point = start + k;
+            computeValues(
+                opts, *mixtures[thread], Ts[point % nt], Ps[point / nt],
+                workspaces[thread], rows.data() + std::size_t(k)*nc);
+        }
 
-            // Compute the exact jacobian
-            /*double conc = mix.density() / mix.mixtureMw();
-            for (int i = 0; i < mix.nSpecies(); ++i)
-                temp[i] = mix.X()[i] * conc;
-            mix.jacobianRho(mix.T(), temp, sjac_exact);
-
-            // Now compute the finite-differenced jacobian
-            double eps = std::sqrt(Numerics::NumConst<double>::eps);
-            double delta, prev;
-            mix.netProductionRates(mix.T(), temp, species_values);
-            for (int j = 0; j < mix.nSpecies(); ++j) {
-                delta = std::max(temp[j] * eps, 1.0e-100);
-                prev = temp[j];
-                temp[j] += delta;
-                mix.netProductionRates(mix.T(), temp, temp2);
-                temp[j] = prev;
-                for (int i = 0; i < mix.nSpecies(); ++i)
-                    sjac_fd[i*mix.nSpecies()+j] = (temp2[i]-species_values[i])/
-                        (delta*mix.speciesMw(j));
-            }
+        if (p_writer != NULL) {
+            p_writer->write(start, n, rows.data());
+            continue;
+        }
 
-            double sum1 = 0.0;
-            double sum2 = 0.0;
-            double x;
-            for (int i = 0; i < mix.nSpecies(); ++i) {
-                for (int j = 0; j < mix.nSpecies(); ++j) {
-                    jac_file << setw(15)
-                             //<< (sjac_fd[i*mix.nSpecies()+j] -
-                             //       sjac_exact[i*mix.nSpecies()+j]) /
-                             //       sjac_exact[i*mix.nSpecies()+j];
-                             << sjac_exact[i*mix.nSpecies()+j];
-
-                    // Compute the Frobenius norm of the difference matrix
-                    //x = sjac_exact[i*mix.nSpecies()+j] - sjac_fd[i*mix.nSpecies()+j];
-                    //sum1 += x*x;
-                    //x = sjac_exact[i*mix.nSpecies()+j];
-                    //sum2 += x*x;
-                }
-                jac_file << endl;
-            }
-            //jac_file << setw(10) << mix.T() << setw(15) << std::sqrt(sum1/sum2);
-            jac_file << endl;*/
+        for (int k = 0; k < n; ++k) {
+            const double* const p_row = rows.data() + std::size_t(k)*nc;
+            for (int c = 0; c < nc; ++c)
+                cout << setw(column_widths[c]) << p_row[c];
+            cout << '\n';
         }
     }
 
     // Clean up storage
-    delete [] species_values;
-    delete [] temp;
-    delete [] sjac_exact;
-    delete [] sjac_fd;
-    delete [] temp2;
-    delete [] reaction_values;
+    delete p_writer;
+    for (int i = 1; i < nthreads; ++i)
+        delete mixtures[i];
 
     return 0;
 }
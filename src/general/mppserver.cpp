@@ -0,0 +1,205 @@
+/**
+ * @file mppserver.cpp
+ *
+ * @brief Utility which serves mixture properties to local client processes.
+ * @see @ref mppserver
+ */
+
+/*
+ * Copyright 2018 von Karman Institute for Fluid Dynamics (VKI)
+ *
+ * This file is part of MUlticomponent Thermodynamic And Transport
+ * properties for IONized gases in C++ (Mutation++) software package.
+ *
+ * Mutation++ is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as
+ * published by the Free Software Foundation, either version 3 of the
+ * License, or (at your option) any later version.
+ *
+ * Mutation++ is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with Mutation++.  If not, see
+ * <http://www.gnu.org/licenses/>.
+ */
+
+#include "mutation++.h"
+#include "PropertyServer.h"
+
+#include <csignal>
+#include <cstdlib>
+#include <iostream>
+#include <thread>
+#include <vector>
+
+#include <pthread.h>
+
+using std::cerr;
+using std::cout;
+using std::endl;
+
+using namespace Mutation;
+
+/**
+ * @page mppserver Mutation++ Property Server (mppserver)
+ *
+ * __Usage:__
+ *
+ * mppserver [OPTIONS] mixture [mixture ...]
+ *
+ * Loads one or more mixtures once and serves batches of property evaluations
+ * to any number of processes on the same machine, which connect to a UNIX
+ * domain socket with the PropertyClient class and select a mixture by name.
+ * The server runs until it receives SIGINT or SIGTERM.  Use
+ *
+ *     mppserver -h
+ *
+ * for a full list of options.
+ */
+
+// Simply stores the command line options
+typedef struct {
+    std::string socket_path;
+    int nworkers;
+    bool verbose;
+
+    std::vector<std::string> names;
+    std::vector<Mutation::MixtureOptions> mixture_opts;
+} Options;
+
+// Checks if an option is present
+bool optionExists(int argc, char** argv, const std::string& option)
+{
+    return (std::find(argv, argv+argc, option) != argv+argc);
+}
+
+// Returns the value associated with a particular option
+std::string getOption(int argc, char** argv, const std::string& option)
+{
+    std::string value;
+    char** ptr = std::find(argv, argv+argc, option);
+
+    if (ptr == argv+argc || ptr+1 == argv+argc)
+        value = "";
+    else
+        value = *(ptr+1);
+
+    return value;
+}
+
+// Prints the program's usage information and exits.
+void printHelpMessage(const char* const name)
+{
+    std::string tab("    ");
+
+    cout << endl;
+    cout << "Usage: " << name << " [OPTIONS] mixture [mixture ...]" << endl;
+    cout << "Serve mixture properties to local processes using the "
+         << "Mutation++ library." << endl;
+    cout << endl;
+    cout << tab << "-h, --help          prints this help message" << endl;
+    cout << tab << "-v, --verbose       reports the statistics of each client on the standard error" << endl;
+    cout << tab << "-s                  socket path (default = /tmp/mppserver.sock)" << endl;
+    cout << tab << "-n                  number of worker threads (default = number of cores)" << endl;
+    cout << tab << "    --state-model   overrides the state model of every mixture" << endl;
+    cout << tab << "    --species-list  instead of mixture names, use this to list species in mixture" << endl;
+    cout << endl;
+    cout << "Clients select a mixture by its name, the first one by default." << endl;
+    cout << endl;
+    cout << "Example:" << endl;
+    cout << tab << name << " -v -s /tmp/air.sock --state-model ChemNonEqTTv air_5 air_11" << endl;
+    cout << endl;
+
+    exit(0);
+}
+
+// Parse the command line options to determine what the user wants to do
+Options parseOptions(int argc, char** argv)
+{
+    Options opts;
+
+    // Print the help message and exit if desired
+    if (argc < 2 || optionExists(argc, argv, "-h") ||
+        optionExists(argc, argv, "--help"))
+        printHelpMessage(argv[0]);
+
+    opts.verbose =
+        optionExists(argc, argv, "-v") || optionExists(argc, argv, "--verbose");
+
+    opts.socket_path = "/tmp/mppserver.sock";
+    if (optionExists(argc, argv, "-s"))
+        opts.socket_path = getOption(argc, argv, "-s");
+
+    opts.nworkers = std::thread::hardware_concurrency();
+    if (optionExists(argc, argv, "-n"))
+        opts.nworkers = atoi(getOption(argc, argv, "-n").c_str());
+    opts.nworkers = std::max(opts.nworkers, 1);
+
+    // The mixture names are the arguments which are not options (unless
+    // --species-list option is present)
+    if (optionExists(argc, argv, "--species-list")) {
+        opts.names.push_back("species-list");
+        opts.mixture_opts.push_back(Mutation::MixtureOptions());
+        opts.mixture_opts.back().setSpeciesDescriptor(
+            getOption(argc, argv, "--species-list"));
+    } else {
+        for (int i = 1; i < argc; ++i) {
+            const std::string arg(argv[i]);
+            if (arg == "-s" || arg == "-n" || arg == "--state-model")
+                ++i;
+            else if (arg[0] != '-') {
+                opts.names.push_back(arg);
+                opts.mixture_opts.push_back(Mutation::MixtureOptions(arg));
+            }
+        }
+    }
+
+    if (opts.names.empty())
+        printHelpMessage(argv[0]);
+
+    if (optionExists(argc, argv, "--state-model"))
+        for (int i = 0; i < opts.mixture_opts.size(); ++i)
+            opts.mixture_opts[i].setStateModel(
+                getOption(argc, argv, "--state-model"));
+
+    return opts;
+}
+
+int main(int argc, char** argv)
+{
+    Options opts = parseOptions(argc, argv);
+
+    // The signals are handled by a dedicated thread, which may stop the server
+    // safely, so they are blocked before any other thread is started
+    sigset_t signals;
+    sigemptyset(&signals);
+    sigaddset(&signals, SIGINT);
+    sigaddset(&signals, SIGTERM);
+    pthread_sigmask(SIG_BLOCK, &signals, NULL);
+
+    PropertyServer server(
+        opts.names, opts.mixture_opts, opts.socket_path, opts.nworkers);
+    server.setVerbose(opts.verbose);
+
+    std::thread signal_thread([&server, &signals]() {
+        int signal;
+        sigwait(&signals, &signal);
+        server.stop();
+    });
+
+    if (opts.verbose)
+        cerr << "Serving " << server.nMixtures() << " mixtures on "
+             << server.socketPath() << " with " << server.nWorkers()
+             << " workers" << endl;
+
+    server.run();
+
+    // Wake up the signal thread if the server stopped on its own
+    pthread_kill(signal_thread.native_handle(), SIGTERM);
+    signal_thread.join();
+
+    return 0;
+}
@@ -29,6 +29,8 @@
 #define GENERAL_MUTATIONPP_H
 
 #include "Mixture.h"
+#include "SurfaceBalanceMemory.h"
+#include "BatchProperties.h"
 #include "Kinetics.h"
 #include "RateLaws.h"
 #include "RateManager.h"
@@ -36,9 +38,11 @@
 #include "StoichiometryManager.h"
 #include "ThirdBodyManager.h"
 #include "Species.h"
+#include "SpeciesCatalog.h"
 #include "SpeciesNameFSM.h"
 #include "ThermoDB.h"
 #include "Thermodynamics.h"
+#include "BprimeTable.h"
 #include "CollisionDB.h"
 #include "Constants.h"
 #include "Transport.h"
@@ -47,6 +51,7 @@
 #include "Units.h"
 #include "Composition.h"
 #include "ParticleRRHO.h"
+#include "Diagnostics.h"
 #include "Errors.h"
 
 #endif // MUTATIONPP_H
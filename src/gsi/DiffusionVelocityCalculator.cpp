@@ -59,7 +59,7 @@ void DiffusionVelocityCalculator::setDiffusionModel(
 {
     mv_mole_frac_edge = v_mole_frac_edge;
 
-    if (m_dx <= 0.) {
+    if (dx <= 0.) {
     	throw LogicError()
         << "Calling DiffusionVelocityCalculator::setDiffusionModel() with a "
         << "distance less or equal to zero. The distance dx should always be "
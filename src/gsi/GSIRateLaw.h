@@ -38,6 +38,7 @@ namespace Mutation { namespace Utilities { namespace IO { class XmlElement; }}}
 namespace Mutation {
     namespace GasSurfaceInteraction {
 
+class GSIRateTable;
 class SurfaceProperties;
 
 //==============================================================================
@@ -100,6 +101,16 @@ public:
         const Eigen::VectorXd& v_rhoi,
         const Eigen::VectorXd& v_Twall) const = 0;
 
+    /**
+     * Adds this rate law, as the forward rate of reaction rxn, to the table of
+     * rate laws which are evaluated together by the rate manager.  Rate laws
+     * which cannot be tabulated return false, and are then evaluated on their
+     * own with forwardReactionRateCoefficient().
+     */
+    virtual bool addToRateTable(const int rxn, GSIRateTable& table) const {
+        return false;
+    }
+
 protected:
     Mutation::Thermodynamics::Thermodynamics& m_thermo;
     const Mutation::Transport::Transport& m_transport;
@@ -34,6 +34,7 @@
 #include "Transport.h"
 
 #include "GSIRateLaw.h"
+#include "GSIRateTable.h"
 
 using namespace Eigen;
 
@@ -114,6 +115,27 @@ public:
         return getLimitingImpingingMassFlux();
     }
 
+//==============================================================================
+
+    bool addToRateTable(const int rxn, GSIRateTable& table) const
+    {
+        std::vector<int> sps;
+        std::vector<int> nus;
+        int idx_react = 0;
+        int idx_sp;
+        int stoich_coef;
+        for (int i_g = 0; i_g < mv_gamma.size(); i_g++) {
+            getSpeciesIndexandStoichiometricCoefficient(
+                idx_react, idx_sp, stoich_coef);
+            sps.push_back(idx_sp);
+            nus.push_back(stoich_coef);
+            idx_react += stoich_coef;
+        }
+
+        table.addGammaConst(rxn, sps, nus, mv_gamma);
+        return true;
+    }
+
 private:
     mutable int m_idx_react;
     mutable int m_idx_sp;
@@ -35,6 +35,7 @@
 #include "Utilities.h"
 
 #include "GSIRateLaw.h"
+#include "GSIRateTable.h"
 
 using namespace Mutation::Utilities::Config;
 
@@ -83,6 +84,14 @@ public:
                 mv_react[idx_react])*v_rhoi(mv_react[idx_react]);
     }
 
+//==============================================================================
+
+    bool addToRateTable(const int rxn, GSIRateTable& table) const
+    {
+        table.addGammaT(rxn, mv_react[idx_react], m_pre_exp, m_activ_en);
+        return true;
+    }
+
 private:
     const size_t pos_T_trans;
     const size_t idx_react;
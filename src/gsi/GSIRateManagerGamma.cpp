@@ -33,6 +33,7 @@
 #include "GSIReaction.h"
 #include "GSIRateLaw.h"
 #include "GSIRateManager.h"
+#include "GSIRateTable.h"
 #include "GSIStoichiometryManager.h"
 #include "SurfaceProperties.h"
 #include "WallState.h"
@@ -51,16 +52,23 @@ class GSIRateManagerGamma : public GSIRateManager
 public:
     GSIRateManagerGamma(DataGSIRateManager args)
         : GSIRateManager(args),
+          pos_T_trans(0),
 		  m_ns(args.s_thermo.nSpecies()),
 		  m_nr(args.s_reactions.size()),
           mv_react_rate_const(m_nr),
-		  mv_work(m_ns)
+		  mv_work(m_ns),
+          m_rate_table(args.s_thermo)
     {
         for (int i_reac = 0; i_reac < m_nr; ++i_reac) {
             m_reactants.addReaction(
                 i_reac, args.s_reactions[i_reac]->getReactants());
             m_irr_products.addReaction(
                 i_reac, args.s_reactions[i_reac]->getProducts());
+
+            // Rate laws which cannot be tabulated are evaluated one by one
+            if (!args.s_reactions[i_reac]->getRateLaw()->addToRateTable(
+                    i_reac, m_rate_table))
+                mv_untabulated.push_back(i_reac);
         }
     }
 
@@ -72,8 +80,17 @@ public:
 
     Eigen::VectorXd computeRate()
     {
-        // Get reaction rate constant
-        for (int i_r = 0; i_r < m_nr; ++i_r) {
+        // Get reaction rate constant, first for all the tabulated rate laws
+        // from the impinging fluxes at the wall
+        if (m_rate_table.nReactions() > 0) {
+            m_rate_table.computeImpingingFluxes(
+                m_wall_state.getWallRhoi(),
+                m_wall_state.getWallT()(pos_T_trans));
+            m_rate_table.forwardRateCoefficients(mv_react_rate_const);
+        }
+
+        for (int i = 0; i < mv_untabulated.size(); ++i) {
+            const int i_r = mv_untabulated[i];
             mv_react_rate_const(i_r) =
                 v_reactions[i_r]->getRateLaw()->
                     forwardReactionRateCoefficient(
@@ -91,6 +108,7 @@ public:
     }
 
 private:
+    const size_t pos_T_trans;
     const size_t m_ns;
     const size_t m_nr;
 
@@ -100,6 +118,9 @@ private:
     GSIStoichiometryManager m_reactants;
     GSIStoichiometryManager m_irr_products;
 
+    GSIRateTable m_rate_table;
+    std::vector<int> mv_untabulated;
+
 };
 
 ObjectProvider<
@@ -0,0 +1,134 @@
+/**
+ * @file GSIRateTable.cpp
+ *
+ * @brief Implementation of GSIRateTable class.
+ */
+
+/*
+ * Copyright 2018 von Karman Institute for Fluid Dynamics (VKI)
+ *
+ * This file is part of MUlticomponent Thermodynamic And Transport
+ * properties for IONized gases in C++ (Mutation++) software package.
+ *
+ * Mutation++ is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as
+ * published by the Free Software Foundation, either version 3 of the
+ * License, or (at your option) any later version.
+ *
+ * Mutation++ is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with Mutation++.  If not, see
+ * <http://www.gnu.org/licenses/>.
+ */
+
+#include "Constants.h"
+#include "Errors.h"
+#include "Thermodynamics.h"
+
+#include "GSIRateTable.h"
+
+using namespace Eigen;
+
+namespace Mutation {
+    namespace GasSurfaceInteraction {
+
+//==============================================================================
+
+GSIRateTable::GSIRateTable(
+    const Mutation::Thermodynamics::Thermodynamics& thermo)
+    : mv_flux_coef(thermo.nSpecies()),
+      mv_flux(VectorXd::Zero(thermo.nSpecies())),
+      m_Twall(-1.0),
+      m_const_offset(1, 0),
+      m_T_last(-1.0)
+{
+    // The impinging flux is v_i/4 rho_i/Mw_i with the thermal speed
+    // v_i = sqrt(8 RU T/(PI Mw_i))
+    for (int i = 0; i < thermo.nSpecies(); ++i) {
+        const double mw = thermo.speciesMw(i);
+        mv_flux_coef(i) = std::sqrt(RU/(TWOPI*mw))/mw;
+    }
+}
+
+//==============================================================================
+
+void GSIRateTable::addGammaConst(
+    const int rxn, const std::vector<int>& sps,
+    const std::vector<int>& nus, const std::vector<double>& gammas)
+{
+    if (sps.empty() || sps.size() != nus.size() ||
+        sps.size() != gammas.size())
+        throw LogicError()
+            << "A constant reaction probability should be given for each "
+            << "gas phase reactant of reaction " << rxn << ".";
+
+    m_const_rxn.push_back(rxn);
+    for (int i = 0; i < sps.size(); ++i) {
+        m_const_sp.push_back(sps[i]);
+        m_const_nu.push_back(nus[i]);
+        m_const_gamma.push_back(gammas[i]);
+    }
+    m_const_offset.push_back(m_const_sp.size());
+}
+
+//==============================================================================
+
+void GSIRateTable::addGammaT(
+    const int rxn, const int sp, const double pre_exp, const double activ_en)
+{
+    m_T_rxn.push_back(rxn);
+    m_T_sp.push_back(sp);
+    m_T_pre_exp.push_back(pre_exp);
+    m_T_activ_en.push_back(activ_en);
+    mv_T_gamma.resize(m_T_rxn.size());
+    m_T_last = -1.0;
+}
+
+//==============================================================================
+
+void GSIRateTable::computeImpingingFluxes(const VectorXd& v_rhoi, double Twall)
+{
+    m_Twall = Twall;
+    mv_flux = std::sqrt(Twall)*mv_flux_coef.cwiseProduct(v_rhoi);
+}
+
+//==============================================================================
+
+void GSIRateTable::forwardRateCoefficients(VectorXd& v_kf)
+{
+    // Constant probabilities, limited by the reactant with the smallest flux
+    // per stoichiometric coefficient
+    for (int i = 0; i < m_const_rxn.size(); ++i) {
+        int lim = m_const_offset[i];
+        double lim_flux = mv_flux(m_const_sp[lim])/m_const_nu[lim];
+        for (int k = lim + 1; k < m_const_offset[i+1]; ++k) {
+            const double flux = mv_flux(m_const_sp[k])/m_const_nu[k];
+            if (flux < lim_flux) {
+                lim = k;
+                lim_flux = flux;
+            }
+        }
+        v_kf(m_const_rxn[i]) = m_const_gamma[lim]*lim_flux;
+    }
+
+    // Temperature dependent probabilities, evaluated in one pass whenever the
+    // wall temperature changes
+    const int nT = m_T_rxn.size();
+    if (nT == 0) return;
+
+    if (m_Twall != m_T_last) {
+        mv_T_gamma = Map<const ArrayXd>(&m_T_pre_exp[0], nT) *
+            (Map<const ArrayXd>(&m_T_activ_en[0], nT)/(-m_Twall)).exp();
+        m_T_last = m_Twall;
+    }
+
+    for (int i = 0; i < nT; ++i)
+        v_kf(m_T_rxn[i]) = mv_T_gamma(i)*mv_flux(m_T_sp[i]);
+}
+
+    } // namespace GasSurfaceInteraction
+} // namespace Mutation
@@ -0,0 +1,134 @@
+/**
+ * @file GSIRateTable.h
+ *
+ * @brief Declaration of GSIRateTable class.
+ */
+
+/*
+ * Copyright 2018 von Karman Institute for Fluid Dynamics (VKI)
+ *
+ * This file is part of MUlticomponent Thermodynamic And Transport
+ * properties for IONized gases in C++ (Mutation++) software package.
+ *
+ * Mutation++ is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as
+ * published by the Free Software Foundation, either version 3 of the
+ * License, or (at your option) any later version.
+ *
+ * Mutation++ is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with Mutation++.  If not, see
+ * <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef GSI_RATE_TABLE_H
+#define GSI_RATE_TABLE_H
+
+#include <eigen3/Eigen/Dense>
+
+#include <vector>
+
+namespace Mutation { namespace Thermodynamics { class Thermodynamics; }}
+
+namespace Mutation {
+    namespace GasSurfaceInteraction {
+
+/**
+ * Evaluates together the forward rate coefficients of all the reactions whose
+ * rate is a reaction probability times the impinging flux of a gas species.
+ *
+ * The rate laws add themselves to the table when the mechanism is loaded,
+ * grouped by type.  The impinging molar fluxes of all species are then
+ * computed once per wall state, and the rates of each group in a single pass
+ * over the group.
+ */
+class GSIRateTable
+{
+public:
+
+    /**
+     * Constructor.
+     */
+    GSIRateTable(const Mutation::Thermodynamics::Thermodynamics& thermo);
+
+    /**
+     * Adds a reaction with a constant reaction probability for each of its
+     * gas phase reactants.  The reaction is limited by the reactant with the
+     * smallest impinging flux per stoichiometric coefficient.
+     *
+     * @param rxn    index of the reaction
+     * @param sps    index of each different gas phase reactant
+     * @param nus    stoichiometric coefficient of each reactant
+     * @param gammas reaction probability of each reactant
+     */
+    void addGammaConst(
+        const int rxn, const std::vector<int>& sps,
+        const std::vector<int>& nus, const std::vector<double>& gammas);
+
+    /**
+     * Adds a reaction with the reaction probability
+     * \f$ \gamma = A \exp(-T_a / T_w) \f$ for the reactant sp.
+     */
+    void addGammaT(
+        const int rxn, const int sp, const double pre_exp,
+        const double activ_en);
+
+    /**
+     * Returns the number of reactions in the table.
+     */
+    int nReactions() const {
+        return m_const_rxn.size() + m_T_rxn.size();
+    }
+
+    /**
+     * Computes the impinging molar fluxes of the species at the given wall
+     * state, in mol/m^2-s.
+     */
+    void computeImpingingFluxes(const Eigen::VectorXd& v_rhoi, double Twall);
+
+    /**
+     * Returns the impinging molar fluxes of the last call to
+     * computeImpingingFluxes().
+     */
+    const Eigen::VectorXd& impingingFluxes() const { return mv_flux; }
+
+    /**
+     * Fills the forward rate coefficients of the reactions in the table, in
+     * mol/m^2-s, from the last impinging fluxes.  The other entries of the
+     * vector are left untouched.
+     */
+    void forwardRateCoefficients(Eigen::VectorXd& v_kf);
+
+private:
+
+    /// Impinging flux of each species divided by rho_i*sqrt(T)
+    Eigen::VectorXd mv_flux_coef;
+    Eigen::VectorXd mv_flux;
+    double m_Twall;
+
+    // Constant reaction probabilities, with the reactants of reaction i stored
+    // between m_const_offset[i] and m_const_offset[i+1]
+    std::vector<int> m_const_rxn;
+    std::vector<int> m_const_offset;
+    std::vector<int> m_const_sp;
+    std::vector<double> m_const_nu;
+    std::vector<double> m_const_gamma;
+
+    // Temperature dependent reaction probabilities, only recomputed when the
+    // wall temperature changes
+    std::vector<int> m_T_rxn;
+    std::vector<int> m_T_sp;
+    std::vector<double> m_T_pre_exp;
+    std::vector<double> m_T_activ_en;
+    Eigen::ArrayXd mv_T_gamma;
+    double m_T_last;
+};
+
+    } // namespace GasSurfaceInteraction
+} // namespace Mutation
+
+#endif // GSI_RATE_TABLE_H
@@ -52,13 +52,40 @@ GasSurfaceInteraction::GasSurfaceInteraction(
       m_transport(transport),
       mp_surf_solver(NULL),
       mp_surf_props(NULL),
-      mp_wall_state(NULL)
+      mp_wall_state(NULL),
+      m_gsi_input_file(gsi_input_file)
 {
-    if (gsi_input_file == "none"){return;}
+    // Read the input file now, in case it is moved or the working directory
+    // changes before the interface is used
+    if (m_gsi_input_file != "none") {
+        m_gsi_input_file = databaseFileName(m_gsi_input_file, "gsi");
+        m_gsi_input_contents = XmlDocument::readFile(m_gsi_input_file);
+    }
+}
 
-    gsi_input_file = databaseFileName(gsi_input_file, "gsi");
+//==============================================================================
+
+void GasSurfaceInteraction::initialize()
+{
+    try {
+        loadInputFile();
+    } catch (...) {
+        m_load_error = std::current_exception();
+    }
+}
+
+//==============================================================================
 
-    XmlDocument xml_doc(gsi_input_file);
+void GasSurfaceInteraction::loadInputFile()
+{
+    if (m_gsi_input_file == "none") {
+        throw LogicError()
+            << "No gas surface interaction file is given in the mixture "
+            << "options.";
+    }
+
+    XmlDocument xml_doc(m_gsi_input_file, m_gsi_input_contents);
+    std::string().swap(m_gsi_input_contents);
     Mutation::Utilities::IO::XmlElement root_element = xml_doc.root();
 
     errorWrongTypeofGSIFile(root_element.tag());
@@ -106,6 +133,7 @@ void GasSurfaceInteraction::setWallState(
     const double* const p_mass, const double* const p_energy,
 	const int state_variable)
 {
+    load();
     mp_wall_state->setWallState(p_mass, p_energy, state_variable);
 }
 
@@ -115,6 +143,7 @@ void GasSurfaceInteraction::getWallState(
     double* const p_mass, double* const p_energy,
     const int state_variable)
 {
+    load();
     mp_wall_state->getWallState(p_mass, p_energy, state_variable);
 }
 
@@ -123,6 +152,7 @@ void GasSurfaceInteraction::getWallState(
 void GasSurfaceInteraction::surfaceProductionRates(
     double* const p_wall_prod_rates)
 {
+    load();
     Eigen::VectorXd v_wall_rates = mp_surf_solver->computeGSIProductionRates();
 	for (int i_sp = 0; i_sp < m_thermo.nSpecies(); i_sp++){
 	    p_wall_prod_rates[i_sp] = v_wall_rates(i_sp);
@@ -134,6 +164,7 @@ void GasSurfaceInteraction::surfaceProductionRates(
 void GasSurfaceInteraction::setDiffusionModel(
     const double* const p_mole_frac_edge, const double& dx)
 {
+    load();
     mp_surf_solver->setDiffusionModel(Eigen::Map<const Eigen::VectorXd>(
         p_mole_frac_edge, m_thermo.nSpecies()), dx);
 }
@@ -151,12 +182,22 @@ void GasSurfaceInteraction::setConductiveHeatFluxModel(
 
 void GasSurfaceInteraction::solveSurfaceBalance()
 {
+    load();
     mp_surf_solver->solveSurfaceBalance();
 }
 
 //==============================================================================
 
+void GasSurfaceInteraction::solveSurfaceBalance(SurfaceBalanceMemory& memory)
+{
+    load();
+    mp_surf_solver->solveSurfaceBalance(memory);
+}
+
+//==============================================================================
+
 void GasSurfaceInteraction::getMassBlowingRate(double& mdot){
+    load();
     mdot = mp_surf_solver->massBlowingRate();
 }
 
@@ -165,6 +206,7 @@ void GasSurfaceInteraction::getMassBlowingRate(double& mdot){
 void GasSurfaceInteraction::getBprimeCharSpecies(
 		std::vector<std::string>& v_species_char_names)
 {
+    load();
     mp_surf_solver->getBprimeCondensedSpecies(v_species_char_names);
 }
 
@@ -173,6 +215,7 @@ void GasSurfaceInteraction::getBprimeCharSpecies(
 void GasSurfaceInteraction::getBprimeSolution(
     double& bprime_char, std::vector<double>& v_species_char_mass_frac)
 {
+    load();
     mp_surf_solver->getBprimeParameters(bprime_char, v_species_char_mass_frac);
 }
 
@@ -29,6 +29,11 @@
 #ifndef GAS_SURFACE_INTERACTION_H
 #define GAS_SURFACE_INTERACTION_H
 
+#include <exception>
+#include <mutex>
+#include <string>
+#include <vector>
+
 namespace Mutation { namespace Thermodynamics { class Thermodynamics; }}
 namespace Mutation { namespace Transport { class Transport; }}
 
@@ -37,6 +42,7 @@ namespace Mutation {
 
 class SurfaceBalanceSolver;
 class SurfaceProperties;
+class SurfaceBalanceMemory;
 class WallState;
 
 /**
@@ -47,6 +53,9 @@ class WallState;
  *  returned. The solution of the surface mass balance can also be provided.
  *
  *  Currently, gamma models for catalysis and ablation are available.
+ *
+ *  The gas surface interaction file is only loaded when the interface is
+ *  first used, once even if several threads use it at the same time.
  */
 
 class GasSurfaceInteraction
@@ -132,6 +141,17 @@ public:
      */
     void solveSurfaceBalance();
 
+    /**
+     * Solves the mass and energy balances at one wall face like
+     * solveSurfaceBalance(), but starting from the solution of the previous
+     * call for the same face and reusing its Jacobian while it still reduces
+     * the residual enough.  One memory object should be kept per wall face by
+     * the caller, and is updated on return.
+     *
+     * @param memory  solver memory of the wall face
+     */
+    void solveSurfaceBalance(SurfaceBalanceMemory& memory);
+
     /**
      * Function which return the total mass blowing flux.
      *
@@ -151,6 +171,28 @@ public:
         double& bprime_char, std::vector<double>& v_species_char_mass_frac);
 
 private:
+    /**
+     * Loads the gas surface interaction file on first use.
+     */
+    void load() {
+        std::call_once(
+            m_load_flag, &GasSurfaceInteraction::initialize, this);
+        if (m_load_error)
+            std::rethrow_exception(m_load_error);
+    }
+
+    /**
+     * Loads the gas surface interaction file, keeping any error for later
+     * uses.
+     */
+    void initialize();
+
+    /**
+     * Creates the surface properties, wall state and surface balance solver
+     * from the gas surface interaction file.
+     */
+    void loadInputFile();
+
     /**
      * Error function; wrong type of Gas Surface Interaction input file.
      */
@@ -169,7 +211,12 @@ private:
     WallState* mp_wall_state;
     SurfaceBalanceSolver* mp_surf_solver;
 
+    std::string m_gsi_input_file;
+    std::string m_gsi_input_contents;
     std::string m_gsi_mechanism;
+
+    std::once_flag m_load_flag;
+    std::exception_ptr m_load_error;
 };
 
     } // namespace GasSurfaceInteraction
@@ -34,7 +34,7 @@ namespace Mutation { namespace Thermodynamics { class Thermodynamics; }}
 namespace Mutation {
     namespace GasSurfaceInteraction {
 
-class WallProductionTerms;
+class WallProductionRates;
 
 //==============================================================================
 
@@ -43,7 +43,7 @@ class WallProductionTerms;
  */
 struct DataMassBlowingRate {
     const Mutation::Thermodynamics::Thermodynamics& s_thermo;
-    std::vector<WallProductionTerms*>& vs_wall_productions_terms;
+    WallProductionRates& s_prod_rates;
 };
 
 //==============================================================================
@@ -34,7 +34,7 @@
 #include "Transport.h"
 
 #include "MassBlowingRate.h"
-#include "WallProductionTerms.h"
+#include "WallProductionRates.h"
 
 using namespace Eigen;
 
@@ -48,27 +48,9 @@ class MassBlowingRateAblation : public MassBlowingRate
 public:
     MassBlowingRateAblation(ARGS args)
         : m_ns(args.s_thermo.nSpecies()),
-          mv_wall_prod_rates(m_ns),
-          mv_wrk(m_ns+args.s_thermo.nEnergyEqns())
-    {
-    	std::string prod_term_tag;
-        for (size_t i_term = 0;
-             i_term < args.vs_wall_productions_terms.size();
-             ++i_term) {
-            prod_term_tag = args.vs_wall_productions_terms[i_term]->
-                                getWallProductionTermTag();
-
-            if (prod_term_tag.compare("surface_chemistry") == 0) {
-                mv_wall_prod_terms.push_back(
-                    args.vs_wall_productions_terms[i_term]);
-            }
-            if(prod_term_tag.compare("pyrolysis") == 0) {
-                mv_wall_prod_terms.push_back(
-                    args.vs_wall_productions_terms[i_term]);
-            }
-        }
-
-    }
+          m_prod_rates(args.s_prod_rates),
+          mv_wall_prod_rates(m_ns)
+    { }
 
 //==============================================================================
     /**
@@ -79,17 +61,20 @@ public:
 //==============================================================================
     /**
      * This function returns the mass blowing flux in kg/m^2-s as the sum of
-     * the heterogeneous reactions.
+     * the heterogeneous reactions and of the pyrolysis gases.  The rates of
+     * the production terms are those already computed for the current wall
+     * state, if any.
      */
     double computeBlowingFlux(){
 
         mv_wall_prod_rates.setZero();
-        mv_wrk.setZero();
 
-        for(size_t i_term = 0; i_term < mv_wall_prod_terms.size(); ++i_term)
+        for (int i_term = 0; i_term < m_prod_rates.nTerms(); ++i_term)
         {
-        	mv_wall_prod_terms[i_term]->productionRate(mv_wrk);
-            mv_wall_prod_rates += mv_wrk.head(m_ns);
+            const std::string& prod_term_tag = m_prod_rates.tag(i_term);
+            if (prod_term_tag.compare("surface_chemistry") == 0 ||
+                prod_term_tag.compare("pyrolysis") == 0)
+                mv_wall_prod_rates += m_prod_rates.rate(i_term).head(m_ns);
         }
 
         return mv_wall_prod_rates.sum();
@@ -98,9 +83,8 @@ public:
 private:
     const size_t m_ns;
 
-    std::vector<WallProductionTerms*> mv_wall_prod_terms;
+    WallProductionRates& m_prod_rates;
     VectorXd mv_wall_prod_rates;
-    VectorXd mv_wrk;
 };
 
 ObjectProvider<
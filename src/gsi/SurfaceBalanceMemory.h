@@ -0,0 +1,124 @@
+/**
+ * @file SurfaceBalanceMemory.h
+ *
+ * @brief Declaration of SurfaceBalanceMemory class.
+ */
+
+/*
+ * Copyright 2018 von Karman Institute for Fluid Dynamics (VKI)
+ *
+ * This file is part of MUlticomponent Thermodynamic And Transport
+ * properties for IONized gases in C++ (Mutation++) software package.
+ *
+ * Mutation++ is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as
+ * published by the Free Software Foundation, either version 3 of the
+ * License, or (at your option) any later version.
+ *
+ * Mutation++ is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with Mutation++.  If not, see
+ * <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef SURFACE_BALANCE_MEMORY_H
+#define SURFACE_BALANCE_MEMORY_H
+
+#include <eigen3/Eigen/Dense>
+
+#include <vector>
+
+namespace Mutation {
+    namespace GasSurfaceInteraction {
+
+class SurfaceBalanceSolverMass;
+
+/**
+ * Memory of the surface balance solver for one wall face across time steps.
+ *
+ * The caller owns one object per wall face and passes it to every call of
+ * GasSurfaceInteraction::solveSurfaceBalance() for that face.  The solution of
+ * the previous call is then used as initial guess, and the factorized Jacobian
+ * is reused for as long as it keeps reducing the residual, instead of being
+ * evaluated again at every iteration.
+ */
+class SurfaceBalanceMemory
+{
+public:
+
+    /**
+     * Creates an empty memory, so that the first solve starts from the wall
+     * state like solveSurfaceBalance() without memory.
+     */
+    SurfaceBalanceMemory()
+        : m_has_jacobian(false),
+          m_closure_sp(0),
+          m_jacobian_updates(0)
+    { }
+
+    /**
+     * Forgets the last solution and Jacobian, for instance when the flow
+     * solution is restarted or the wall conditions change abruptly.
+     */
+    void reset() {
+        mv_solution.resize(0);
+        m_has_jacobian = false;
+        m_jacobian_updates = 0;
+        mv_residuals.clear();
+    }
+
+    /**
+     * Returns true if the memory holds the solution of a previous call.
+     */
+    bool hasSolution() const { return mv_solution.size() > 0; }
+
+    /**
+     * Returns true if the memory holds a factorized Jacobian.
+     */
+    bool hasJacobian() const { return m_has_jacobian; }
+
+    /**
+     * Returns the wall mole fractions found by the last call.
+     */
+    const Eigen::VectorXd& solution() const { return mv_solution; }
+
+    /**
+     * Returns the number of Newton iterations of the last call.
+     */
+    int iterations() const {
+        return mv_residuals.empty() ? 0 : int(mv_residuals.size()) - 1;
+    }
+
+    /**
+     * Returns the number of Jacobian evaluations of the last call.
+     */
+    int jacobianUpdates() const { return m_jacobian_updates; }
+
+    /**
+     * Returns the infinity norm of the residual of the surface balance for the
+     * initial guess and after each iteration of the last call.
+     */
+    const std::vector<double>& residualHistory() const {
+        return mv_residuals;
+    }
+
+private:
+
+    friend class SurfaceBalanceSolverMass;
+
+    Eigen::VectorXd mv_solution;
+    Eigen::FullPivLU<Eigen::MatrixXd> m_jacobian;
+    bool m_has_jacobian;
+    Eigen::VectorXd::Index m_closure_sp;
+    int m_jacobian_updates;
+    std::vector<double> mv_residuals;
+};
+
+    } // namespace GasSurfaceInteraction
+} // namespace Mutation
+
+#endif // SURFACE_BALANCE_MEMORY_H
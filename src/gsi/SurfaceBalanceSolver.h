@@ -38,6 +38,7 @@ namespace Mutation { namespace Utilities { namespace IO { class XmlElement; }}}
 namespace Mutation {
     namespace GasSurfaceInteraction {
 
+class SurfaceBalanceMemory;
 class SurfaceProperties;
 class WallState;
 
@@ -101,6 +102,15 @@ public:
      */
     virtual void solveSurfaceBalance() = 0;
 
+    /**
+     * Solves the surface balance starting from the solution and Jacobian kept
+     * in the memory of the wall face, which is updated on return.  Solvers
+     * which cannot make use of the memory ignore it.
+     */
+    virtual void solveSurfaceBalance(SurfaceBalanceMemory& memory) {
+        solveSurfaceBalance();
+    }
+
     /**
      * Purely virtual function returning the total mass blowing flux
      * due to surface and bulk phase processes.
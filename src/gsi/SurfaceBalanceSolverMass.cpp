@@ -34,6 +34,8 @@
 
 #include "DiffusionVelocityCalculator.h"
 #include "MassBlowingRate.h"
+#include "SurfaceBalanceMemory.h"
+#include "WallProductionRates.h"
 #include "WallProductionTerms.h"
 #include "SurfaceBalanceSolver.h"
 #include "SurfaceProperties.h"
@@ -56,6 +58,7 @@ SurfaceBalanceSolverMass(ARGS args)
       m_wall_state(args.s_wall_state),
       mp_diff_vel_calc(NULL),
       mp_mass_blowing_rate(NULL),
+      mp_prod_rates(NULL),
       m_ns(m_thermo.nSpecies()),
       m_nE(m_thermo.nEnergyEqns()),
       mv_rhoi(m_ns),
@@ -66,10 +69,16 @@ SurfaceBalanceSolverMass(ARGS args)
       mv_f_unpert(m_ns),
       mv_jac(m_ns, m_ns),
       m_pert(1.e-7),
+      m_jac_reuse_ratio(0.5),
+      m_closure_sp(0),
       pos_T_trans(0),
       set_state_with_rhoi_T(1),
       mv_sep_mass_prod_rate(m_ns)
 {
+    // Rates of the production terms shared by the residual, the pyrolysis
+    // and the mass blowing rate
+    mp_prod_rates = new WallProductionRates(m_wall_state, mv_surf_prod, m_ns);
+
 	Mutation::Utilities::IO::XmlElement::const_iterator iter_prod_terms =
                                    args.s_node_prod_terms.begin();
 
@@ -82,7 +91,7 @@ SurfaceBalanceSolverMass(ARGS args)
                                                          *iter_prod_terms,
                                                          m_surf_props,
                                                          m_wall_state,
-                                                         &mv_surf_prod,
+                                                         mp_prod_rates,
                                                          &m_Pwall};
 
         s_tag = iter_prod_terms->tag();
@@ -96,7 +105,7 @@ SurfaceBalanceSolverMass(ARGS args)
         m_thermo, args.s_transport);
 
     // MassBlowingRate
-    DataMassBlowingRate data_mass_blowing_rate = {m_thermo, mv_surf_prod};
+    DataMassBlowingRate data_mass_blowing_rate = {m_thermo, *mp_prod_rates};
     const std::string s_mass_blowing = "isOn";
     mp_mass_blowing_rate = Factory<MassBlowingRate>::create(
     s_mass_blowing, data_mass_blowing_rate);
@@ -105,6 +114,7 @@ SurfaceBalanceSolverMass(ARGS args)
     setMaxIterations(5);
     setWriteConvergenceHistory(false);
     setEpsilon(1.e-18);
+    setDiagnostics(&m_thermo.diagnostics());
 }
 
 //=============================================================================
@@ -122,6 +132,7 @@ SurfaceBalanceSolverMass(ARGS args)
 
         if (mp_diff_vel_calc != NULL) { delete mp_diff_vel_calc; }
         if (mp_mass_blowing_rate != NULL) { delete mp_mass_blowing_rate; }
+        if (mp_prod_rates != NULL) { delete mp_prod_rates; }
     }
 
 //=============================================================================
@@ -129,16 +140,8 @@ SurfaceBalanceSolverMass(ARGS args)
     Eigen::VectorXd computeGSIProductionRates()
     {
         errorWallStateNotSet();
-        static Eigen::VectorXd v_wrk(m_ns);
-
-        mv_sep_mass_prod_rate.setZero();
-        for (int i_prod_terms = 0;
-             i_prod_terms < mv_surf_prod.size();
-             ++i_prod_terms) {
-            v_wrk.setZero();
-            mv_surf_prod[i_prod_terms]->productionRate(v_wrk);
-            mv_sep_mass_prod_rate += v_wrk;
-        }
+
+        mv_sep_mass_prod_rate = mp_prod_rates->total();
         return mv_sep_mass_prod_rate;
     }
 
@@ -168,6 +171,7 @@ SurfaceBalanceSolverMass(ARGS args)
 
         // Changing to the solution variables and solving
         computeMoleFracfromPartialDens(mv_rhoi, mv_X);
+        mv_X.maxCoeff(&m_closure_sp);
 
         mv_X = solve(mv_X);
 
@@ -180,6 +184,96 @@ SurfaceBalanceSolverMass(ARGS args)
             set_state_with_rhoi_T);
     }
 
+//==============================================================================
+
+    void solveSurfaceBalance(SurfaceBalanceMemory& memory)
+    {
+        // Getting the state
+        mv_rhoi = m_wall_state.getWallRhoi();
+
+        for (int i_E = 0; i_E < m_nE; i_E++) {
+            mv_Twall(i_E) = m_wall_state.getWallT()(i_E);
+        }
+        saveUnperturbedPressure(mv_rhoi);
+
+        // Start from the last solution of this face, if there is one
+        if (memory.mv_solution.size() != m_ns)
+            memory.reset();
+        if (memory.hasSolution())
+            mv_X = memory.mv_solution;
+        else
+            computeMoleFracfromPartialDens(mv_rhoi, mv_X);
+
+        // A stored Jacobian was computed with its own closure equation
+        if (memory.m_has_jacobian)
+            m_closure_sp = memory.m_closure_sp;
+        else
+            mv_X.maxCoeff(&m_closure_sp);
+
+        memory.mv_residuals.clear();
+        memory.m_jacobian_updates = 0;
+
+        updateFunction(mv_X);
+        double resnorm = mv_f.lpNorm<Eigen::Infinity>();
+        memory.mv_residuals.push_back(resnorm);
+
+        bool converged = false;
+        for (int i = 0; i < maxIterations() && !converged; ++i) {
+            // The Jacobian is only evaluated when the stored one stopped
+            // reducing the residual, or on the first call
+            const bool update_jacobian = !memory.m_has_jacobian;
+            if (update_jacobian) {
+                updateJacobian(mv_X);
+                memory.m_jacobian.compute(mv_jac);
+                memory.m_closure_sp = m_closure_sp;
+                memory.m_has_jacobian = true;
+                memory.m_jacobian_updates++;
+            } else {
+                mv_f_unpert = mv_f;
+            }
+
+            mv_dX = memory.m_jacobian.solve(mv_f_unpert);
+            mv_X -= mv_dX;
+            updateFunction(mv_X);
+            double new_resnorm = mv_f.lpNorm<Eigen::Infinity>();
+            converged = (norm() < epsilon());
+
+            // Residual-reduction test of an old Jacobian, which is evaluated
+            // again at the next iteration if it fails; steps which increase
+            // the residual are taken back
+            if (!update_jacobian &&
+                new_resnorm > m_jac_reuse_ratio*resnorm)
+            {
+                memory.m_has_jacobian = false;
+                if (new_resnorm > resnorm) {
+                    mv_X += mv_dX;
+                    updateFunction(mv_X);
+                    new_resnorm = resnorm;
+                    converged = false;
+                }
+            }
+
+            resnorm = new_resnorm;
+            memory.mv_residuals.push_back(resnorm);
+        }
+
+        if (!converged && diagnostics() != NULL) {
+            diagnostics()->report(Diagnostics::NEWTON_NOT_CONVERGED)
+                << "Surface balance failed to converge after "
+                << memory.iterations() << " iterations with a residual of "
+                << resnorm;
+        }
+
+        memory.mv_solution = mv_X;
+        computePartialDensfromMoleFrac(mv_X, mv_rhoi);
+
+        // Setting the state again
+        m_wall_state.setWallState(
+            mv_rhoi.data(),
+            mv_Twall.data(),
+            set_state_with_rhoi_T);
+    }
+
 //==============================================================================
 
     double massBlowingRate()
@@ -213,6 +307,10 @@ SurfaceBalanceSolverMass(ARGS args)
         // Blowing Fluxes
         mv_f += mv_rhoi*mp_mass_blowing_rate->computeBlowingFlux()
         		/mv_rhoi.sum();
+
+        // The species balances always sum up to zero, so that one of them is
+        // replaced by the closure of the mole fractions
+        mv_f(m_closure_sp) = v_mole_frac.sum() - 1.;
     }
     
 //==============================================================================
@@ -318,6 +416,7 @@ private:
 
     DiffusionVelocityCalculator* mp_diff_vel_calc;
     MassBlowingRate* mp_mass_blowing_rate;
+    WallProductionRates* mp_prod_rates;
 
     // VARIABLES FOR SOLVER
     const size_t m_ns;
@@ -330,6 +429,8 @@ private:
     Eigen::VectorXd mv_f;
     Eigen::MatrixXd mv_jac;
     double m_pert;
+    double m_jac_reuse_ratio;
+    Eigen::VectorXd::Index m_closure_sp;
     double m_X_unpert;
     Eigen::VectorXd mv_f_unpert;
     Eigen::VectorXd mv_sep_mass_prod_rate;
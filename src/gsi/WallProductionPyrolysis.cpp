@@ -33,6 +33,7 @@
 #include "Transport.h"
 #include "Utilities.h"
 
+#include "WallProductionRates.h"
 #include "WallProductionTerms.h"
 #include "WallState.h"
 
@@ -61,7 +62,10 @@ public:
           m_mass_char(0.0),
           mv_el_comp(m_thermo.nElements()),
           mv_equil_comp(m_ns),
-          mp_Pwall(args.sp_pres)
+          mp_Pwall(args.sp_pres),
+          mp_prod_rates(args.sp_prod_rates),
+          m_T_equil(-1.0),
+          m_P_equil(-1.0)
     {
          XmlElement::const_iterator
              iter_xml_elem_data;
@@ -83,8 +87,6 @@ public:
 
          Composition m_comp(xml_comp);
          m_comp.getComposition(map, mv_el_comp.data());
-
-         mpv_wall_prod = args.sp_surf_prod;
     }
 
 //==============================================================================
@@ -95,37 +97,39 @@ public:
 
     void productionRate(VectorXd& v_pyrolysis_mass_source)
     {
-        v_pyrolysis_mass_source.setZero();
-        static VectorXd v_wrk(m_neqns);
-
         // At steady state the mass of the pyrolysis gases are proportional to
         // the mass of the blowing gases. The following part computes the mass
         // produced due to ablation reactions. From all the surface terms, only
-        // the ones with the tag "surface_chemistry" are considered.
+        // the ones with the tag "surface_chemistry" are considered.  Their
+        // rates are shared with the other users of the production terms.
         m_mass_char = 0.0;
-        for(int i_term = 0; i_term < mpv_wall_prod->size(); ++i_term)
+        for (int i_term = 0; i_term < mp_prod_rates->nTerms(); ++i_term)
         {
-        	v_wrk.setZero();
-            if(((*mpv_wall_prod)[i_term]->
-                getWallProductionTermTag()).compare("surface_chemistry") == 0)
-            {
-                (*mpv_wall_prod)[i_term]->productionRate(v_wrk);
-                m_mass_char += v_wrk.sum();
-            }
+            if (mp_prod_rates->tag(i_term).compare("surface_chemistry") == 0)
+                m_mass_char += mp_prod_rates->rate(i_term).sum();
         }
 
         const size_t pos_T_trans = 0;
         double Twall = m_wall_state.getWallT()(pos_T_trans);
 
-        m_thermo.equilibriumComposition(Twall, *mp_Pwall,
-                                        mv_el_comp.data(),
-                                        mv_equil_comp.data());
+        // The composition of the pyrolysis gases only depends on the wall
+        // temperature and pressure, not on the wall composition
+        if (Twall != m_T_equil || *mp_Pwall != m_P_equil) {
+            m_thermo.equilibriumComposition(Twall, *mp_Pwall,
+                                            mv_el_comp.data(),
+                                            mv_equil_comp.data());
 
-        // Units of v_equil_comp
-        m_thermo.convert<X_TO_Y>(mv_equil_comp.data(), mv_equil_comp.data());
+            // Units of v_equil_comp
+            m_thermo.convert<X_TO_Y>(
+                mv_equil_comp.data(), mv_equil_comp.data());
 
-        v_pyrolysis_mass_source = mv_equil_comp * m_phi * m_mass_char;
+            m_T_equil = Twall;
+            m_P_equil = *mp_Pwall;
+        }
 
+        v_pyrolysis_mass_source.setZero();
+        v_pyrolysis_mass_source.head(m_ns) =
+            mv_equil_comp * m_phi * m_mass_char;
     }
 
 //==============================================================================
@@ -136,7 +140,6 @@ private:
     Mutation::Thermodynamics::Thermodynamics& m_thermo;
 
     const WallState& m_wall_state;
-    std::vector<WallProductionTerms*>* mpv_wall_prod;
 
     const size_t m_ns;
     const size_t m_neqns;
@@ -147,9 +150,12 @@ private:
     double m_mass_char;
 
     const double* const mp_Pwall;
+    WallProductionRates* const mp_prod_rates;
 
     VectorXd mv_el_comp;
     VectorXd mv_equil_comp;
+    double m_T_equil;
+    double m_P_equil;
 
 };
 
@@ -0,0 +1,110 @@
+/**
+ * @file WallProductionRates.cpp
+ *
+ * @brief Implementation of WallProductionRates class.
+ */
+
+/*
+ * Copyright 2018 von Karman Institute for Fluid Dynamics (VKI)
+ *
+ * This file is part of MUlticomponent Thermodynamic And Transport
+ * properties for IONized gases in C++ (Mutation++) software package.
+ *
+ * Mutation++ is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as
+ * published by the Free Software Foundation, either version 3 of the
+ * License, or (at your option) any later version.
+ *
+ * Mutation++ is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with Mutation++.  If not, see
+ * <http://www.gnu.org/licenses/>.
+ */
+
+#include "WallProductionRates.h"
+#include "WallProductionTerms.h"
+#include "WallState.h"
+
+namespace Mutation {
+    namespace GasSurfaceInteraction {
+
+//==============================================================================
+
+WallProductionRates::WallProductionRates(
+    const WallState& wall_state,
+    const std::vector<WallProductionTerms*>& terms,
+    const size_t ns)
+    : m_wall_state(wall_state),
+      m_terms(terms),
+      m_ns(ns),
+      m_state_id(wall_state.stateId()),
+      mv_total(ns),
+      m_is_total_set(false)
+{ }
+
+//==============================================================================
+
+const std::string& WallProductionRates::tag(const int i) const
+{
+    return m_terms[i]->getWallProductionTermTag();
+}
+
+//==============================================================================
+
+const Eigen::VectorXd& WallProductionRates::rate(const int i)
+{
+    checkWallState();
+
+    if (!mv_is_rate_set[i]) {
+        // The term may itself ask for the rates of other terms
+        Eigen::VectorXd v_rate = Eigen::VectorXd::Zero(m_ns);
+        m_terms[i]->productionRate(v_rate);
+        mv_rates[i] = v_rate;
+        mv_is_rate_set[i] = true;
+    }
+
+    return mv_rates[i];
+}
+
+//==============================================================================
+
+const Eigen::VectorXd& WallProductionRates::total()
+{
+    checkWallState();
+
+    if (!m_is_total_set) {
+        mv_total.setZero();
+        for (int i = 0; i < m_terms.size(); ++i)
+            mv_total += rate(i);
+        m_is_total_set = true;
+    }
+
+    return mv_total;
+}
+
+//==============================================================================
+
+void WallProductionRates::checkWallState()
+{
+    // Terms are added after construction
+    if (mv_rates.size() != m_terms.size()) {
+        mv_rates.assign(m_terms.size(), Eigen::VectorXd::Zero(m_ns));
+        mv_is_rate_set.assign(m_terms.size(), false);
+        m_is_total_set = false;
+    }
+
+    if (m_state_id != m_wall_state.stateId()) {
+        m_state_id = m_wall_state.stateId();
+        mv_is_rate_set.assign(m_terms.size(), false);
+        m_is_total_set = false;
+    }
+}
+
+//==============================================================================
+
+    } // namespace GasSurfaceInteraction
+} // namespace Mutation
@@ -0,0 +1,91 @@
+/**
+ * @file WallProductionRates.h
+ *
+ * @brief Declaration of WallProductionRates class.
+ */
+
+/*
+ * Copyright 2018 von Karman Institute for Fluid Dynamics (VKI)
+ *
+ * This file is part of MUlticomponent Thermodynamic And Transport
+ * properties for IONized gases in C++ (Mutation++) software package.
+ *
+ * Mutation++ is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as
+ * published by the Free Software Foundation, either version 3 of the
+ * License, or (at your option) any later version.
+ *
+ * Mutation++ is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with Mutation++.  If not, see
+ * <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef WALL_PRODUCTION_RATES_H
+#define WALL_PRODUCTION_RATES_H
+
+#include <eigen3/Eigen/Dense>
+
+#include <string>
+#include <vector>
+
+namespace Mutation {
+    namespace GasSurfaceInteraction {
+
+class WallProductionTerms;
+class WallState;
+
+//==============================================================================
+/**
+ * Production rates of the wall production terms at the current wall state.
+ *
+ * The surface balance residual, the pyrolysis term and the mass blowing rate
+ * all need the rates of the same production terms.  Each rate is computed
+ * once the first time it is requested and reused until the wall state is set
+ * again, which happens once per residual of the surface balance solver.
+ */
+class WallProductionRates
+{
+public:
+    WallProductionRates(
+        const WallState& wall_state,
+        const std::vector<WallProductionTerms*>& terms,
+        const size_t ns);
+
+    /// Returns the number of production terms.
+    int nTerms() const { return m_terms.size(); }
+
+    /// Returns the tag of the i'th production term.
+    const std::string& tag(const int i) const;
+
+    /// Returns the mass production rates of the i'th term in kg/m^2-s.
+    const Eigen::VectorXd& rate(const int i);
+
+    /// Returns the mass production rates summed over all of the terms.
+    const Eigen::VectorXd& total();
+
+private:
+    /// Forgets the rates computed for a previous wall state.
+    void checkWallState();
+
+private:
+    const WallState& m_wall_state;
+    const std::vector<WallProductionTerms*>& m_terms;
+    const size_t m_ns;
+
+    unsigned long m_state_id;
+    std::vector<Eigen::VectorXd> mv_rates;
+    std::vector<bool> mv_is_rate_set;
+
+    Eigen::VectorXd mv_total;
+    bool m_is_total_set;
+};
+
+    } // namespace GasSurfaceInteraction
+} // namespace Mutation
+
+#endif // WALL_PRODUCTION_RATES_H
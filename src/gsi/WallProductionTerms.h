@@ -42,7 +42,7 @@ class GSIReaction;
 class GSIRateManager;
 class WallState;
 class SurfaceProperties;
-class WallProductionTerms;
+class WallProductionRates;
 
 /**
  * Structure which stores the necessary inputs for the
@@ -55,7 +55,7 @@ struct DataWallProductionTerms {
     const Mutation::Utilities::IO::XmlElement& s_node_prod_terms;
     const SurfaceProperties& s_surf_props;
     const WallState& s_wall_state;
-    std::vector<WallProductionTerms*>* sp_surf_prod;
+    WallProductionRates* sp_prod_rates;
     const double* const sp_pres;
 };
 
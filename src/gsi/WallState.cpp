@@ -50,8 +50,9 @@ WallState::WallState(
       m_set_state_rhoi_T(1),
       mv_rhoi(m_ns),
       mv_T(m_nT),
+      mv_surf_props_state(m_ns_surf),
       m_is_wall_state_set(false),
-      mv_surf_props_state(m_ns_surf)
+      m_state_id(0)
 {
 	initializeSurfState();
 }
@@ -113,18 +114,21 @@ void WallState::getWallState(
 //==============================================================================
 
 void WallState::setWallRhoi(const double* const p_rhoi){
+    m_state_id++;
 	mv_rhoi = Eigen::Map<const Eigen::VectorXd>(p_rhoi, m_ns);
 }
 
 //==============================================================================
 
 void WallState::setWallT(const double* const p_T){
+    m_state_id++;
     mv_T = Eigen::Map<const Eigen::VectorXd>(p_T, m_nT);
 }
 
 //==============================================================================
 
 void WallState::setWallP(const double& p){
+    m_state_id++;
     m_p = p;
 }
 
@@ -74,6 +74,12 @@ public:
 
     bool isWallStateSet() const{ return m_is_wall_state_set; }
 
+    /**
+     * Returns a number which changes every time the wall state is set, so
+     * that quantities computed from the wall state can be cached.
+     */
+    unsigned long stateId() const { return m_state_id; }
+
     // Below are FRC Properties!
     void getNdStateGasSurf(Eigen::VectorXd& v_wall_state) const;
 
@@ -96,6 +102,7 @@ private:
     Eigen::VectorXd mv_surf_props_state;
 
     bool m_is_wall_state_set;
+    unsigned long m_state_id;
 
 };
 
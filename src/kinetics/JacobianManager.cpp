@@ -34,6 +34,7 @@
 #include <iostream>
 
 typedef Mutation::Numerics::Equals<double>            Equals;
+typedef Mutation::Numerics::PlusEquals<double>        PlusEquals;
 typedef Mutation::Numerics::MinusEquals<double>       MinusEquals;
 typedef Mutation::Numerics::PlusEqualsTimes<double>   PlusEqualsTimes;
 typedef Mutation::Numerics::MinusEqualsTimes<double>  MinusEqualsTimes;
@@ -77,8 +78,9 @@ void ReactionStoich<Reactants, Products>::contributeToJacobian(
                 m_reacs[i] * work[m_reacs(j)];
         
         for (int j = 0; j < Products::nSpecies(); ++j)
-            sjac[m_reacs(i)*ns + m_prods(j)] -=
-                m_reacs[i] * work[m_prods(j)];
+            if (!isReactant(m_prods(j)))
+                sjac[m_reacs(i)*ns + m_prods(j)] -=
+                    m_reacs[i] * work[m_prods(j)];
     }
     
     for (int i = 0; i < Products::nSpecies(); ++i) {
@@ -87,13 +89,28 @@ void ReactionStoich<Reactants, Products>::contributeToJacobian(
                 m_prods[i] * work[m_reacs(j)];
                 
         for (int j = 0; j < Products::nSpecies(); ++j)
-            sjac[m_prods(i)*ns + m_prods(j)] +=
-                m_prods[i] * work[m_prods(j)];
+            if (!isReactant(m_prods(j)))
+                sjac[m_prods(i)*ns + m_prods(j)] +=
+                    m_prods[i] * work[m_prods(j)];
     }
 }
 
 //==============================================================================
 
+template <typename Reactants, typename Products>
+void ReactionStoich<Reactants, Products>::diffRop(
+    const double kf, const double kb, const double* const conc,
+    double* const drop, const size_t ns) const
+{
+    for (int i = 0; i < ns; ++i)
+        drop[i] = 0.0;
+
+    m_reacs.diffRR(kf, conc, drop, PlusEquals());
+    m_prods.diffRR(kb, conc, drop, MinusEquals());
+}
+
+//==============================================================================
+
 template <typename Reactants, typename Products>
 void ThirdbodyReactionStoich<Reactants, Products>::contributeToJacobian(
     const double kf, const double kb, const double* const conc, 
@@ -137,6 +154,25 @@ void ThirdbodyReactionStoich<Reactants, Products>::contributeToJacobian(
 
 //==============================================================================
 
+template <typename Reactants, typename Products>
+void ThirdbodyReactionStoich<Reactants, Products>::diffRop(
+    const double kf, const double kb, const double* const conc,
+    double* const drop, const size_t ns) const
+{
+    const double rr = m_reacs.rr(kf, conc) - m_prods.rr(kb, conc);
+    double tb = 0.0;
+
+    for (int i = 0; i < ns; ++i) {
+        drop[i] = mp_alpha[i] * rr;
+        tb += mp_alpha[i] * conc[i];
+    }
+
+    m_reacs.diffRR(kf, conc, drop, PlusEqualsTimes(tb));
+    m_prods.diffRR(kb, conc, drop, MinusEqualsTimes(tb));
+}
+
+//==============================================================================
+
 template <typename Reactants>
 void JacobianManager::addReactionStoich(
     JacStoichBase* p_reacs, JacStoichBase* p_prods, const StoichType type, 
@@ -147,6 +183,10 @@ void JacobianManager::addReactionStoich(
         for (int i = 0; i < m_thermo.nSpecies(); ++i)
             mp_work[i] = 1.0;
         
+        // Electrons are never thirdbodies (see ThirdbodyManager)
+        if (m_thermo.hasElectrons())
+            mp_work[0] = 0.0;
+        
         for (int i = 0; i < reaction.efficiencies().size(); ++i)
             mp_work[reaction.efficiencies()[i].first] = 
                 reaction.efficiencies()[i].second;
@@ -350,8 +390,27 @@ void JacobianManager::computeJacobian(
     }
 }
 
+//==============================================================================
+
+void JacobianManager::computeRopJacobian(
+    const double* const kf, const double* const kb, const double* const conc,
+    double* const rjac) const
+{
+    const size_t ns = m_thermo.nSpecies();
+    const size_t nr = m_reactions.size();
+
+    // Derivatives with respect to concentrations for each reaction
+    for (int i = 0; i < nr; ++i)
+        m_reactions[i]->diffRop(kf[i], kb[i], conc, rjac + i*ns, ns);
+
+    // Convert to derivatives with respect to species densities
+    for (int i = 0, index = 0; i < nr; ++i) {
+        for (int j = 0; j < ns; ++j, ++index)
+            rjac[index] /= m_thermo.speciesMw(j);
+    }
+}
+
 //==============================================================================
 
     } // namespace Kinetics
 } // namespace Mutation
-
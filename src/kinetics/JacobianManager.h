@@ -329,6 +329,10 @@ public:
     virtual void contributeToJacobian(
         const double kf, const double kb, const double* const conc, 
         double* const work, double* const sjac, const size_t ns) const = 0;
+
+    virtual void diffRop(
+        const double kf, const double kb, const double* const conc,
+        double* const drop, const size_t ns) const = 0;
 };
 
 /**
@@ -364,7 +368,27 @@ public:
         const double kf, const double kb, const double* const conc, 
         double* const work, double* const sjac, const size_t ns) const;
 
+    /**
+     * Computes the derivatives of this reaction's rate of progress with
+     * respect to the species concentrations.
+     */
+    void diffRop(
+        const double kf, const double kb, const double* const conc,
+        double* const drop, const size_t ns) const;
+
 protected:
+
+    /**
+     * Returns true if the given species is a reactant of this reaction.  Used
+     * to avoid counting twice the Jacobian columns of species which appear on
+     * both sides of the reaction (ie: the electron in electron impact
+     * reactions).
+     */
+    bool isReactant(const int sp) const {
+        for (int i = 0; i < Reactants::nSpecies(); ++i)
+            if (m_reacs(i) == sp) return true;
+        return false;
+    }
     
     Reactants m_reacs;
     Products  m_prods;
@@ -447,6 +471,14 @@ public:
     void contributeToJacobian(
         const double kf, const double kb, const double* const conc, 
         double* const work, double* const sjac, const size_t ns) const;
+
+    /**
+     * Computes the derivatives of this reaction's rate of progress with
+     * respect to the species concentrations.
+     */
+    void diffRop(
+        const double kf, const double kb, const double* const conc,
+        double* const drop, const size_t ns) const;
     
     friend void swap<Reactants, Products>(
         ThirdbodyReactionStoich<Reactants, Products>&,
@@ -501,6 +533,14 @@ public:
     void computeJacobian(
         const double* const kf, const double* const kb, 
         const double* const conc, double* const sjac) const;
+
+    /**
+     * Computes the Jacobian of the reaction rates of progress with respect to
+     * the species densities (nr x ns, row-major).
+     */
+    void computeRopJacobian(
+        const double* const kf, const double* const kb,
+        const double* const conc, double* const rjac) const;
     
 private:
     
@@ -30,6 +30,7 @@
 #include "Utilities.h"
 
 #include <eigen3/Eigen/Dense>
+#include <mutex>
 
 using namespace std;
 using namespace Eigen;
@@ -42,11 +43,36 @@ namespace Mutation {
 
 using Mutation::Thermodynamics::Thermodynamics;
 
+namespace {
+
+/**
+ * Holds the lock which serializes the parsing of mechanisms while the shared
+ * Arrhenius units are in use.  The default units are restored on entry and on
+ * exit, so a mechanism never sees the units of another one.
+ */
+class ArrheniusUnitsLock
+{
+public:
+    ArrheniusUnitsLock() : m_lock(mutex()) { Arrhenius::resetUnits(); }
+    ~ArrheniusUnitsLock() { Arrhenius::resetUnits(); }
+
+private:
+    static std::mutex& mutex() {
+        static std::mutex units_mutex;
+        return units_mutex;
+    }
+
+    std::lock_guard<std::mutex> m_lock;
+};
+
+} // namespace
+
 //==============================================================================
 
 Kinetics::Kinetics(
     const Thermodynamics& thermo, string mechanism)
     : m_name("unnamed"),
+      m_mechanism(mechanism),
       m_thermo(thermo),
       mp_rates(NULL),
       m_thirdbodies(thermo.nSpecies(), m_thermo.hasElectrons()),
@@ -56,19 +82,40 @@ Kinetics::Kinetics(
       mp_rop(NULL),
       mp_wdot(NULL)
 {
-    if (mechanism == "none")
+    // Read the mechanism file now, in case it is moved or the working
+    // directory changes before the reactions are needed
+    if (m_mechanism != "none") {
+        m_mechanism = databaseFileName(m_mechanism, "mechanisms");
+        m_mechanism_contents = IO::XmlDocument::readFile(m_mechanism);
+    }
+}
+
+//==============================================================================
+
+void Kinetics::initialize()
+{
+    try {
+        loadMechanism();
+    } catch (...) {
+        m_load_error = std::current_exception();
+    }
+}
+
+//==============================================================================
+
+void Kinetics::loadMechanism()
+{
+    if (m_mechanism == "none")
         return;
-    
-    // Get the path to the mechanism file
-    mechanism = databaseFileName(mechanism, "mechanisms");
 
     // Open the mechanism file as an XML document
-    IO::XmlDocument doc(mechanism);        
+    IO::XmlDocument doc(m_mechanism, m_mechanism_contents);
+    std::string().swap(m_mechanism_contents);
     IO::XmlElement root = doc.root();
     
     if (root.tag() != "mechanism") {
         throw FileParseError(doc.file(), root.line())
-            << "Root element in mechanism file " << mechanism
+            << "Root element in mechanism file " << m_mechanism
             << " is not of 'mechanism' type!";
     }
     
@@ -76,22 +123,28 @@ Kinetics::Kinetics(
     root.getAttribute("name", m_name, m_name);
 
     // Now loop over all of the reaction nodes and add each reaction to the
-    // corresponding data structure pieces
-    IO::XmlElement::const_iterator iter = root.begin();
-    for ( ; iter != root.end(); ++iter) {        
-        if (iter->tag() == "reaction")
-            addReaction(Reaction(*iter, thermo));
-        else if (iter->tag() == "arrhenius_units")
-            Arrhenius::setUnits(*iter);
+    // corresponding data structure pieces (mechanisms may be loaded by
+    // several threads, so the shared Arrhenius units are locked meanwhile)
+    {
+        ArrheniusUnitsLock units_lock;
+        IO::XmlElement::const_iterator iter = root.begin();
+        for ( ; iter != root.end(); ++iter) {
+            if (iter->tag() == "reaction")
+                addReaction(Reaction(*iter, m_thermo));
+            else if (iter->tag() == "arrhenius_units")
+                Arrhenius::setUnits(*iter);
+        }
     }
     
     // Setup the rate manager
-    mp_rates = new RateManager(thermo.nSpecies(), m_reactions);
+    mp_rates = new RateManager(m_thermo.nSpecies(), m_reactions);
     
     // Finally close the reaction mechanism
     closeReactions(true);
 }
 
+//==============================================================================
+
 Kinetics::~Kinetics()
 {
     if (mp_rates != NULL)
@@ -112,19 +165,20 @@ void Kinetics::addReaction(const Reaction& reaction)
 {
     // Add reaction to reaction list
     m_reactions.push_back(reaction);
+    const size_t i = m_reactions.size()-1;
     
     // Insert the reactants
-    m_reactants.addReaction(nReactions()-1, reaction.reactants());
+    m_reactants.addReaction(i, reaction.reactants());
     
     // Insert products
     if (reaction.isReversible())
-        m_rev_prods.addReaction(nReactions()-1, reaction.products());
+        m_rev_prods.addReaction(i, reaction.products());
     else
-        m_irr_prods.addReaction(nReactions()-1, reaction.products());
+        m_irr_prods.addReaction(i, reaction.products());
     
     // Add thirdbodies if necessary
     if (reaction.isThirdbody())
-        m_thirdbodies.addReaction(nReactions()-1, reaction.efficiencies());
+        m_thirdbodies.addReaction(i, reaction.efficiencies());
     
     // Add the reaction to the jacobian managaer
     m_jacobian.addReaction(reaction);
@@ -139,8 +193,8 @@ void Kinetics::closeReactions(const bool validate_mechanism)
     // Validate the mechanism
     if (validate_mechanism) {
         // Check for duplicate reactions
-        for (size_t i = 0; i < nReactions()-1; ++i)
-            for (size_t j = i+1; j < nReactions(); ++j)
+        for (size_t i = 0; i < m_reactions.size()-1; ++i)
+            for (size_t j = i+1; j < m_reactions.size(); ++j)
                 if (m_reactions[i] == m_reactions[j])
                     throw InvalidInputError("mechanism", m_name)
                         << "Reactions " << i+1 << " \""
@@ -150,7 +204,7 @@ void Kinetics::closeReactions(const bool validate_mechanism)
                         << "\" are identical.";
 
         // Check for elemental mass and charge conservation
-        for (size_t i = 0; i < nReactions(); ++i)
+        for (size_t i = 0; i < m_reactions.size(); ++i)
             if (!m_reactions[i].conservesChargeAndMass())
                 throw InvalidInputError("mechanism", m_name)
                     << "Reaction " << i+1 << " \"" << m_reactions[i].formula()
@@ -158,9 +212,9 @@ void Kinetics::closeReactions(const bool validate_mechanism)
     }
     
     // Allocate work arrays
-    mp_ropf  = new double [nReactions()];
-    mp_ropb  = new double [nReactions()];
-    mp_rop   = new double [nReactions()];
+    mp_ropf  = new double [m_reactions.size()];
+    mp_ropb  = new double [m_reactions.size()];
+    mp_rop   = new double [m_reactions.size()];
     mp_wdot  = new double [m_thermo.nSpecies()];
     
 }
@@ -391,17 +445,112 @@ void Kinetics::jacobianRho(double* const p_jac)
         mp_ropb[mp_rates->irrReactions()[i]] = 0.0;
     
     // Compute species concentrations (mol/m^3)
-    const double mix_conc = m_thermo.numberDensity() / NA;
-    const double* const p_x = m_thermo.X();
-    for (int i = 0; i < m_thermo.nSpecies(); ++i)
-        mp_rop[i] = p_x[i] * mix_conc;
+    ArrayXd conc =
+        (m_thermo.numberDensity() / NA) *
+        Map<const ArrayXd>(m_thermo.X(), m_thermo.nSpecies());
     
     // Compute the Jacobian matrix
-    m_jacobian.computeJacobian(mp_ropf, mp_ropb, mp_rop, p_jac);
+    m_jacobian.computeJacobian(mp_ropf, mp_ropb, conc.data(), p_jac);
+}
+
+//==============================================================================
+
+void Kinetics::jacobianTTv(double* const p_dT, double* const p_dTv)
+{
+    const int ns = m_thermo.nSpecies();
+    std::fill(p_dT, p_dT+ns, 0.0);
+    std::fill(p_dTv, p_dTv+ns, 0.0);
+
+    // Special case of no reactions
+    if (nReactions() == 0)
+        return;
+
+    // Compute species concentrations (mol/m^3)
+    ArrayXd conc =
+        (m_thermo.numberDensity() / NA) *
+        Map<const ArrayXd>(m_thermo.X(), m_thermo.nSpecies());
+
+    // Derivatives of the rates of progress (the forward rates of progress are
+    // replaced by the Tv derivatives once they are no longer needed)
+    forwardRatesOfProgress(conc.data(), mp_ropf);
+    backwardRatesOfProgress(conc.data(), mp_ropb);
+    mp_rates->updateDerivatives(m_thermo);
+
+    const double* const dlnkfdT  = mp_rates->dlnkfdT();
+    const double* const dlnkfdTv = mp_rates->dlnkfdTv();
+    const double* const dlnkbdT  = mp_rates->dlnkbdT();
+    const double* const dlnkbdTv = mp_rates->dlnkbdTv();
+
+    for (int i = 0; i < nReactions(); ++i) {
+        mp_rop[i]  = mp_ropf[i]*dlnkfdT[i]  - mp_ropb[i]*dlnkbdT[i];
+        mp_ropf[i] = mp_ropf[i]*dlnkfdTv[i] - mp_ropb[i]*dlnkbdTv[i];
+    }
+
+    // Sum all contributions from every reaction
+    m_reactants.decrSpecies(mp_rop, p_dT);
+    m_rev_prods.incrSpecies(mp_rop, p_dT);
+    m_irr_prods.incrSpecies(mp_rop, p_dT);
+
+    m_reactants.decrSpecies(mp_ropf, p_dTv);
+    m_rev_prods.incrSpecies(mp_ropf, p_dTv);
+    m_irr_prods.incrSpecies(mp_ropf, p_dTv);
+
+    // Multiply by species molecular weights
+    for (int i = 0; i < ns; ++i) {
+        p_dT[i]  *= m_thermo.speciesMw(i);
+        p_dTv[i] *= m_thermo.speciesMw(i);
+    }
+}
+
+//==============================================================================
+
+void Kinetics::ropJacobianRho(double* const p_jac)
+{
+    if (nReactions() == 0)
+        return;
+
+    // Update reaction rate coefficients
+    forwardRateCoefficients(mp_ropf);
+    backwardRateCoefficients(mp_ropb);
+
+    // Compute species concentrations (mol/m^3)
+    ArrayXd conc =
+        (m_thermo.numberDensity() / NA) *
+        Map<const ArrayXd>(m_thermo.X(), m_thermo.nSpecies());
+
+    m_jacobian.computeRopJacobian(mp_ropf, mp_ropb, conc.data(), p_jac);
+}
+
+//==============================================================================
+
+void Kinetics::ropJacobianTTv(double* const p_dT, double* const p_dTv)
+{
+    if (nReactions() == 0)
+        return;
+
+    // Compute species concentrations (mol/m^3)
+    ArrayXd conc =
+        (m_thermo.numberDensity() / NA) *
+        Map<const ArrayXd>(m_thermo.X(), m_thermo.nSpecies());
+
+    // At constant densities, the rates of progress only depend on
+    // temperature through the rate coefficients
+    forwardRatesOfProgress(conc.data(), mp_ropf);
+    backwardRatesOfProgress(conc.data(), mp_ropb);
+    mp_rates->updateDerivatives(m_thermo);
+
+    const double* const dlnkfdT  = mp_rates->dlnkfdT();
+    const double* const dlnkfdTv = mp_rates->dlnkfdTv();
+    const double* const dlnkbdT  = mp_rates->dlnkbdT();
+    const double* const dlnkbdTv = mp_rates->dlnkbdTv();
+
+    for (int i = 0; i < nReactions(); ++i) {
+        p_dT[i]  = mp_ropf[i]*dlnkfdT[i]  - mp_ropb[i]*dlnkbdT[i];
+        p_dTv[i] = mp_ropf[i]*dlnkfdTv[i] - mp_ropb[i]*dlnkbdTv[i];
+    }
 }
 
 //==============================================================================
 
     } // namespace Kinetics
 } // namespace Mutation
-
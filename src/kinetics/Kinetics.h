@@ -35,6 +35,9 @@
 #include "Reaction.h"
 #include "Thermodynamics.h"
 
+#include <exception>
+#include <mutex>
+
 namespace Mutation {
     namespace Kinetics {
 
@@ -55,7 +58,11 @@ public:
 
     /**
      * Constructor which takes a reference to a Thermodynamics object and the
-     * the full file name path to the mechanism data file.
+     * the full file name path to the mechanism data file.  The mechanism is
+     * only loaded when the reactions are first needed, once even if several
+     * threads need them at the same time.  The file itself is read by the
+     * constructor, but errors in the mechanism are only thrown then, and
+     * again on every later use.
      */
     Kinetics(
         const Mutation::Thermodynamics::Thermodynamics& thermo, 
@@ -70,6 +77,7 @@ public:
      * Returns the number of reactions in the mechanism.
      */
     size_t nReactions() const {
+        load();
         return m_reactions.size();
     }
     
@@ -78,6 +86,7 @@ public:
      * manager.
      */
     const std::vector<Reaction>& reactions() const {
+        load();
         return m_reactions;
     }
     
@@ -194,6 +203,42 @@ public:
      */
     void jacobianRho(double* const p_jac);
 
+    /**
+     * Fills the vectors p_dT and p_dTv with the derivatives of the species
+     * production rates with respect to the translational and vibrational
+     * temperatures at constant species densities
+     * \f[
+     * \frac{\partial \dot{\omega}_i}{\partial T}, \quad
+     * \frac{\partial \dot{\omega}_i}{\partial T_v}
+     * \f]
+     * assuming that the electron temperature is equal to the vibrational
+     * temperature.  For a single temperature model, the total derivative with
+     * respect to temperature is the sum of the two vectors.
+     *
+     * @param p_dT  - on return, derivatives with respect to T in kg/m^3-s-K
+     * @param p_dTv - on return, derivatives with respect to Tv in kg/m^3-s-K
+     */
+    void jacobianTTv(double* const p_dT, double* const p_dTv);
+
+    /**
+     * Fills the matrix p_jac with the Jacobian of the net rates of progress
+     * with respect to the species densities
+     * \f[
+     * J_{rj} = \frac{\partial \xi_r}{\partial \rho_j}
+     * \f]
+     * using row-major ordering (ie: J_{rj} = p_jac[r*ns + j]).
+     *
+     * @param p_jac  - on return, the nr x ns jacobian matrix \f$J_{rj}\f$
+     */
+    void ropJacobianRho(double* const p_jac);
+
+    /**
+     * Fills the vectors p_dT and p_dTv with the derivatives of the net rates
+     * of progress with respect to the translational and vibrational
+     * temperatures at constant species densities (see jacobianTTv()).
+     */
+    void ropJacobianTTv(double* const p_dT, double* const p_dTv);
+
     /**
      * Returns the change in some species quantity across each reaction.
      */
@@ -203,6 +248,20 @@ public:
 
 private:
 
+    /// Loads the reaction mechanism on first use.
+    void load() const {
+        std::call_once(
+            m_load_flag, &Kinetics::initialize, const_cast<Kinetics*>(this));
+        if (m_load_error)
+            std::rethrow_exception(m_load_error);
+    }
+
+    /// Loads the reaction mechanism, keeping any error for later uses.
+    void initialize();
+
+    /// Reads the reactions of the mechanism file.
+    void loadMechanism();
+
     /**
      * Adds a new reaction to the Kinetics object.
      */
@@ -220,6 +279,11 @@ private:
 private:
 
     std::string m_name;
+    std::string m_mechanism;
+    std::string m_mechanism_contents;
+
+    mutable std::once_flag m_load_flag;
+    std::exception_ptr m_load_error;
 
     const Mutation::Thermodynamics::Thermodynamics& m_thermo;
     
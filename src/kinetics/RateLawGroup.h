@@ -59,7 +59,7 @@ public:
     /**
      * Constructor.
      */
-    RateLawGroup() : m_last_t(-1.0) {}
+    RateLawGroup() : m_last_t(-1.0), m_dtdT(0.0), m_dtdTv(0.0) {}
 
     /**
      * Destructor.
@@ -92,6 +92,15 @@ public:
      */
     virtual void lnk(
         const Thermodynamics::StateModel* const p_state, double* const p_lnk) = 0;
+
+    /**
+     * Evaluates the derivatives of the log of all the rates in the group with
+     * respect to the translational and vibrational temperatures and stores
+     * them in the given vectors.
+     */
+    virtual void dlnkdT(
+        const Thermodynamics::StateModel* const p_state,
+        double* const p_dT, double* const p_dTv) = 0;
         
     /**
      * Computes \Delta G / RT for this rate law group and subtracts these values
@@ -108,6 +117,32 @@ public:
         m_reacs.decrReactions(p_g, p_r);
         m_prods.incrReactions(p_g, p_r);
     }
+
+    /**
+     * Computes the derivatives of \Delta G / RT with respect to the
+     * translational and vibrational temperatures, given the species H / RT at
+     * the temperature of this group, and subtracts them from the derivatives
+     * of the reactions in this group.  Must be called after dlnkdT().
+     */
+    void subtractDLnKeq(
+        size_t ns, const double* const p_h, double* const p_g,
+        double* const p_dT, double* const p_dTv) const
+    {
+        // d/dT [G_i/RT - ln(Patm/RT)] = (1 - H_i/RT) / T
+        if (m_dtdT != 0.0) {
+            for (int i = 0; i < ns; ++i)
+                p_g[i] = (p_h[i] - 1.0) / m_t * m_dtdT;
+            m_reacs.incrReactions(p_g, p_dT);
+            m_prods.decrReactions(p_g, p_dT);
+        }
+
+        if (m_dtdTv != 0.0) {
+            for (int i = 0; i < ns; ++i)
+                p_g[i] = (p_h[i] - 1.0) / m_t * m_dtdTv;
+            m_reacs.incrReactions(p_g, p_dTv);
+            m_prods.decrReactions(p_g, p_dTv);
+        }
+    }
     
 
 protected:
@@ -116,6 +151,11 @@ protected:
     /// in the lnk() function)
     double m_t;
     double m_last_t;
+
+    /// Derivatives of the group temperature with respect to the translational
+    /// and vibrational temperatures (should be set in the dlnkdT() function)
+    double m_dtdT;
+    double m_dtdTv;
     
     /// Stores the reactants for reactions that will use this rate law for the
     /// reverse direction
@@ -172,6 +212,27 @@ public:
         m_last_t = m_t;
     }
 
+    /**
+     * Evaluates the temperature derivatives of the log of all the rates in the
+     * group using the chain rule through the group temperature.
+     */
+    virtual void dlnkdT(
+        const Thermodynamics::StateModel* const p_state,
+        double* const p_dT, double* const p_dTv)
+    {
+        TSelectorType selector;
+        m_t = selector.getT(p_state);
+        selector.getDerivatives(p_state, m_dtdT, m_dtdTv);
+
+        const double invT = 1.0 / m_t;
+        for (int i = 0; i < m_rates.size(); ++i) {
+            const std::pair<size_t, RateLawType>& rate = m_rates[i];
+            const double dlnk = rate.second.getDLnRateDT(invT);
+            p_dT[rate.first]  = dlnk * m_dtdT;
+            p_dTv[rate.first] = dlnk * m_dtdTv;
+        }
+    }
+
 private:
 
     /// vector of rates to evaluate
@@ -275,6 +336,37 @@ public:
         }
     }
 
+    /**
+     * Computes the derivatives of the log of the rate coefficients in this
+     * collection with respect to the translational and vibrational
+     * temperatures.
+     */
+    void derivativesOfLogOfRateCoefficients(
+        const Thermodynamics::StateModel* const p_state,
+        double* const p_dT, double* const p_dTv)
+    {
+        GroupMap::iterator iter = m_group_map.begin();
+        for ( ; iter != m_group_map.end(); ++iter)
+            iter->second->dlnkdT(p_state, p_dT, p_dTv);
+    }
+
+    /**
+     * Subtracts the temperature derivatives of ln(keq) from the provided
+     * rate coefficient derivatives.
+     */
+    void subtractDLnKeq(
+        const Thermodynamics::Thermodynamics& thermo, double* const p_h,
+        double* const p_g, double* const p_dT, double* const p_dTv)
+    {
+        const size_t ns = thermo.nSpecies();
+        GroupMap::iterator iter = m_group_map.begin();
+        for ( ; iter != m_group_map.end(); ++iter) {
+            const RateLawGroup* p_group = iter->second;
+            thermo.speciesHOverRT(p_group->getT(), p_h);
+            p_group->subtractDLnKeq(ns, p_h, p_g, p_dT, p_dTv);
+        }
+    }
+
 private:
     
     /// Collection of RateLawGroup objects
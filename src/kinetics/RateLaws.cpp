@@ -68,6 +68,12 @@ std::vector<Units> _default_eunits() {
 std::vector<Units> Arrhenius::sm_aunits = std::vector<Units>();
 std::vector<Units> Arrhenius::sm_eunits = std::vector<Units>();
 
+void Arrhenius::resetUnits()
+{
+    sm_aunits = _default_aunits();
+    sm_eunits = _default_eunits();
+}
+
 Arrhenius::Arrhenius(const XmlElement& node, const int order)
 {
     assert( node.tag() == "arrhenius" );
@@ -56,7 +56,17 @@ class Arrhenius : public RateLaw
 {
 public:
 
+    /**
+     * Sets the units of A and Ea used by the Arrhenius rate laws loaded
+     * afterwards.  The units are shared by every mechanism, so callers must
+     * serialize loading and restore the defaults with resetUnits().
+     */
     static void setUnits(const Mutation::Utilities::IO::XmlElement& node);
+
+    /**
+     * Restores the default units (mol, m, s, K and J, mol, K).
+     */
+    static void resetUnits();
     
     Arrhenius(const Mutation::Utilities::IO::XmlElement& node, const int order);
     
@@ -78,6 +88,10 @@ public:
         return (k*invT*(m_n + m_temp*invT));
     }
 
+    inline double getDLnRateDT(const double invT) const {
+        return (invT*(m_n + m_temp*invT));
+    }
+
     double A() const { 
         return std::exp(m_lnA);
     }
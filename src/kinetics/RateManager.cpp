@@ -37,25 +37,34 @@ namespace Mutation {
 
 //==============================================================================
     
-// Simple macro to create a temperature selector type
-#define TEMPERATURE_SELECTOR(__NAME__,__T__)\
+// Simple macro to create a temperature selector type, along with the
+// derivatives of the selected temperature with respect to T and Tv (Te = Tv)
+#define TEMPERATURE_SELECTOR(__NAME__,__T__,__DTDT__,__DTDTV__)\
 class __NAME__\
 {\
 public:\
     inline double getT(const Thermodynamics::StateModel* const state) const {\
         return ( __T__ );\
     }\
+    inline void getDerivatives(\
+        const Thermodynamics::StateModel* const state,\
+        double& dtdT, double& dtdTv) const {\
+        dtdT  = ( __DTDT__ );\
+        dtdTv = ( __DTDTV__ );\
+    }\
 };
 
 /// Temperature selector which returns the current translational temperature
-TEMPERATURE_SELECTOR(TSelector, state->T())
+TEMPERATURE_SELECTOR(TSelector, state->T(), 1.0, 0.0)
 
 /// Temperature selector which returns the current electron temperature
 //TEMPERATURE_SELECTOR(TeSelector, std::min(state->Te(), 10000.0))
-TEMPERATURE_SELECTOR(TeSelector, state->Te())
+TEMPERATURE_SELECTOR(TeSelector, state->Te(), 0.0, 1.0)
 
 /// Temperature selector which returns the current value of sqrt(T*Tv)
-TEMPERATURE_SELECTOR(ParkSelector, std::sqrt(state->T()*state->Tv()))
+TEMPERATURE_SELECTOR(ParkSelector, std::sqrt(state->T()*state->Tv()),
+    0.5*std::sqrt(state->Tv()/state->T()),
+    0.5*std::sqrt(state->T()/state->Tv()))
 
 #undef TEMPERATURE_SELECTOR
 
@@ -114,19 +123,25 @@ SELECT_RATE_LAWS(EXCITATION_E,               ArrheniusTe,   ArrheniusTe)
 
 RateManager::RateManager(size_t ns, const std::vector<Reaction>& reactions)
     : m_ns(ns), m_nr(reactions.size()), mp_lnkf(NULL), mp_lnkb(NULL),
-      mp_gibbs(NULL)
+      mp_gibbs(NULL), mp_h(NULL), mp_dlnkfdT(NULL), mp_dlnkbdT(NULL),
+      mp_dlnkfdTv(NULL), mp_dlnkbdTv(NULL)
 {
     // Add all of the reactions' rate coefficients to the manager
     const size_t nr = reactions.size();
     for (size_t i = 0; i < m_nr; ++i)
         addReaction(i, reactions[i]);
     
-    // Allocate storage in one block for both rate coefficient arrays and
-    // species gibbs free energies 
-    const size_t block_size = 2*m_nr + ns;
+    // Allocate storage in one block for both rate coefficient arrays, their
+    // temperature derivatives, and species gibbs free energies and enthalpies
+    const size_t block_size = 6*m_nr + 2*ns;
     mp_lnkf  = new double [block_size];
     mp_lnkb  = mp_lnkf + m_nr;
     mp_gibbs = mp_lnkb + m_nr;
+    mp_h     = mp_gibbs + ns;
+    mp_dlnkfdT  = mp_h + ns;
+    mp_dlnkbdT  = mp_dlnkfdT + m_nr;
+    mp_dlnkfdTv = mp_dlnkbdT + m_nr;
+    mp_dlnkbdTv = mp_dlnkfdTv + m_nr;
     
     // Initialize the arrays to zero
     std::fill(mp_lnkf, mp_lnkf+block_size, 0.0);
@@ -237,6 +252,28 @@ void RateManager::update(const Thermodynamics::Thermodynamics& thermo)
     m_rate_groups.subtractLnKeq(thermo, mp_gibbs, mp_lnkb);
 }
 
+//==============================================================================
+
+void RateManager::updateDerivatives(
+    const Thermodynamics::Thermodynamics& thermo)
+{
+    // Evaluate the derivatives of all of the rate coefficients
+    m_rate_groups.derivativesOfLogOfRateCoefficients(
+        thermo.state(), mp_dlnkfdT, mp_dlnkfdTv);
+
+    // Copy derivatives which are the same as the forward ones
+    std::vector<size_t>::const_iterator iter = m_to_copy.begin();
+    for ( ; iter != m_to_copy.end(); ++iter) {
+        const size_t index = *iter;
+        mp_dlnkbdT[index]  = mp_dlnkfdT[index];
+        mp_dlnkbdTv[index] = mp_dlnkfdTv[index];
+    }
+
+    // Subtract dlnkeq(Tb)/dT from dlnkf(Tb)/dT to get dlnkb(Tb)/dT
+    m_rate_groups.subtractDLnKeq(
+        thermo, mp_h, mp_gibbs, mp_dlnkbdT, mp_dlnkbdTv);
+}
+
 //==============================================================================
 
     } // namespace Kinetics
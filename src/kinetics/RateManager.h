@@ -71,6 +71,37 @@ public:
      * forward temperature.
      */
     const double* const lnkb() { return mp_lnkb; }
+
+    /**
+     * Updates the derivatives of the log of the rate coefficients with
+     * respect to the translational and vibrational temperatures.  The
+     * electron temperature is assumed equal to the vibrational temperature.
+     */
+    void updateDerivatives(const Thermodynamics::Thermodynamics& thermo);
+
+    /**
+     * Returns a pointer to the derivatives of the log of the forward rate
+     * coefficients with respect to the translational temperature.
+     */
+    const double* dlnkfdT() { return mp_dlnkfdT; }
+
+    /**
+     * Returns a pointer to the derivatives of the log of the forward rate
+     * coefficients with respect to the vibrational temperature.
+     */
+    const double* dlnkfdTv() { return mp_dlnkfdTv; }
+
+    /**
+     * Returns a pointer to the derivatives of the log of the backward rate
+     * coefficients with respect to the translational temperature.
+     */
+    const double* dlnkbdT() { return mp_dlnkbdT; }
+
+    /**
+     * Returns a pointer to the derivatives of the log of the backward rate
+     * coefficients with respect to the vibrational temperature.
+     */
+    const double* dlnkbdTv() { return mp_dlnkbdTv; }
     
     /**
      * Returns the indices of irreversible reactions.
@@ -121,6 +152,16 @@ private:
     
     /// Storage for species Gibbs free energies
     double* mp_gibbs;
+
+    /// Storage for species enthalpies
+    double* mp_h;
+
+    /// Storage for the temperature derivatives of the log of the rate
+    /// coefficients (the backward arrays follow the forward ones)
+    double* mp_dlnkfdT;
+    double* mp_dlnkbdT;
+    double* mp_dlnkfdTv;
+    double* mp_dlnkbdTv;
     
     /// Stores the indices for which the forward and reverse temperature
     /// evaluations are equal
@@ -61,7 +61,16 @@ public:
     virtual ~Interpolator() { }
 
     /// Returns interpolated function.
-    virtual T operator() (const T& x) = 0;
+    virtual T operator() (const T& x) const = 0;
+
+    /**
+     * Interpolates the function at the n values p_x and stores the results in
+     * p_y.
+     */
+    virtual void evaluate(const T* const p_x, T* const p_y, int n) const {
+        for (int i = 0; i < n; ++i)
+            p_y[i] = (*this)(p_x[i]);
+    }
 }; // Interpolator
 
 //==============================================================================
@@ -69,6 +78,19 @@ public:
 /**
  * Chebyshev polynomial interpolator.
  *
+ * The polynomial is evaluated with the second (true) barycentric formula
+ * \f[
+ *     p(\eta) = \frac{\sum_j \frac{w_j}{\eta-\eta_j} y_j}
+ *                     {\sum_j \frac{w_j}{\eta-\eta_j}},
+ * \f]
+ * where the barycentric weights \f$w_j\f$ are computed once in the
+ * constructor, so that each evaluation is O(n) and does not modify the
+ * interpolator.
+ *
+ * Interpolators built on the same table of x values share the same nodes.
+ * Several of them can be evaluated at once by computing the basis() at x once
+ * and passing it to interpolate() for each interpolator.
+ *
  * Authors: J.B. Scoggins, translated from Matlab code of Fernando Miro Miro
  */
 template <typename T>
@@ -82,7 +104,7 @@ public:
     ChebyshevInterpolator(typename Interpolator<T>::ARGS args) :
         Interpolator<T>(args),
         m_points(args.n-1), m_eta_map(args.n-1), m_y_map(args.n-1),
-        m_phi(args.n-1)
+        m_weights(args.n-1)
     {
         const T* const x = args.x;
         const T* const y = args.y;
@@ -115,24 +137,85 @@ public:
             while (x[k] < x_map(i) && k < m_points) ++k;
             m_y_map(i) = (x_map(i) - x[k-1])*(y[k] - y[k-1])/(x[k] - x[k-1]) + y[k-1];
         }
+
+        // Barycentric weights, scaled by their largest magnitude (the scaling
+        // cancels in the barycentric formula) to avoid overflow
+        for (int j = 0; j < m_points; ++j) {
+            m_weights(j) = 1.0;
+            for (int k = 0; k < m_points; ++k)
+                if (k != j) m_weights(j) *= (m_eta_map(j) - m_eta_map(k));
+            m_weights(j) = 1.0/m_weights(j);
+        }
+        m_weights /= m_weights.abs().maxCoeff();
     }
 
     int nPoints() const { return m_points; }
 
     /// Interpolates the function at x.
-    T operator() (const T& x)
+    T operator() (const T& x) const
+    {
+        const T eta = mapToEta(x);
+
+        T num = 0.0, den = 0.0, c;
+        for (int j = 0; j < m_points; ++j) {
+            if (eta == m_eta_map(j))
+                return m_y_map(j);
+            c = m_weights(j)/(eta - m_eta_map(j));
+            num += c*m_y_map(j);
+            den += c;
+        }
+
+        return num/den;
+    }
+
+    /**
+     * Interpolates the function at the n values p_x and stores the results in
+     * p_y.
+     */
+    void evaluate(const T* const p_x, T* const p_y, int n) const
+    {
+        for (int i = 0; i < n; ++i)
+            p_y[i] = ChebyshevInterpolator<T>::operator()(p_x[i]);
+    }
+
+    /**
+     * Computes the nPoints() values of the Lagrange basis polynomials at x.
+     * The result can be passed to interpolate() of any interpolator built on
+     * the same x values as this one.
+     */
+    void basis(const T& x, T* const p_phi) const
     {
-        T eta = (m_mid - x)/(2.0*m_mid*x/m_max - x - m_mid);
+        const T eta = mapToEta(x);
 
+        T den = 0.0;
         for (int j = 0; j < m_points; ++j) {
-            m_phi(j) = 1.0;
-            for (int k = 0; k < j; ++k)
-                m_phi(j) *= (eta - m_eta_map(k))/(m_eta_map(j) - m_eta_map(k));
-            for (int k = j+1; k < m_points; ++k)
-                m_phi(j) *= (eta - m_eta_map(k))/(m_eta_map(j) - m_eta_map(k));
+            if (eta == m_eta_map(j)) {
+                std::fill(p_phi, p_phi+m_points, T(0));
+                p_phi[j] = 1.0;
+                return;
+            }
+            p_phi[j] = m_weights(j)/(eta - m_eta_map(j));
+            den += p_phi[j];
         }
 
-        return (m_phi*m_y_map).sum();
+        for (int j = 0; j < m_points; ++j)
+            p_phi[j] /= den;
+    }
+
+    /**
+     * Returns the interpolated function given the values of the Lagrange basis
+     * computed by basis().
+     */
+    T interpolate(const T* const p_phi) const
+    {
+        return (Eigen::Map<const ArrayType>(p_phi, m_points)*m_y_map).sum();
+    }
+
+private:
+
+    /// Maps x to the interpolation variable.
+    T mapToEta(const T& x) const {
+        return (m_mid - x)/(2.0*m_mid*x/m_max - x - m_mid);
     }
 
 private:
@@ -141,7 +224,7 @@ private:
 
     ArrayType m_eta_map;
     ArrayType m_y_map;
-    ArrayType m_phi;
+    ArrayType m_weights;
 
     T m_min;
     T m_mid;
@@ -167,7 +250,7 @@ public:
     int nPoints() const { return m_x.size(); }
 
     /// Interpolates the function at x.
-    T operator() (const T& x)
+    T operator() (const T& x) const
     {
         int i = 1;
         while (m_x[i] < x && i < m_x.size()-1) i++;
@@ -239,7 +322,7 @@ public:
     int nPoints() const { return m_points; }
 
     /// Interpolates the function at x.
-    T operator() (const T& x)
+    T operator() (const T& x) const
     {
         if (x >= m_x[m_points-1])
             return m_y[m_points-1];
@@ -29,6 +29,8 @@
 #ifndef _NUMERICS_NEWTON_SOLVER_
 #define _NUMERICS_NEWTON_SOLVER_
 
+#include "Diagnostics.h"
+
 #include <cassert>
 #include <typeinfo>
 #include <iostream>
@@ -71,6 +73,13 @@ public:
         assert(eps < 1.0);
         m_epsilon = eps;
     }
+
+    /**
+     * Returns the residual norm tolerance.
+     */
+    double epsilon() const {
+        return m_epsilon;
+    }
     
     /**
      * Set the maximum number of iterations to use.
@@ -78,6 +87,13 @@ public:
     void setMaxIterations(const unsigned int iters) {
         m_max_iter = iters;
     }
+
+    /**
+     * Returns the maximum number of iterations.
+     */
+    unsigned int maxIterations() const {
+        return m_max_iter;
+    }
     
     /**
      * Set the number of iterations to lag the Jacobian update.
@@ -94,12 +110,30 @@ public:
         m_conv_hist = hist;
     }
 
+    /**
+     * Sets the Diagnostics object to which failures to converge are reported.
+     */
+    void setDiagnostics(Diagnostics* const p_diagnostics) {
+        mp_diagnostics = p_diagnostics;
+    }
+
+protected:
+
+    /**
+     * Returns the Diagnostics object to which failures to converge are
+     * reported, or NULL.
+     */
+    Diagnostics* diagnostics() const {
+        return mp_diagnostics;
+    }
+
 private:
 
     unsigned int m_max_iter;
     unsigned int m_jacobian_lag;
     double       m_epsilon;
     bool         m_conv_hist;
+    Diagnostics* mp_diagnostics;
     
 };
 
@@ -110,7 +144,8 @@ NewtonSolver<T, Solver>::NewtonSolver()
     : m_max_iter(20),
       m_jacobian_lag(1),
       m_epsilon(1.0e-8),
-      m_conv_hist(false)
+      m_conv_hist(false),
+      mp_diagnostics(NULL)
 { }
 
 //==============================================================================
@@ -159,7 +194,11 @@ T& NewtonSolver<T, Solver>::solve(T& x)
             cout << ", relative residual = " << resnorm << endl;
     }
     
-    if (resnorm > m_epsilon && m_conv_hist) {
+    if (resnorm > m_epsilon && mp_diagnostics != NULL) {
+        mp_diagnostics->report(Diagnostics::NEWTON_NOT_CONVERGED)
+            << "Newton failed to converge after " << m_max_iter
+            << " iterations with a relative residual of " << resnorm;
+    } else if (resnorm > m_epsilon && m_conv_hist) {
         cout << "Newton failed to converge after " << m_max_iter
              << " iterations with a relative residual of " << resnorm << endl;
     }
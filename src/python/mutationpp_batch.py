@@ -0,0 +1,204 @@
+# Copyright 2018 von Karman Institute for Fluid Dynamics (VKI)
+#
+# This file is part of MUlticomponent Thermodynamic And Transport
+# properties for IONized gases in C++ (Mutation++) software package.
+#
+# Mutation++ is free software: you can redistribute it and/or modify
+# it under the terms of the GNU Lesser General Public License as
+# published by the Free Software Foundation, either version 3 of the
+# License, or (at your option) any later version.
+#
+# Mutation++ is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+# GNU Lesser General Public License for more details.
+#
+# You should have received a copy of the GNU Lesser General Public
+# License along with Mutation++.  If not, see
+# <http://www.gnu.org/licenses/>.
+
+"""NumPy bindings to the C batch API of Mutation++ (see cbatch.h).
+
+Arrays of states are passed to the library without being copied, whatever
+their memory layout, as long as they hold float64 values.  The states are
+evaluated in C++, in parallel when the library is built with ENABLE_OPENMP,
+and ctypes releases the GIL for the duration of each call.
+
+Example:
+
+    from mutationpp_batch import BatchMixture
+    mix = BatchMixture('air_11', 'ChemNonEqTTv')
+    values, failed = mix.evaluate('T,mu,X', states)   # states is N x ns+2
+
+The library is found with the MPP_LIBRARY environment variable if it is set,
+or else on the library search path.
+"""
+
+import ctypes
+import ctypes.util
+import os
+import sys
+
+import numpy as np
+
+
+_c_double_p = ctypes.POINTER(ctypes.c_double)
+_c_ptrdiff = ctypes.c_ssize_t
+
+
+def _load_library():
+    path = os.environ.get('MPP_LIBRARY')
+    if not path:
+        path = ctypes.util.find_library('mutation++')
+    if not path:
+        path = ('libmutation++.dylib' if sys.platform == 'darwin'
+                else 'libmutation++.so')
+    lib = ctypes.CDLL(path)
+
+    lib.mpp_batch_create.restype = ctypes.c_void_p
+    lib.mpp_batch_create.argtypes = [
+        ctypes.c_char_p, ctypes.c_char_p, ctypes.c_int]
+    lib.mpp_batch_destroy.restype = None
+    lib.mpp_batch_destroy.argtypes = [ctypes.c_void_p]
+    lib.mpp_batch_error.restype = ctypes.c_char_p
+    lib.mpp_batch_error.argtypes = []
+    for name in ['nspecies', 'ninputs', 'nthreads']:
+        function = getattr(lib, 'mpp_batch_' + name)
+        function.restype = ctypes.c_int
+        function.argtypes = [ctypes.c_void_p]
+    lib.mpp_batch_species_name.restype = ctypes.c_char_p
+    lib.mpp_batch_species_name.argtypes = [ctypes.c_void_p, ctypes.c_int]
+    lib.mpp_batch_nvalues.restype = ctypes.c_int
+    lib.mpp_batch_nvalues.argtypes = [ctypes.c_void_p, ctypes.c_char_p]
+    lib.mpp_batch_evaluate.restype = _c_ptrdiff
+    lib.mpp_batch_evaluate.argtypes = [
+        ctypes.c_void_p, ctypes.c_char_p, ctypes.c_int, _c_ptrdiff,
+        _c_double_p, _c_ptrdiff, _c_ptrdiff,
+        _c_double_p, _c_ptrdiff, _c_ptrdiff]
+    lib.mpp_batch_equilibrate.restype = _c_ptrdiff
+    lib.mpp_batch_equilibrate.argtypes = [
+        ctypes.c_void_p, _c_ptrdiff, _c_double_p, _c_ptrdiff,
+        _c_double_p, _c_ptrdiff, _c_double_p, _c_ptrdiff, _c_ptrdiff]
+    return lib
+
+
+_lib = None
+
+
+def _library():
+    global _lib
+    if _lib is None:
+        _lib = _load_library()
+    return _lib
+
+
+def _error():
+    return RuntimeError(_library().mpp_batch_error().decode().strip())
+
+
+def _input(array, ndim):
+    """Returns the array as float64 values, copying it only if its dtype or
+    strides cannot be passed to the library as they are."""
+    array = np.asarray(array, dtype=np.float64)
+    if array.ndim != ndim:
+        raise ValueError('expected a %d-dimensional array' % ndim)
+    if any(s % array.itemsize != 0 for s in array.strides):
+        array = np.ascontiguousarray(array)
+    return array
+
+
+def _output(out, shape):
+    """Returns a new C ordered array, or checks that out can be written in
+    place."""
+    if out is None:
+        return np.empty(shape)
+    if (not isinstance(out, np.ndarray) or out.dtype != np.float64 or
+            out.shape != shape or not out.flags.writeable or
+            any(s % out.itemsize != 0 for s in out.strides)):
+        raise ValueError('out must be a writeable float64 array of shape %s'
+                         % (shape,))
+    return out
+
+
+def _pointer(array):
+    return array.ctypes.data_as(_c_double_p)
+
+
+def _strides(array):
+    return [s // array.itemsize for s in array.strides]
+
+
+class BatchMixture(object):
+    """A mixture loaded in the Mutation++ library, which evaluates properties
+    for arrays of states.
+
+    A state is the set of values given to Mixture::setState(), for instance
+    the species densities followed by the temperatures for the default
+    variable set of the ChemNonEq1T and ChemNonEqTTv state models.
+    """
+
+    def __init__(self, mixture, state_model=None, threads=0):
+        """Loads the mixture with the given state model (or the default one
+        of the mixture), for evaluations with the given number of threads (or
+        the OpenMP default)."""
+        lib = _library()
+        self._handle = lib.mpp_batch_create(
+            mixture.encode(), (state_model or '').encode(), threads)
+        if not self._handle:
+            raise _error()
+
+        self.species = [
+            lib.mpp_batch_species_name(self._handle, i).decode()
+            for i in range(lib.mpp_batch_nspecies(self._handle))]
+        self.n_inputs = lib.mpp_batch_ninputs(self._handle)
+        self.n_threads = lib.mpp_batch_nthreads(self._handle)
+
+    def __del__(self):
+        if getattr(self, '_handle', None):
+            _library().mpp_batch_destroy(self._handle)
+            self._handle = None
+
+    def n_values(self, properties):
+        """Returns the number of values computed for each state by the comma
+        separated list of properties."""
+        n = _library().mpp_batch_nvalues(self._handle, properties.encode())
+        if n < 0:
+            raise _error()
+        return n
+
+    def evaluate(self, properties, states, vars=1, out=None):
+        """Evaluates the comma separated list of properties (as listed by
+        mppbatch -h) for each row of the N x n_inputs array of states.
+
+        Returns the N x n_values(properties) array of values, which is out if
+        it is given, and the number of states which could not be set, whose
+        values are NaN.
+        """
+        states = _input(states, 2)
+        if states.shape[1] != self.n_inputs:
+            raise ValueError('states must have %d columns' % self.n_inputs)
+        values = _output(
+            out, (states.shape[0], self.n_values(properties)))
+
+        failed = _library().mpp_batch_evaluate(
+            self._handle, properties.encode(), vars, states.shape[0],
+            _pointer(states), *(_strides(states) + [_pointer(values)] +
+                                _strides(values)))
+        if failed < 0:
+            raise _error()
+        return values, failed
+
+    def equilibrate(self, T, P, out=None):
+        """Returns the N x n_species array of equilibrium mole fractions at
+        the N temperatures T and pressures P (which are broadcast against each
+        other), which is out if it is given, and the number of states which
+        could not be equilibrated, whose mole fractions are NaN."""
+        T, P = np.broadcast_arrays(
+            _input(T, np.ndim(T)), _input(P, np.ndim(P)))
+        T, P = _input(T.reshape(-1), 1), _input(P.reshape(-1), 1)
+        X = _output(out, (T.shape[0], len(self.species)))
+
+        failed = _library().mpp_batch_equilibrate(
+            self._handle, T.shape[0], _pointer(T), _strides(T)[0],
+            _pointer(P), _strides(P)[0], _pointer(X), *_strides(X))
+        return X, failed
@@ -0,0 +1,325 @@
+/**
+ * @file BprimeTable.cpp
+ *
+ * @brief Implementation of the BprimeTable class.
+ */
+
+/*
+ * Copyright 2014-2018 von Karman Institute for Fluid Dynamics (VKI)
+ *
+ * This file is part of MUlticomponent Thermodynamic And Transport
+ * properties for IONized gases in C++ (Mutation++) software package.
+ *
+ * Mutation++ is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as
+ * published by the Free Software Foundation, either version 3 of the
+ * License, or (at your option) any later version.
+ *
+ * Mutation++ is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with Mutation++.  If not, see
+ * <http://www.gnu.org/licenses/>.
+ */
+
+#include "BprimeTable.h"
+#include "Errors.h"
+#include "Thermodynamics.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <fstream>
+
+namespace Mutation {
+    namespace Thermodynamics {
+
+// Identifies B' table files
+static const char BPRIME_MAGIC[8] = {'M','P','P','B','P','R','M','\0'};
+
+// Increment when the layout of the file changes
+static const int BPRIME_VERSION = 1;
+
+//==============================================================================
+
+/**
+ * Finds the interval i of the sorted grid x containing v and the fraction w of
+ * the interval at v.  Values outside of the grid are clamped to its bounds.
+ */
+static void locate(
+    const std::vector<double>& x, double v, int& i, double& w)
+{
+    const int n = x.size();
+    if (n < 2 || v <= x[0]) {
+        i = 0; w = 0.0;
+        return;
+    }
+    if (v >= x[n-1]) {
+        i = n-2; w = 1.0;
+        return;
+    }
+
+    i = std::upper_bound(x.begin(), x.end(), v) - x.begin() - 1;
+    w = (v - x[i]) / (x[i+1] - x[i]);
+}
+
+//==============================================================================
+
+/**
+ * Returns the slope of a monotone cubic Hermite interpolant at node k of the
+ * grid x, where the value at node j is y[j*stride].  Uses the same slopes as
+ * Numerics::MCHInterpolator.
+ */
+static double monotoneSlope(
+    const std::vector<double>& x, const double* const y, int stride, int k)
+{
+    const int n = x.size();
+    if (k == 0)
+        return (y[stride] - y[0]) / (x[1] - x[0]);
+    if (k == n-1)
+        return (y[k*stride] - y[(k-1)*stride]) / (x[k] - x[k-1]);
+
+    const double h0 = x[k] - x[k-1];
+    const double h1 = x[k+1] - x[k];
+    const double m0 = (y[k*stride] - y[(k-1)*stride]) / h0;
+    const double m1 = (y[(k+1)*stride] - y[k*stride]) / h1;
+
+    if (m0*m1 <= 0.0)
+        return 0.0;
+
+    const double c = h0 + h1;
+    return 3.0*c / ((c + h1)/m0 + (c + h0)/m1);
+}
+
+//==============================================================================
+
+BprimeTable::BprimeTable(
+    const Thermodynamics& thermo, const std::vector<double>& T,
+    const std::vector<double>& P, const std::vector<double>& Bg) :
+    m_T(T), m_P(P), m_Bg(Bg)
+{
+    if (m_T.empty() || m_P.empty() || m_Bg.empty())
+        throw InvalidInputError("B' table size", 0)
+            << "Empty temperature, pressure, or B'g grid.";
+
+    for (int i = 0; i < thermo.nSpecies(); ++i)
+        m_species.push_back(thermo.speciesName(i));
+
+    initialize();
+}
+
+//==============================================================================
+
+BprimeTable::BprimeTable(const std::string& file_name)
+{
+    std::ifstream file(file_name.c_str(), std::ios::binary);
+    if (!file.is_open())
+        throw FileNotFoundError(file_name);
+
+    char magic[8];
+    int version, sizes[4];
+    file.read(magic, sizeof(magic));
+    file.read(reinterpret_cast<char*>(&version), sizeof(version));
+    file.read(reinterpret_cast<char*>(sizes), sizeof(sizes));
+
+    if (!file || std::memcmp(magic, BPRIME_MAGIC, sizeof(magic)) != 0)
+        throw FileParseError(file_name, 0) << "Not a B' table file.";
+    if (version != BPRIME_VERSION)
+        throw FileParseError(file_name, 0)
+            << "Unsupported B' table version " << version << ".";
+
+    // Check the grid sizes against the length of the file before allocating
+    // anything, so that a corrupted header is reported as such
+    const std::streamoff header = file.tellg();
+    file.seekg(0, std::ios::end);
+    const double nbytes = double(file.tellg() - header);
+    file.seekg(header);
+
+    double nvalues = sizes[0] + sizes[1] + sizes[2];
+    nvalues += double(sizes[0])*sizes[1]*sizes[2]*(sizes[3] + 2.0);
+    if (*std::min_element(sizes, sizes+4) <= 0 ||
+        nvalues*sizeof(double) + sizes[3]*sizeof(int) > nbytes)
+        throw FileParseError(file_name, 0)
+            << "Bad B' table sizes " << sizes[0] << " x " << sizes[1]
+            << " x " << sizes[2] << " with " << sizes[3] << " species.";
+
+    m_T.resize(sizes[0]);
+    m_P.resize(sizes[1]);
+    m_Bg.resize(sizes[2]);
+    m_species.resize(sizes[3]);
+
+    for (int i = 0; i < sizes[3]; ++i) {
+        int length;
+        file.read(reinterpret_cast<char*>(&length), sizeof(length));
+        if (!file || length < 0 || length > 256)
+            throw FileParseError(file_name, 0) << "Bad species name.";
+        m_species[i].resize(length);
+        file.read(&m_species[i][0], length);
+    }
+
+    file.read(reinterpret_cast<char*>(&m_T[0]), m_T.size()*sizeof(double));
+    file.read(reinterpret_cast<char*>(&m_P[0]), m_P.size()*sizeof(double));
+    file.read(reinterpret_cast<char*>(&m_Bg[0]), m_Bg.size()*sizeof(double));
+
+    initialize();
+    file.read(
+        reinterpret_cast<char*>(&m_data[0]), m_data.size()*sizeof(double));
+
+    if (!file)
+        throw FileParseError(file_name, 0) << "B' table file is truncated.";
+}
+
+//==============================================================================
+
+void BprimeTable::initialize()
+{
+    m_lnP.resize(m_P.size());
+    for (int i = 0; i < m_P.size(); ++i)
+        m_lnP[i] = std::log(m_P[i]);
+
+    m_nv = m_species.size() + 2;
+    m_data.assign(m_T.size()*m_P.size()*m_Bg.size()*m_nv, 0.0);
+}
+
+//==============================================================================
+
+void BprimeTable::compute(
+    Thermodynamics& thermo, const double* const p_Yke,
+    const double* const p_Ykg, int ip, int ib)
+{
+    if (thermo.nSpecies() != nSpecies())
+        throw InvalidInputError("number of species", thermo.nSpecies())
+            << "The B' table was created for " << nSpecies() << " species.";
+
+    // Successive temperatures use the same elemental composition, so that each
+    // equilibrium calculation can continue from the previous solution
+    MultiPhaseEquilSolver* const p_equil = thermo.equilSolver();
+    const bool warm_start = p_equil->warmStart();
+    p_equil->setWarmStart(true);
+
+    double* p_values;
+    for (int it = 0; it < m_T.size(); ++it) {
+        p_values = &m_data[offset(it, ip, ib)];
+        thermo.surfaceMassBalance(
+            p_Yke, p_Ykg, m_T[it], m_P[ip], m_Bg[ib], p_values[0],
+            p_values[1], p_values+2);
+    }
+
+    p_equil->setWarmStart(warm_start);
+}
+
+//==============================================================================
+
+void BprimeTable::save(const std::string& file_name) const
+{
+    std::ofstream file(file_name.c_str(), std::ios::binary);
+    if (!file.is_open())
+        throw FileNotFoundError(file_name);
+
+    const int sizes[4] = {
+        int(m_T.size()), int(m_P.size()), int(m_Bg.size()),
+        int(m_species.size()) };
+
+    file.write(BPRIME_MAGIC, sizeof(BPRIME_MAGIC));
+    file.write(
+        reinterpret_cast<const char*>(&BPRIME_VERSION), sizeof(BPRIME_VERSION));
+    file.write(reinterpret_cast<const char*>(sizes), sizeof(sizes));
+
+    for (int i = 0; i < m_species.size(); ++i) {
+        const int length = m_species[i].size();
+        file.write(reinterpret_cast<const char*>(&length), sizeof(length));
+        file.write(m_species[i].c_str(), length);
+    }
+
+    file.write(
+        reinterpret_cast<const char*>(&m_T[0]), m_T.size()*sizeof(double));
+    file.write(
+        reinterpret_cast<const char*>(&m_P[0]), m_P.size()*sizeof(double));
+    file.write(
+        reinterpret_cast<const char*>(&m_Bg[0]), m_Bg.size()*sizeof(double));
+    file.write(
+        reinterpret_cast<const char*>(&m_data[0]),
+        m_data.size()*sizeof(double));
+}
+
+//==============================================================================
+
+void BprimeTable::lookup(
+    double T, double P, double Bg, double& Bc, double& hw,
+    double* const p_Xw, Interpolation scheme) const
+{
+    // Only interpolate the mole fractions if they are needed
+    const int nv = (p_Xw == NULL ? 2 : m_nv);
+    std::vector<double> values(nv, 0.0);
+
+    int it, ip, ib;
+    double wt, wp, wb;
+    locate(m_T, T, it, wt);
+    locate(m_lnP, std::log(P), ip, wp);
+    locate(m_Bg, Bg, ib, wb);
+
+    // Bilinear combination of the temperature lines surrounding (P, Bg)
+    const int np = (m_P.size() > 1 ? 2 : 1);
+    const int nb = (m_Bg.size() > 1 ? 2 : 1);
+    for (int j = 0; j < nb; ++j) {
+        const double fb = (j == 0 ? 1.0 - wb : wb);
+        for (int i = 0; i < np; ++i) {
+            const double f = fb * (i == 0 ? 1.0 - wp : wp);
+            if (f > 0.0)
+                interpolateT(it, wt, ip+i, ib+j, f, nv, scheme, &values[0]);
+        }
+    }
+
+    Bc = values[0];
+    hw = values[1];
+    if (p_Xw != NULL)
+        std::copy(values.begin()+2, values.end(), p_Xw);
+}
+
+//==============================================================================
+
+void BprimeTable::interpolateT(
+    int it, double wt, int ip, int ib, double weight, int nv,
+    Interpolation scheme, double* const p_values) const
+{
+    const double* const p_line = &m_data[offset(0, ip, ib)];
+    const double* const y0 = p_line + it*m_nv;
+
+    if (m_T.size() < 2) {
+        for (int k = 0; k < nv; ++k)
+            p_values[k] += weight*y0[k];
+        return;
+    }
+
+    const double* const y1 = y0 + m_nv;
+
+    if (scheme == LINEAR) {
+        for (int k = 0; k < nv; ++k)
+            p_values[k] += weight*(y0[k] + wt*(y1[k] - y0[k]));
+        return;
+    }
+
+    // Cubic Hermite basis functions
+    const double h   = m_T[it+1] - m_T[it];
+    const double t2  = wt*wt;
+    const double t3  = t2*wt;
+    const double h00 = 2.0*t3 - 3.0*t2 + 1.0;
+    const double h10 = t3 - 2.0*t2 + wt;
+    const double h01 = 3.0*t2 - 2.0*t3;
+    const double h11 = t3 - t2;
+
+    for (int k = 0; k < nv; ++k) {
+        const double d0 = monotoneSlope(m_T, p_line+k, m_nv, it);
+        const double d1 = monotoneSlope(m_T, p_line+k, m_nv, it+1);
+        p_values[k] += weight*(
+            h00*y0[k] + h10*h*d0 + h01*y1[k] + h11*h*d1);
+    }
+}
+
+//==============================================================================
+
+    } // namespace Thermodynamics
+} // namespace Mutation
@@ -0,0 +1,198 @@
+/**
+ * @file BprimeTable.h
+ *
+ * @brief Declaration of the BprimeTable class.
+ */
+
+/*
+ * Copyright 2014-2018 von Karman Institute for Fluid Dynamics (VKI)
+ *
+ * This file is part of MUlticomponent Thermodynamic And Transport
+ * properties for IONized gases in C++ (Mutation++) software package.
+ *
+ * Mutation++ is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as
+ * published by the Free Software Foundation, either version 3 of the
+ * License, or (at your option) any later version.
+ *
+ * Mutation++ is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with Mutation++.  If not, see
+ * <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef THERMO_BPRIME_TABLE_H
+#define THERMO_BPRIME_TABLE_H
+
+#include <cstddef>
+#include <string>
+#include <vector>
+
+namespace Mutation {
+    namespace Thermodynamics {
+
+class Thermodynamics;
+
+/**
+ * Table of the solutions of the surface mass balance, \f$B'_c\f$, the wall
+ * enthalpy \f$h_w\f$, and the wall species mole fractions, on a grid of wall
+ * temperatures, pressures and pyrolysis blowing rates \f$B'_g\f$.
+ *
+ * A table is generated one temperature line at a time with compute(), which
+ * solves the surface mass balance at each temperature of the line using
+ * Thermodynamics::surfaceMassBalance() with warm-started equilibrium
+ * calculations.  Lines are independent, so they can be computed in parallel
+ * with one Mixture per thread (see the @ref bprime tool).  The table can then
+ * be saved to a compact binary file, and loaded again to interpolate the
+ * solution without any mixture, for instance in the boundary condition of an
+ * ablation solver.
+ *
+ * Lookups are linear in \f$\ln p\f$ and \f$B'_g\f$, and either linear or
+ * monotone cubic in temperature.  Values outside of the table are clamped to
+ * the table bounds.
+ *
+ * <b>Example usage:</b>
+ * @code
+ * BprimeTable table("tacot.bprime");
+ * double Bc, hw;
+ * table.lookup(Tw, pw, Bg, Bc, hw, NULL, BprimeTable::MONOTONE_CUBIC);
+ * @endcode
+ */
+class BprimeTable
+{
+public:
+
+    /// Interpolation schemes in temperature.
+    enum Interpolation {
+        LINEAR,
+        MONOTONE_CUBIC
+    };
+
+    /**
+     * Creates an empty table on the given grid, for the species of the given
+     * mixture.  The grid values must be given in increasing order.
+     */
+    BprimeTable(
+        const Thermodynamics& thermo, const std::vector<double>& T,
+        const std::vector<double>& P, const std::vector<double>& Bg);
+
+    /**
+     * Loads a table from a file written by save().
+     */
+    explicit BprimeTable(const std::string& file_name);
+
+    /**
+     * Solves the surface mass balance at each temperature of the line given by
+     * the pressure index ip and the \f$B'_g\f$ index ib.  The mixture must
+     * contain the same species as the one given to the constructor.
+     *
+     * @param thermo  mixture used to solve the surface mass balance
+     * @param p_Yke   element mass fractions of the boundary layer edge
+     * @param p_Ykg   element mass fractions of the pyrolysis gas
+     * @param ip      pressure index
+     * @param ib      \f$B'_g\f$ index
+     */
+    void compute(
+        Thermodynamics& thermo, const double* const p_Yke,
+        const double* const p_Ykg, int ip, int ib);
+
+    /**
+     * Writes the table to a binary file.  The file stores values in the native
+     * byte order of the machine.
+     */
+    void save(const std::string& file_name) const;
+
+    /**
+     * Interpolates the table at the given wall temperature in K, pressure in
+     * Pa and \f$B'_g\f$.
+     *
+     * @param Bc      on return, the char blowing rate \f$B'_c\f$
+     * @param hw      on return, the wall enthalpy in J/kg
+     * @param p_Xw    (optional) on return, the wall species mole fractions
+     * @param scheme  interpolation scheme in temperature
+     */
+    void lookup(
+        double T, double P, double Bg, double& Bc, double& hw,
+        double* const p_Xw = NULL, Interpolation scheme = LINEAR) const;
+
+    /// Number of temperatures in the table.
+    int nTemperatures() const { return m_T.size(); }
+
+    /// Number of pressures in the table.
+    int nPressures() const { return m_P.size(); }
+
+    /// Number of pyrolysis blowing rates in the table.
+    int nBlowingRates() const { return m_Bg.size(); }
+
+    /// Number of species in the wall compositions.
+    int nSpecies() const { return m_species.size(); }
+
+    /// Temperature grid in K.
+    const std::vector<double>& temperatures() const { return m_T; }
+
+    /// Pressure grid in Pa.
+    const std::vector<double>& pressures() const { return m_P; }
+
+    /// \f$B'_g\f$ grid.
+    const std::vector<double>& blowingRates() const { return m_Bg; }
+
+    /// Name of species i.
+    const std::string& speciesName(int i) const { return m_species[i]; }
+
+    /// Tabulated \f$B'_c\f$ at the given grid indices.
+    double Bc(int it, int ip, int ib) const {
+        return m_data[offset(it, ip, ib)];
+    }
+
+    /// Tabulated wall enthalpy in J/kg at the given grid indices.
+    double hw(int it, int ip, int ib) const {
+        return m_data[offset(it, ip, ib)+1];
+    }
+
+    /// Tabulated wall mole fractions at the given grid indices.
+    const double* Xw(int it, int ip, int ib) const {
+        return &m_data[offset(it, ip, ib)+2];
+    }
+
+private:
+
+    /// Allocates the data once the grid and species are known.
+    void initialize();
+
+    /// Returns the offset of the given grid point in the data array.
+    std::size_t offset(int it, int ip, int ib) const {
+        return ((std::size_t(ib)*m_P.size() + ip)*m_T.size() + it)*m_nv;
+    }
+
+    /**
+     * Interpolates the first nv values of the temperature line (ip, ib) at
+     * the fraction wt of the temperature interval it, and adds them,
+     * multiplied by weight, to p_values.
+     */
+    void interpolateT(
+        int it, double wt, int ip, int ib, double weight, int nv,
+        Interpolation scheme, double* const p_values) const;
+
+private:
+
+    std::vector<double> m_T;
+    std::vector<double> m_P;
+    std::vector<double> m_Bg;
+    std::vector<double> m_lnP;
+    std::vector<std::string> m_species;
+
+    /// Number of values at each grid point (B'c, hw, and mole fractions)
+    int m_nv;
+
+    std::vector<double> m_data;
+
+}; // class BprimeTable
+
+    } // namespace Thermodynamics
+} // namespace Mutation
+
+#endif // THERMO_BPRIME_TABLE_H
@@ -124,6 +124,28 @@ public:
         p_T[0] = m_T;
     }
 
+    int solveTemperatures(
+        const int n, const double* const p_rhoi, const double* const p_rhoe,
+        double* const p_T, bool* const p_converged, int* const p_iters = NULL)
+    {
+        const int ns = m_thermo.nSpecies();
+
+        // Species concentrations and temperature coefficients of each state
+        std::vector<double> c(n*ns), alpha(n);
+        for (int k = 0; k < n; ++k) {
+            alpha[k] = 0.0;
+            for (int i = 0; i < ns; ++i) {
+                c[k*ns+i] =
+                    std::max(p_rhoi[k*ns+i] / m_thermo.speciesMw(i), 0.0);
+                alpha[k] -= c[k*ns+i];
+            }
+        }
+
+        return getTFromRhoE(
+            Cp(m_thermo), H(m_thermo), n, &c[0], p_rhoe, &alpha[0], p_T,
+            p_converged, p_iters, mp_work);
+    }
+
     void getEnergiesMass(double* const p_e)
 	{
 		const int ns = m_thermo.nSpecies();
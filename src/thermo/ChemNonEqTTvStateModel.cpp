@@ -96,9 +96,12 @@ public:
         // Compute the temperatures and make sure the variable set is implemented
         switch (vars) {
         case 0: {
-
-            solveEnergies(p_mass, p_energy);
-
+            int iters;
+            if (!solveEnergies(mp_X, p_energy, m_T, m_Tv, iters))
+                m_thermo.diagnostics().report(
+                    Diagnostics::TEMPERATURE_NOT_CONVERGED)
+                    << "Didn't converge temperatures: T = " << m_T
+                    << ", Tv = " << m_Tv;
             break;
         }
         case 1:
@@ -231,60 +234,167 @@ public:
      	p_tag[3] = 0; p_tag[8] = 1; // Vibration excitation
      	p_tag[4] = 0; p_tag[9] = 1; // Electronic excitation
     }
-  /**
-  * @brief Get temperatures from total energy by solving a non-linear system
-  *
-  * @param p_rhoi - "vector of the partial densities
-  * @param p_rhoe - total and internal mass energy
-  */
-
-    void solveEnergies(const double* const p_rhoi, const double* const p_rhoe)
+    int solveTemperatures(
+        const int n, const double* const p_rhoi, const double* const p_rhoe,
+        double* const p_T, bool* const p_converged, int* const p_iters = NULL)
     {
-        // This line is required to have perfect numerical jacobians...
-        //m_T = m_Tv = 500.0;
-
-        const double atol = 1.0e-12;
-        const double rtol = 1.0e-12;
-        const int    imax = 100;
+        const int ns = m_thermo.nSpecies();
+        std::vector<double> c(ns);
+        int converged = 0, iters;
 
-        Map<const VectorXd> rhoi(p_rhoi, m_thermo.nSpecies());
-        const double density = rhoi.sum();
+        for (int k = 0; k < n; ++k) {
+            for (int i = 0; i < ns; ++i)
+                c[i] = std::max(p_rhoi[k*ns+i] / m_thermo.speciesMw(i), 0.0);
 
-        static VectorXd yi; yi = rhoi / density;
-        const Vector2d emix = Map<const Vector2d>(p_rhoe) / density;
+            p_converged[k] = solveEnergies(
+                &c[0], p_rhoe+2*k, p_T[2*k], p_T[2*k+1], iters);
+            if (p_converged[k]) converged++;
+            if (p_iters != NULL) p_iters[k] = iters;
+        }
 
-        static Matrix<double, Dynamic, Dynamic, RowMajor> ei;
-        static Matrix<double, Dynamic, Dynamic, RowMajor> ci;
-        ei.resize(2, m_thermo.nSpecies());
-        ci.resize(2, m_thermo.nSpecies());
+        return converged;
+    }
 
-        getEnergiesMass(ei.data());
+private:
 
-        Vector2d f, e, cv;
-        e = ei*yi;
-        f = e - emix;
+    /**
+     * @brief Get temperatures from total energy by solving a non-linear system
+     *
+     * The total energy is the sum of a translational-rotational part which only
+     * depends on T and a vibrational-electronic part (which includes the free
+     * electron translational energy) that only depends on Tv.  The Jacobian of
+     * the system is therefore upper triangular and the coupled Newton update
+     * reduces to two scalar equations, one for Tv given the vibrational energy
+     * and one for T given the difference of the two energies.  Each is solved
+     * with the safeguarded iterations of getTFromRhoE() using only the mixture
+     * sums of the energy modes it depends on.
+     *
+     * @param p_c   - species concentrations
+     * @param p_rhoe - total and internal energy densities
+     * @param T     - initial guess on input, translational temperature on output
+     * @param Tv    - initial guess on input, vibrational temperature on output
+     * @param iters - on output, the total number of iterations
+     *
+     * @return true if both temperatures converged
+     */
+    bool solveEnergies(
+        const double* const p_c, const double* const p_rhoe, double& T,
+        double& Tv, int& iters)
+    {
+        const int ns = m_thermo.nSpecies();
+        const int offset = (m_thermo.hasElectrons() ? 1 : 0);
+        const double atol = 1.0e-12;
+        const double rtol = 1.0e-12;
+        const int    imax = 100;
 
-        int i;
-        for (i = 0; (f.norm() > rtol*emix.norm() + atol) && (i < imax); ++i) {
-            // Update temperatures
-            getCvsMass(ci.data());
-            cv = ci*yi;
+        // Vibrational-electronic energy equation
+        int iv;
+        TSolveStatus sv = solveTFromRhoE(
+            CvVE(m_thermo, mp_work2, mp_work3), HVE(m_thermo, mp_work2, mp_work3),
+            p_c, p_rhoe[1], Tv, mp_work1, 0.0, atol, rtol, imax, iv);
+
+        // Translational-rotational energy equation (heavy particles only)
+        double alpha = 0.0;
+        for (int i = offset; i < ns; ++i)
+            alpha -= p_c[i];
+
+        int it;
+        TSolveStatus st = solveTFromRhoE(
+            CpTR(m_thermo, mp_work2), HTR(m_thermo, mp_work2, mp_work3, offset),
+            p_c, p_rhoe[0] - p_rhoe[1], T, mp_work1, alpha, atol, rtol, imax,
+            it);
+
+        iters = iv + it;
+        return (sv == CONVERGED && st == CONVERGED);
+    }
 
-            m_Tv = std::max(m_Tv - f[1]/cv[1], 0.1*m_Tv);
-            m_T  = std::max(m_T + (f[1]-f[0])/cv[0], 0.1*m_T);
+    /**
+     * Provides the species vibrational and electronic enthalpies and the free
+     * electron translational energy at Tv, nondimensionalized by Ru*Tv.
+     */
+    class HVE {
+    public:
+        HVE(const Thermodynamics& t, double* const p_ht, double* const p_hel)
+            : thermo(t), mp_ht(p_ht), mp_hel(p_hel) {}
+        void operator () (double Tv, double* const h) const {
+            thermo.speciesHOverRT(
+                Tv, Tv, Tv, Tv, Tv, NULL, mp_ht, NULL, h, mp_hel, NULL);
+            for (int i = 0; i < thermo.nSpecies(); ++i)
+                h[i] += mp_hel[i];
+            if (thermo.hasElectrons())
+                h[0] = mp_ht[0] - 1.0;
+        }
+    private:
+        const Thermodynamics& thermo;
+        double* const mp_ht;
+        double* const mp_hel;
+    };
 
-            // Update function evaluation
-            getEnergiesMass(ei.data());
-            e = ei*yi;
-            f = e - emix;
+    /**
+     * Provides the derivatives with respect to Tv of the energies in HVE.
+     */
+    class CvVE {
+    public:
+        CvVE(const Thermodynamics& t, double* const p_cpt, double* const p_cpel)
+            : thermo(t), mp_cpt(p_cpt), mp_cpel(p_cpel) {}
+        void operator () (double Tv, double* const cv) const {
+            thermo.speciesCpOverR(
+                Tv, Tv, Tv, Tv, Tv, NULL, mp_cpt, NULL, cv, mp_cpel);
+            for (int i = 0; i < thermo.nSpecies(); ++i)
+                cv[i] += mp_cpel[i];
+            if (thermo.hasElectrons())
+                cv[0] = mp_cpt[0] - 1.0;
         }
+    private:
+        const Thermodynamics& thermo;
+        double* const mp_cpt;
+        double* const mp_cpel;
+    };
 
-        if (i == imax)
-            std::cout << "Warning, didn't converge temperatures: f = " << f.norm() << std::endl;
-    }
+    /**
+     * Provides the species translational, rotational and formation enthalpies
+     * at T, nondimensionalized by Ru*T.  Free electrons only contribute their
+     * formation enthalpy.
+     */
+    class HTR {
+    public:
+        HTR(const Thermodynamics& t, double* const p_hr, double* const p_hf,
+            const int offset)
+            : thermo(t), mp_hr(p_hr), mp_hf(p_hf), m_offset(offset) {}
+        void operator () (double T, double* const h) const {
+            thermo.speciesHOverRT(
+                T, T, T, T, T, NULL, h, mp_hr, NULL, NULL, mp_hf);
+            for (int i = m_offset; i < thermo.nSpecies(); ++i)
+                h[i] += mp_hr[i] + mp_hf[i];
+            if (m_offset > 0)
+                h[0] = mp_hf[0];
+        }
+    private:
+        const Thermodynamics& thermo;
+        double* const mp_hr;
+        double* const mp_hf;
+        const int m_offset;
+    };
 
+    /**
+     * Provides the derivatives with respect to T of the enthalpies in HTR.
+     */
+    class CpTR {
+    public:
+        CpTR(const Thermodynamics& t, double* const p_cpr)
+            : thermo(t), mp_cpr(p_cpr) {}
+        void operator () (double T, double* const cp) const {
+            thermo.speciesCpOverR(T, T, T, T, T, NULL, cp, mp_cpr, NULL, NULL);
+            for (int i = 0; i < thermo.nSpecies(); ++i)
+                cp[i] += mp_cpr[i];
+            if (thermo.hasElectrons())
+                cp[0] = 0.0;
+        }
+    private:
+        const Thermodynamics& thermo;
+        double* const mp_cpr;
+    };
 
-private:
     double* mp_work1;
     double* mp_work2;
     double* mp_work3;
@@ -108,12 +108,14 @@ public:
 
                 int iter = 0;
                 while (std::max(std::abs(f1/rhoe),std::abs(f2/rho)) > tol) {
-                    // Print warning if this is taking too long
-                    if (++iter % max_iters == 0) {
-                        std::cout << "setState() taking too many iterations for Equil StateModel!"
-                             << " It is likely that the input arguments are not feasible..." << std::endl;
-                        std::cout << "density [kg/m^3] = " << rho << ", energy [J/m^3] = " << rhoe << std::endl;
-                    }
+                    // Report if this is taking too long
+                    if (++iter % max_iters == 0)
+                        m_thermo.diagnostics().report(
+                            Diagnostics::EQUILIBRIUM_NOT_CONVERGED)
+                            << "setState() taking too many iterations for "
+                            << "Equil StateModel, the input arguments are "
+                            << "likely not feasible: density [kg/m^3] = "
+                            << rho << ", energy [J/m^3] = " << rhoe;
 
                     // Compute df1/dT which is the main term
                     m_thermo.speciesCpOverR(m_T, mp_cp);
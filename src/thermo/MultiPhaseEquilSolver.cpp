@@ -116,6 +116,9 @@ void MultiPhaseEquilSolver::Solution::initialize(int np, int nc, int ns)
     // Just fill all data with 0
     std::fill(mp_ddata, mp_ddata+m_dsize, 0.0);
     std::fill(mp_idata, mp_idata+m_isize, 0);
+
+    // No ordering has been set up yet
+    m_previous_order.assign(np+nc+4, 0);
 }
 
 //==============================================================================
@@ -123,8 +126,6 @@ void MultiPhaseEquilSolver::Solution::initialize(int np, int nc, int ns)
 bool MultiPhaseEquilSolver::Solution::setupOrdering(
         int* species_group, bool* zero_constraint)
 {
-    static std::vector<int> previous_order(m_np+m_nc+4, 0);
-
     // Count the number of species in each group and order the species such that
     // the groups are contiguous
     for (int i = 0; i < m_np+2; ++i)
@@ -164,22 +165,22 @@ bool MultiPhaseEquilSolver::Solution::setupOrdering(
     // of the following will change also: npr, ncr, sizes of each group, or
     // ordering of constraints.
     bool order_change =
-            (previous_order[0] != m_npr) && (previous_order[1] != m_ncr);
+            (m_previous_order[0] != m_npr) || (m_previous_order[1] != m_ncr);
     if (!order_change) {
         for (int i = 0; i < m_np+2; ++i)
-            order_change |= (previous_order[i+2] != mp_sizes[i]);
+            order_change |= (m_previous_order[i+2] != mp_sizes[i]);
         for (int i = 0; i < m_nc; ++i)
-            order_change |= (previous_order[i+4+m_np] != mp_cir[i]);
+            order_change |= (m_previous_order[i+4+m_np] != mp_cir[i]);
     }
 
     // Save the new ordering information
     if (order_change) {
-        previous_order[0] = m_npr;
-        previous_order[1] = m_ncr;
+        m_previous_order[0] = m_npr;
+        m_previous_order[1] = m_ncr;
         for (int i = 0; i < m_np+2; ++i)
-            previous_order[i+2] = mp_sizes[i];
+            m_previous_order[i+2] = mp_sizes[i];
         for (int i = 0; i < m_nc; ++i)
-            previous_order[i+4+m_np] = mp_cir[i];
+            m_previous_order[i+4+m_np] = mp_cir[i];
     }
 
     return order_change;
@@ -475,7 +476,10 @@ MultiPhaseEquilSolver::MultiPhaseEquilSolver(
         m_pure_condensed(pure_condensed),
         m_solution(thermo),
         m_T(0.0),
-        m_P(0.0)
+        m_P(0.0),
+        m_warm_start(false),
+        m_warm_valid(false),
+        m_warm_solution(thermo)
 {
     // Sizing information
     m_ns  = m_thermo.nSpecies();
@@ -936,8 +940,15 @@ std::pair<int, int> MultiPhaseEquilSolver::equilibrate(
 #endif
 
     if (resk > ms_eps_abs) {
-    	cout << "Warning: equilibrium solver finished with residual of "
-    	     << resk << "!";
+        m_thermo.diagnostics().report(Diagnostics::EQUILIBRIUM_NOT_CONVERGED)
+            << "Equilibrium solver finished with residual of " << resk;
+    }
+
+    // Keep the converged solution as the starting point of the next call
+    if (m_warm_start) {
+        m_warm_valid = (resk <= ms_eps_abs);
+        if (m_warm_valid)
+            m_warm_solution = m_solution;
     }
 
     #ifdef SAVE_EIGEN_SCRIPT
@@ -1083,8 +1094,8 @@ void MultiPhaseEquilSolver::rates(VectorXd& dx, bool save)
     Map<const VectorXd> y(m_solution.y(), nsr);
 
     // Compute a least squares factorization of H
-    static MatrixXd H; H = y.asDiagonal()*m_solution.reducedMatrix(m_B, m_Br);
-    static JacobiSVD<MatrixXd> svd; svd.compute(H, ComputeThinU | ComputeThinV);
+    MatrixXd& H = m_H; H = y.asDiagonal()*m_solution.reducedMatrix(m_B, m_Br);
+    JacobiSVD<MatrixXd>& svd = m_svd; svd.compute(H, ComputeThinU | ComputeThinV);
 
     // Use tableau for temporary storage
     Map<VectorXd> ydg(mp_tableau, nsr);
@@ -1152,8 +1163,8 @@ void MultiPhaseEquilSolver::rates_ci(int k, VectorXd& dx)
     VectorXd y = Map<const ArrayXd>(m_solution.y(), nsr).max(1.e-6);
 
     // Compute a least squares factorization of H
-    static MatrixXd H; H = y.asDiagonal()*m_solution.reducedMatrix(m_B, m_Br);
-    static JacobiSVD<MatrixXd> svd; svd.compute(H, ComputeThinU | ComputeThinV);
+    MatrixXd& H = m_H; H = y.asDiagonal()*m_solution.reducedMatrix(m_B, m_Br);
+    JacobiSVD<MatrixXd>& svd = m_svd; svd.compute(H, ComputeThinU | ComputeThinV);
 
     // Use tableau for temporary storage
     Map<VectorXd> phi(mp_tableau, nsr);
@@ -1235,15 +1246,15 @@ double MultiPhaseEquilSolver::newton()
     const double* const p_lnNbar = m_solution.lnNbar();
     
     // First compute the residual
-    static VectorXd r; r.resize(ncr+npr);
+    VectorXd& r = m_r; r.resize(ncr+npr);
     computeResidual(r);
     
     double res = r.norm();
     if (res > 1.0)
         return res;
 
-    static MatrixXd A;  A.resize(ncr+npr,ncr+npr);
-    static VectorXd dx; dx.resize(ncr+npr);
+    MatrixXd& A  = m_A;  A.resize(ncr+npr,ncr+npr);
+    VectorXd& dx = m_dx; dx.resize(ncr+npr);
     
     int iter = 0;
     while (res > ms_eps_abs && iter < max_iters) {
@@ -1281,7 +1292,7 @@ double MultiPhaseEquilSolver::newton()
         #endif
         
         // Solve the linear system (if it is singular then don't bother)
-        static LDLT<MatrixXd, Upper> ldlt;
+        LDLT<MatrixXd, Upper>& ldlt = m_ldlt;
         ldlt.compute(A);
         dx = ldlt.solve(-r);
         
@@ -1358,8 +1369,7 @@ bool MultiPhaseEquilSolver::checkForDeterminedSpecies()
         }
     }
 
-    m_solution.setupOrdering(&species_group[0], zero_constraint);
-    return true;
+    return m_solution.setupOrdering(&species_group[0], zero_constraint);
 }
 
 //==============================================================================
@@ -1400,6 +1410,15 @@ bool MultiPhaseEquilSolver::initialConditions(
     const int* const p_cir = m_solution.cir();
     const int* const p_sizes = m_solution.sizes();
 
+    // With warm starts, continue from the previous converged solution as long
+    // as the same species and constraints are considered
+    if (m_warm_start && m_warm_valid && !(composition_change || order_change)) {
+        m_solution = m_warm_solution;
+        std::copy(m_solution.g(), m_solution.g()+m_ns, mp_g0);
+        return true;
+    }
+    m_warm_valid = false;
+
     // Check to see if we can reuse the previous solution
     if (!(composition_change || temperature_change || pressure_change || m_np != 1)) {//order_change)) {
         // Can use the previous solution (just need to get g(0) which is the
@@ -249,6 +249,26 @@ public:
         return m_nnewts;
     }
 
+    /**
+     * Enables or disables warm starts.  When enabled, a call to equilibrate()
+     * with the same elemental composition as the previous, converged call
+     * continues from the previous solution to the new temperature and pressure
+     * instead of starting from the Min-G/Max-Min initial conditions.  This is
+     * much cheaper when sweeping temperature or pressure at fixed composition,
+     * as done to generate B' tables.  Disabled by default.
+     */
+    void setWarmStart(bool warm_start) {
+        m_warm_start = warm_start;
+        m_warm_valid = false;
+    }
+
+    /**
+     * Returns true if warm starts are enabled.
+     */
+    bool warmStart() const {
+        return m_warm_start;
+    }
+
     /**
      * Computes the partial derivatives dN/dalpha given dg/dalpha.  This method
      * is the common code used in dNdT() and dNdP().  Note that it is safe to
@@ -465,6 +485,8 @@ private:
         int* mp_sjr;
         int* mp_cir;
         
+        std::vector<int> m_previous_order;
+        
         const Thermodynamics& m_thermo;
     };
 
@@ -586,6 +608,18 @@ private:
     int m_niters;
     int m_nnewts;
 
+    bool m_warm_start;
+    bool m_warm_valid;
+    Solution m_warm_solution;
+
+    // Work arrays of rates() and newton()
+    Eigen::MatrixXd m_H;
+    Eigen::JacobiSVD<Eigen::MatrixXd> m_svd;
+    Eigen::VectorXd m_r;
+    Eigen::MatrixXd m_A;
+    Eigen::VectorXd m_dx;
+    Eigen::LDLT<Eigen::MatrixXd, Eigen::Upper> m_ldlt;
+
 };
 
     } // namespace Thermodynamics
@@ -58,7 +58,7 @@ protected:
      * Positions the stream at the beginning of the species data in the 
      * database file.
      */
-    void skipHeader(std::ifstream& is) const
+    void skipHeader(std::istream& is) const
     {
         std::string line;
         while (std::getline(is, line))
@@ -69,9 +69,10 @@ protected:
     /**
      * Loads the species that is at the current location in the file stream.
      */
-    Species loadSpecies(std::ifstream& is) const
+    Species loadSpecies(std::istream& is, std::streampos& pos) const
     {
         std::string line;
+        pos = is.tellg();
         if (!std::getline(is, line) || line.substr(0,3) == "END")
             return Species();
         
@@ -123,44 +124,6 @@ protected:
         
         return Species(name, phase, stoich);
     }
-    
-    /**
-     * Loads the thermodynamic data corresponding to the required species.  In
-     * this case, the data are the 7 coefficient polynomials.
-     */
-    void loadPolynomials(
-        std::ifstream& is, std::vector<Nasa7Polynomial>& polynomials)
-    {
-        // First build a map of the species names with their indices in order
-        // to speed up the searching for needed names
-        std::map<std::string, size_t> species_names;
-        std::map<std::string, size_t>::iterator iter;
-        for (size_t i = 0; i < species().size(); ++i)
-            species_names.insert(make_pair(species()[i].name(), i));
-        
-        // Keep reading species from file until we have found all the ones we
-        // need
-        std::string line, name;
-        while (species_names.size() > 0) {
-            std::getline(is, line);
-            
-            // Do we need this species?
-            iter = species_names.find(
-                Utilities::String::trim(line.substr(0,18)));
-            if (iter == species_names.end()) {
-                // No, skip remaining lines
-                std::getline(is, line);
-                std::getline(is, line);
-                std::getline(is, line);
-            } else {
-                // Yes, load the polynomial and remove species from list
-                is.seekg(
-                    -static_cast<int>(line.length()+1), std::ios_base::cur) >>
-                    polynomials[iter->second];
-                species_names.erase(iter);
-            }
-        }
-    }
 };
 
 // Register this database type
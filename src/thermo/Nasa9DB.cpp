@@ -60,7 +60,7 @@ protected:
      * Positions the stream at the beginning of the species data in the 
      * database file.
      */
-    void skipHeader(std::ifstream& is) const
+    void skipHeader(std::istream& is) const
     {
         // Start by skipping all of the comments
         std::string line;
@@ -82,12 +82,15 @@ protected:
     /**
      * Loads the species that is at the current location in the file stream.
      */
-    Species loadSpecies(std::ifstream& is) const
+    Species loadSpecies(std::istream& is, std::streampos& pos) const
     {
         // Skip all comments and blank lines first
         std::string line;
-        while (std::getline(is, line))
-            if (String::trim(line).length() > 1 && line[0] != '!') break; 
+        pos = is.tellg();
+        while (std::getline(is, line)) {
+            if (String::trim(line).length() > 1 && line[0] != '!') break;
+            pos = is.tellg();
+        }
         
         if (is.eof() || String::toLowerCase(line.substr(0,3)) == "end")
             return Species();
@@ -145,42 +148,6 @@ protected:
         
         return Species(name, phase, stoich);
     }
-    
-    /**
-     * Loads the thermodynamic data corresponding to the required species.  In
-     * this case, the data are the 7 coefficient polynomials.
-     */
-    void loadPolynomials(
-        std::ifstream& is, std::vector<Nasa9Polynomial>& polynomials)
-    {
-        // First build a map of the species names with their indices in order
-        // to speed up the searching for needed names
-        std::map<std::string, size_t> species_names;
-        std::map<std::string, size_t>::iterator iter;
-        for (size_t i = 0; i < species().size(); ++i)
-            species_names.insert(make_pair(species()[i].name(), i));
-        
-        // Keep reading species from file until we have found all the ones we
-        // need
-        std::string line, name;
-        std::vector<std::string> tokens;
-        while (species_names.size() > 0) {
-            // Read each line until encountering a species that we want
-            std::getline(is, line);
-            
-            // Is this the first line of a species that we need?
-            tokens.clear();
-            name =
-                Utilities::String::tokenize(line.substr(0,24), tokens, " ")[0];
-            iter = species_names.find(name);
-            if (iter != species_names.end()) {
-                is.seekg(
-                    -static_cast<int>(line.length()+1), std::ios_base::cur) >>
-                    polynomials[iter->second];
-                species_names.erase(iter);
-            }
-        }
-    }
 };
 
 // Register this database type
@@ -26,6 +26,8 @@
  */
 
 #include <list>
+#include <map>
+#include <mutex>
 #include <fstream>
 #include <vector>
 #include <cassert>
@@ -81,19 +83,40 @@ protected:
     
     void loadAvailableSpecies(std::list<Species>& species_list);
     
+    std::string speciesSource() const {
+        return Utilities::databaseFileName(filename(), "thermo", ".dat");
+    }
+    
     void loadThermodynamicData();
     
     virtual std::string filename() const = 0;
     
-    virtual void skipHeader(std::ifstream& is) const = 0;
+    virtual void skipHeader(std::istream& is) const = 0;
     
-    virtual Species loadSpecies(std::ifstream& is) const = 0;
-    
-    virtual void loadPolynomials(
-        std::ifstream& is, std::vector<PolynomialType>& polynomials) = 0;
+    /**
+     * Loads the species that is at the current location in the file stream and
+     * sets pos to the beginning of its record so that the corresponding 
+     * polynomial can later be read directly with operator>>.
+     */
+    virtual Species loadSpecies(std::istream& is, std::streampos& pos) const = 0;
 
 private:
     
+    /**
+     * Byte-offset index of the species records found in a database file.
+     */
+    struct RecordIndex
+    {
+        std::list<Species> species;
+        std::map<std::string, std::streampos> offsets;
+    };
+    
+    /**
+     * Returns the record index of the given database file, which is built the
+     * first time the file is requested and then kept for the whole process.
+     */
+    const RecordIndex& recordIndex(const std::string& db_path) const;
+    
     size_t m_ns;
     std::vector<PolynomialType> m_polynomials;
     double mp_params[8];
@@ -174,13 +197,23 @@ void NasaDB<PolynomialType>::gibbs(
 }
 
 template <typename PolynomialType>
-void NasaDB<PolynomialType>::loadAvailableSpecies(
-    std::list<Species>& species_list)
+const typename NasaDB<PolynomialType>::RecordIndex&
+NasaDB<PolynomialType>::recordIndex(const std::string& db_path) const
 {
+    // Indices are never freed, so that the returned references stay valid
+    // after the lock is released
+    static std::map<std::string, RecordIndex> indices;
+    static std::mutex indices_mutex;
+    std::lock_guard<std::mutex> lock(indices_mutex);
+    
+    // If we have already indexed this file then simply return the index
+    typename std::map<std::string, RecordIndex>::iterator iter =
+        indices.find(db_path);
+    if (iter != indices.end())
+        return iter->second;
+    
     // Open the database file
-    std::string db_path =
-        Utilities::databaseFileName(filename(), "thermo", ".dat");
-    std::ifstream file(db_path.c_str());
+    Utilities::IO::DataFileStream file(db_path);
 
     if (!file.is_open()) {
         throw FileNotFoundError(db_path)
@@ -190,36 +223,61 @@ void NasaDB<PolynomialType>::loadAvailableSpecies(
     // Move to the beginning of the first species
     skipHeader(file);
     
-    // Load all of the available species until we reach the end of the file
-    species_list.push_back(loadSpecies(file));
-    while (species_list.back().name() != "")
-        species_list.push_back(loadSpecies(file));
-    species_list.pop_back();
+    // Load all of the available species until we reach the end of the file,
+    // keeping the offset of the first record found for each name
+    RecordIndex index;
+    std::streampos pos;
+    Species species = loadSpecies(file, pos);
+    while (species.name() != "") {
+        index.offsets.insert(std::make_pair(species.name(), pos));
+        index.species.push_back(species);
+        species = loadSpecies(file, pos);
+    }
     
     // Close the database file
     file.close();
+    
+    return indices.insert(std::make_pair(db_path, index)).first->second;
+}
+
+template <typename PolynomialType>
+void NasaDB<PolynomialType>::loadAvailableSpecies(
+    std::list<Species>& species_list)
+{
+    const RecordIndex& index = recordIndex(
+        Utilities::databaseFileName(filename(), "thermo", ".dat"));
+    species_list.insert(
+        species_list.end(), index.species.begin(), index.species.end());
 }
 
 template <typename PolynomialType>
 void NasaDB<PolynomialType>::loadThermodynamicData()
 {
-    // Open the database file
     std::string db_path =
         Utilities::databaseFileName(filename(), "thermo", ".dat");
-    std::ifstream file(db_path.c_str());
+    const RecordIndex& index = recordIndex(db_path);
+    
+    // Open the database file
+    Utilities::IO::DataFileStream file(db_path);
     
     if (!file.is_open()) {
         throw FileNotFoundError(db_path)
             << "Could not find thermodynamic database.";
     }
     
-    // Move to the beginning of the first species
-    skipHeader(file);
-    
-    // Ask the concrete class to fill the polynomials
+    // Seek directly to the record of each species and load its polynomial
     m_ns = species().size();
     m_polynomials.resize(m_ns);
-    loadPolynomials(file, m_polynomials);
+    
+    typename std::map<std::string, std::streampos>::const_iterator iter;
+    for (size_t i = 0; i < m_ns; ++i) {
+        iter = index.offsets.find(species()[i].name());
+        if (iter == index.offsets.end())
+            throw MissingDataError()
+                << "Species " << species()[i].name() << " has no record in "
+                << "the thermodynamic database " << db_path << ".";
+        file.seekg(iter->second) >> m_polynomials[i];
+    }
     
     // Close the database file
     file.close();
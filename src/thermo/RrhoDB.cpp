@@ -31,6 +31,7 @@
 #include "ParticleRRHO.h"
 #include "AutoRegistration.h"
 #include "Functors.h"
+#include "GridTable.h"
 #include "LookupTable.h"
 #include "Utilities.h"
 
@@ -86,6 +87,17 @@ typedef struct {
     double theta;       // characteristic temperature
 } ElecLevel;
 
+// Temperature range of the energy mode tables
+static const double MODE_TABLE_TMIN = 50.0;
+static const double MODE_TABLE_TMAX = 50000.0;
+
+// Maximum interpolation error of the energy mode tables, in units of Ru for
+// specific heats and entropies and of Ru*T for enthalpies
+static const double MODE_TABLE_TOL = 1.0e-6;
+
+// Largest number of nodes in an energy mode table
+static const int MODE_TABLE_MAX_NODES = 16385;
+
 typedef struct {
     unsigned int offset;
     unsigned int nheavy;
@@ -108,7 +120,10 @@ public:
         : ThermoDB(298.15, 101325.0), m_ns(0), m_na(0), m_nm(0),
           m_has_electron(false),
           m_use_tables(true),
-          m_last_bfacs_T(0.0)
+          m_tabulate_modes(arg != 0),
+          m_last_bfacs_T(0.0),
+          mp_vib_table(NULL), m_last_vib_T(0.0),
+          mp_elec_table(NULL), m_last_elec_T(0.0)
     { }
     
     /**
@@ -131,6 +146,9 @@ public:
         if (m_use_tables) {
             delete mp_el_bfac_table;
         }
+
+        delete mp_vib_table;
+        delete mp_elec_table;
     }
 
     /**
@@ -519,6 +537,14 @@ protected:
         }
     }
     
+    /**
+     * The species are those of the species.xml file.
+     */
+    virtual std::string speciesSource() const
+    {
+        return databaseFileName("species.xml", "thermo");
+    }
+    
     /**
      * Load thermodynamic data from the species list.
      */
@@ -650,10 +676,26 @@ protected:
             mp_el_bfac_table = new Mutation::Utilities::LookupTable
                 <double, double, ElecBFacsFunctor>(
                 50.0, 50000.0, 3*(m_na+m_nm), m_elec_data, 0.005);
+            mp_el_bfac_table->share("rrho-elec");
         }
         
         mp_el_bfacs = new double [3*(m_na+m_nm)];
 
+        // Tabulate the vibrational and electronic modes if requested
+        if (m_tabulate_modes) {
+            if (m_nm > 0) {
+                mp_vib_table = tabulateModes(
+                    &RrhoDB::vibrationalModes, 3*m_nm, "vibrational");
+                m_vib_values.resize(3*m_nm);
+            }
+            if (m_elec_data.nheavy > 0) {
+                mp_elec_table = tabulateModes(
+                    &RrhoDB::electronicModes, 3*m_elec_data.nheavy,
+                    "electronic");
+                m_elec_values.resize(3*m_elec_data.nheavy);
+            }
+        }
+
         // Compute the contribution of the partition functions at the standard
         // state temperature to the species enthalpies
         mp_part_sst = new double [m_ns];
@@ -666,6 +708,129 @@ protected:
 
 private:
 
+    typedef void (RrhoDB::*ModeFunction)(double, double* const) const;
+
+    /**
+     * Computes the vibrational enthalpy in K, specific heat and entropy of each
+     * molecule, stored one after the other in p_f.
+     */
+    void vibrationalModes(double T, double* const p_f) const
+    {
+        int ilevel = 0;
+        double fac, x, sumh, sumcp, sums;
+        for (int i = 0; i < m_nm; ++i) {
+            sumh = sumcp = sums = 0.0;
+            for (int k = 0; k < mp_nvib[i]; ++k, ilevel++) {
+                x = mp_vib_temps[ilevel] / T;
+                fac = std::exp(x);
+                sumh  += mp_vib_temps[ilevel] / (fac - 1.0);
+                sumcp += x*x*fac / ((fac - 1.0)*(fac - 1.0));
+                sums  += std::log(1.0 - 1.0 / fac);
+            }
+            p_f[i]        = sumh;
+            p_f[m_nm+i]   = sumcp;
+            p_f[2*m_nm+i] = sumh / T - sums;
+        }
+    }
+
+    /**
+     * Computes the electronic enthalpy in K, specific heat and entropy of each
+     * heavy species, stored one after the other in p_f, from the exact
+     * Boltzmann factors.
+     */
+    void electronicModes(double T, double* const p_f) const
+    {
+        const int nh = m_elec_data.nheavy;
+        std::vector<double> facs(3*nh);
+        ElecBFacsFunctor()(T, &facs[0], m_elec_data);
+
+        for (int i = 0; i < nh; ++i) {
+            const double* const f = &facs[3*i];
+            p_f[i] = (f[0] > 0 ? f[1]/f[0] : 0.0);
+            p_f[nh+i] = (m_elec_data.p_nelec[i] > 1 ?
+                (f[2]*f[0]-f[1]*f[1])/(T*T*f[0]*f[0]) : 0.0);
+            p_f[2*nh+i] = (f[0] > 0 ? f[1]/(f[0]*T) + std::log(f[0]) : 0.0);
+        }
+    }
+
+    /**
+     * Tabulates the nf values computed by the given mode function, enthalpies
+     * first, on a logarithmic temperature grid.  The grid is refined until the
+     * cubic interpolation error at the middle of every interval is below
+     * MODE_TABLE_TOL.  If the tolerance is not met with MODE_TABLE_MAX_NODES,
+     * the largest table is kept and a warning gives the error it reaches.
+     */
+    GridTable* tabulateModes(
+        ModeFunction modes, int nf, const std::string& name) const
+    {
+        std::vector<double> exact(nf), interp(nf);
+        double T, error;
+
+        for (int n = 257; ; n = 2*n - 1) {
+            std::vector<GridAxis> axes(1, GridAxis(
+                MODE_TABLE_TMIN, MODE_TABLE_TMAX, n, GridAxis::LOGARITHMIC));
+            GridTable* p_table = new GridTable(axes, nf);
+
+            for (int k = 0; k < n; ++k) {
+                p_table->nodeCoordinates(k, &T);
+                (this->*modes)(T, p_table->values(k));
+            }
+
+            error = 0.0;
+            for (int k = 0; k < n-1; ++k) {
+                T = std::sqrt(axes[0].node(k)*axes[0].node(k+1));
+                (this->*modes)(T, &exact[0]);
+                p_table->lookup<GridCubic>(&T, &interp[0]);
+                for (int f = 0; f < nf; ++f)
+                    error = std::max(error, std::abs(exact[f] - interp[f]) /
+                        (f < nf/3 ? T : 1.0));
+            }
+
+            if (error < MODE_TABLE_TOL)
+                return p_table;
+
+            if (2*n - 1 > MODE_TABLE_MAX_NODES) {
+                std::cout
+                    << "Warning: the " << name << " mode table of the RRHO "
+                    << "database is only interpolated to within " << error
+                    << " with " << n << " nodes, instead of "
+                    << MODE_TABLE_TOL << "." << std::endl;
+                return p_table;
+            }
+            delete p_table;
+        }
+    }
+
+    /**
+     * Returns the tabulated vibrational modes at T, or NULL if they are not
+     * tabulated at this temperature.
+     */
+    const double* vibrationalTable(double T)
+    {
+        if (mp_vib_table == NULL || T < MODE_TABLE_TMIN || T > MODE_TABLE_TMAX)
+            return NULL;
+        if (T != m_last_vib_T) {
+            mp_vib_table->lookup<GridCubic>(&T, &m_vib_values[0]);
+            m_last_vib_T = T;
+        }
+        return &m_vib_values[0];
+    }
+
+    /**
+     * Returns the tabulated electronic modes at T, or NULL if they are not
+     * tabulated at this temperature.
+     */
+    const double* electronicTable(double T)
+    {
+        if (mp_elec_table == NULL || T < MODE_TABLE_TMIN || T > MODE_TABLE_TMAX)
+            return NULL;
+        if (T != m_last_elec_T) {
+            mp_elec_table->lookup<GridCubic>(&T, &m_elec_values[0]);
+            m_last_elec_T = T;
+        }
+        return &m_elec_values[0];
+    }
+
     void updateElecBoltzmannFactors(double T)
     {
         if (std::abs(1.0 - m_last_bfacs_T / T) < 1.0e-16)
@@ -707,6 +872,13 @@ private:
         double sum, fac1, fac2;
         op(cp[0], 0.0);
         LOOP_ATOMS(op(cp[j], 0.0));
+
+        const double* const p_table = vibrationalTable(Tv);
+        if (p_table != NULL) {
+            LOOP_MOLECULES(op(cp[j], p_table[m_nm+i]));
+            return;
+        }
+
         LOOP_MOLECULES(
             sum = 0.0;
             for (int k = 0; k < mp_nvib[i]; ++k, ilevel++) {
@@ -727,6 +899,14 @@ private:
     template <typename OP>
     void cpE(double T, double* const p_cp, const OP& op)
     {
+        const double* const p_table = electronicTable(T);
+        if (p_table != NULL) {
+            op(p_cp[0], 0.0);
+            for (int i = 0; i < m_elec_data.nheavy; ++i)
+                op(p_cp[i+m_elec_data.offset], p_table[m_elec_data.nheavy+i]);
+            return;
+        }
+
         updateElecBoltzmannFactors(T);
         op(p_cp[0], 0.0);
 
@@ -764,7 +944,10 @@ private:
      */
     template <typename OP>
     void hV(double T, double* const h, const OP& op) {
-        if (T < 10.0) {
+        const double* const p_table = vibrationalTable(T);
+        if (p_table != NULL) {
+            LOOP_MOLECULES(op(h[j], p_table[i]));
+        } else if (T < 10.0) {
             LOOP_MOLECULES(op(h[j], 0.0));
         } else {
             int ilevel = 0;
@@ -786,6 +969,14 @@ private:
     template <typename OP>
     void hE(double T, double* const p_h, const OP& op)
     {
+        const double* const p_table = electronicTable(T);
+        if (p_table != NULL) {
+            op(p_h[0], 0.0);
+            for (int i = 0; i < m_elec_data.nheavy; ++i)
+                op(p_h[i+m_elec_data.offset], p_table[i]);
+            return;
+        }
+
         updateElecBoltzmannFactors(T);
         op(p_h[0], 0.0);
 
@@ -835,6 +1026,12 @@ private:
      */
     template <typename OP>
     void sV(double T, double* const s, const OP& op) {
+        const double* const p_table = vibrationalTable(T);
+        if (p_table != NULL) {
+            LOOP_MOLECULES(op(s[j], p_table[2*m_nm+i]));
+            return;
+        }
+
         int ilevel = 0;
         double fac, sum1, sum2;
         LOOP_MOLECULES(
@@ -853,6 +1050,15 @@ private:
      */
     template <typename OP>
     void sE(double T, double* const p_s, const OP& op) {
+        const double* const p_table = electronicTable(T);
+        if (p_table != NULL) {
+            op(p_s[0], 0.0);
+            for (int i = 0; i < m_elec_data.nheavy; ++i)
+                op(p_s[i+m_elec_data.offset],
+                    p_table[2*m_elec_data.nheavy+i]);
+            return;
+        }
+
         updateElecBoltzmannFactors(T);
         op(p_s[0], 0.0);
 
@@ -874,6 +1080,7 @@ private:
     
     bool m_has_electron;
     bool m_use_tables;
+    bool m_tabulate_modes;
     
     double* mp_lnqtmw;
     double* mp_hform;
@@ -890,6 +1097,15 @@ private:
     double* mp_el_bfacs;
     double m_last_bfacs_T;
 
+    // Tabulated vibrational and electronic modes, if requested
+    GridTable* mp_vib_table;
+    std::vector<double> m_vib_values;
+    double m_last_vib_T;
+
+    GridTable* mp_elec_table;
+    std::vector<double> m_elec_values;
+    double m_last_elec_T;
+
     //Mutation::Utilities::LookupTable<double, double, HelFunctor>* mp_hel_table;
     //Mutation::Utilities::LookupTable<double, double, SelFunctor>* mp_sel_table;
     //Mutation::Utilities::LookupTable<double, double, CpelFunctor>* mp_cpel_table;
@@ -0,0 +1,101 @@
+/**
+ * @file SpeciesCatalog.cpp
+ *
+ * @brief Implementation of the SpeciesCatalog class.
+ */
+
+/*
+ * Copyright 2018 von Karman Institute for Fluid Dynamics (VKI)
+ *
+ * This file is part of MUlticomponent Thermodynamic And Transport
+ * properties for IONized gases in C++ (Mutation++) software package.
+ *
+ * Mutation++ is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as
+ * published by the Free Software Foundation, either version 3 of the
+ * License, or (at your option) any later version.
+ *
+ * Mutation++ is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with Mutation++.  If not, see
+ * <http://www.gnu.org/licenses/>.
+ */
+
+#include "SpeciesCatalog.h"
+
+#include <algorithm>
+#include <iostream>
+
+namespace Mutation {
+    namespace Thermodynamics {
+
+//==============================================================================
+
+SpeciesCatalog::SpeciesCatalog(const std::list<Species>& species)
+{
+    // Groups are found by composition while the catalog is built
+    typedef std::pair<std::vector<std::string>, std::pair<int, int> > GroupKey;
+    std::map<GroupKey, int> group_indices;
+
+    std::list<Species>::const_iterator iter = species.begin();
+    for ( ; iter != species.end(); ++iter) {
+        const int index = m_species.size();
+        if (!m_names.insert(std::make_pair(iter->name(), index)).second) {
+            std::cout << "Warning, species \"" << iter->name()
+                      << "\" is defined more than once in the thermodynamic"
+                      << " database.  I will ignore recurrences..."
+                      << std::endl;
+            continue;
+        }
+
+        m_species.push_back(*iter);
+        m_ground_states[iter->groundStateName()].push_back(index);
+
+        GroupKey key;
+        Species::StoichList::const_iterator element =
+            iter->stoichiometry().begin();
+        for ( ; element != iter->stoichiometry().end(); ++element)
+            key.first.push_back(element->first);
+        std::sort(key.first.begin(), key.first.end());
+        key.second = std::make_pair(int(iter->phase()), iter->charge());
+
+        std::map<GroupKey, int>::iterator group = group_indices.find(key);
+        if (group == group_indices.end()) {
+            group = group_indices.insert(
+                std::make_pair(key, int(m_groups.size()))).first;
+            m_groups.push_back(Group());
+            m_groups.back().elements = key.first;
+            m_groups.back().phase = iter->phase();
+            m_groups.back().charge = iter->charge();
+        }
+        m_groups[group->second].species.push_back(index);
+    }
+}
+
+//==============================================================================
+
+int SpeciesCatalog::speciesIndex(const std::string& name) const
+{
+    std::map<std::string, int>::const_iterator iter = m_names.find(name);
+    return (iter == m_names.end() ? -1 : iter->second);
+}
+
+//==============================================================================
+
+const std::vector<int>& SpeciesCatalog::groundStateIndices(
+    const std::string& name) const
+{
+    static const std::vector<int> none;
+    std::map<std::string, std::vector<int> >::const_iterator iter =
+        m_ground_states.find(name);
+    return (iter == m_ground_states.end() ? none : iter->second);
+}
+
+//==============================================================================
+
+    } // namespace Thermodynamics
+} // namespace Mutation
@@ -0,0 +1,99 @@
+/**
+ * @file SpeciesCatalog.h
+ *
+ * @brief Declaration of the SpeciesCatalog class.
+ */
+
+/*
+ * Copyright 2018 von Karman Institute for Fluid Dynamics (VKI)
+ *
+ * This file is part of MUlticomponent Thermodynamic And Transport
+ * properties for IONized gases in C++ (Mutation++) software package.
+ *
+ * Mutation++ is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as
+ * published by the Free Software Foundation, either version 3 of the
+ * License, or (at your option) any later version.
+ *
+ * Mutation++ is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with Mutation++.  If not, see
+ * <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef THERMO_SPECIES_CATALOG_H
+#define THERMO_SPECIES_CATALOG_H
+
+#include "Species.h"
+
+#include <list>
+#include <map>
+#include <string>
+#include <vector>
+
+namespace Mutation {
+    namespace Thermodynamics {
+
+/**
+ * All of the species available in a thermodynamic database, indexed by name,
+ * by ground state name and by composition, so that a SpeciesListDescriptor
+ * can find the species it describes without testing every one of them.
+ *
+ * ThermoDB::load() builds the catalog of a database file the first time it is
+ * used and shares it with every mixture loaded afterwards in the process.
+ */
+class SpeciesCatalog
+{
+public:
+
+    /**
+     * Species which have the same elements, phase and charge.
+     */
+    struct Group {
+        std::vector<std::string> elements; ///< sorted element names
+        PhaseType phase;
+        int charge;
+        std::vector<int> species;          ///< indices in the catalog
+    };
+
+    /**
+     * Indexes the given species.  Only the first of several species with the
+     * same name is kept, with a warning.
+     */
+    explicit SpeciesCatalog(const std::list<Species>& species);
+
+    /// Returns the number of species in the catalog.
+    int nSpecies() const { return m_species.size(); }
+
+    /// Returns the i'th species, in the order of the database.
+    const Species& species(int i) const { return m_species[i]; }
+
+    /// Returns the index of the species with the given name, or -1.
+    int speciesIndex(const std::string& name) const;
+
+    /**
+     * Returns the indices of the species with the given ground state name,
+     * which include the ground state itself.
+     */
+    const std::vector<int>& groundStateIndices(const std::string& name) const;
+
+    /// Returns the groups of species with the same composition.
+    const std::vector<Group>& groups() const { return m_groups; }
+
+private:
+
+    std::vector<Species> m_species;
+    std::map<std::string, int> m_names;
+    std::map<std::string, std::vector<int> > m_ground_states;
+    std::vector<Group> m_groups;
+
+}; // class SpeciesCatalog
+
+    } // namespace Thermodynamics
+} // namespace Mutation
+
+#endif // THERMO_SPECIES_CATALOG_H
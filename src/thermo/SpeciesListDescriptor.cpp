@@ -27,8 +27,10 @@
 
 #include "SpeciesListDescriptor.h"
 #include "Species.h"
+#include "SpeciesCatalog.h"
 #include "Utilities.h"
 
+#include <algorithm>
 #include <iostream>
 #include <iterator>
 using namespace std;
@@ -189,6 +191,48 @@ bool SpeciesListDescriptor::matches(const Species& species) const
 
 //==============================================================================
 
+void SpeciesListDescriptor::select(
+    const SpeciesCatalog& catalog, std::list<Species>& species) const
+{
+    std::vector<int> candidates;
+
+    // Explicitly named species and their excited states
+    for (int i = 0; i < m_species_names.size(); ++i) {
+        const std::string& name = m_species_names[i];
+        const int index = catalog.speciesIndex(name);
+        if (index >= 0)
+            candidates.push_back(index);
+        const std::vector<int>& states = catalog.groundStateIndices(name);
+        candidates.insert(candidates.end(), states.begin(), states.end());
+    }
+
+    // Groups of species satisfying the implicit rule
+    for (int i = 0; i < catalog.groups().size(); ++i) {
+        const SpeciesCatalog::Group& group = catalog.groups()[i];
+        if (group.phase == GAS    && !m_gases)   continue;
+        if (group.phase == SOLID  && !m_solids)  continue;
+        if (group.phase == LIQUID && !m_liquids) continue;
+
+        int j = 0;
+        while (j < group.elements.size() &&
+            m_element_names.count(group.elements[j]) > 0) j++;
+        if (j == group.elements.size())
+            candidates.insert(
+                candidates.end(), group.species.begin(), group.species.end());
+    }
+
+    // The candidates are tested in the order of the catalog
+    std::sort(candidates.begin(), candidates.end());
+    candidates.erase(
+        std::unique(candidates.begin(), candidates.end()), candidates.end());
+
+    for (int i = 0; i < candidates.size(); ++i)
+        if (matches(catalog.species(candidates[i])))
+            species.push_back(catalog.species(candidates[i]));
+}
+
+//==============================================================================
+
 /// Predicate returns true if species name equals given name.
 struct NameEquals {
     NameEquals(const std::string& str) : name(str) { }
@@ -37,6 +37,7 @@ namespace Mutation {
     namespace Thermodynamics {
 
 class Species;
+class SpeciesCatalog;
 
 /**
  * This class is used by thermodynamic databases to decide which species they 
@@ -64,6 +65,14 @@ public:
      */
     bool matches(const Species& species) const;
     
+    /**
+     * Adds the species of the catalog which match this descriptor to the list,
+     * in the order of the catalog.  Only the species which are explicitly
+     * named, or whose composition satisfies the implicit rule, are tested.
+     */
+    void select(
+        const SpeciesCatalog& catalog, std::list<Species>& species) const;
+    
     /**
      * Orders the species given as input in the output array.  Ensures that 
      * species explicitly listed by the user maintain the same order and that 
@@ -32,6 +32,8 @@
 #include "Kinetics.h"
 #include "TransferModel.h"
 
+#include <limits>
+
 namespace Mutation {
     namespace Thermodynamics {
 
@@ -208,6 +210,30 @@ public:
         throw NotImplementedError("StateModel::getTemperatures()");
     }
 
+    /**
+     * Computes the temperatures of a block of n states given in terms of the
+     * conserved variables (species densities and energy densities) without
+     * changing the current state of the model.  The species densities are
+     * stored row-major, n_species per state, the energy densities and
+     * temperatures n_energies per state.  On input, p_T holds the initial
+     * guesses (for example the temperatures at the previous time step).
+     *
+     * @param n           number of states
+     * @param p_rhoi      species densities, n x n_species
+     * @param p_rhoe      energy densities, n x n_energies
+     * @param p_T         initial guesses on input, temperatures on output
+     * @param p_converged on output, true for each state which converged
+     * @param p_iters     if not NULL, the number of iterations for each state
+     *
+     * @return the number of states which converged
+     */
+    virtual int solveTemperatures(
+        const int n, const double* const p_rhoi, const double* const p_rhoe,
+        double* const p_T, bool* const p_converged, int* const p_iters = NULL)
+    {
+        throw NotImplementedError("StateModel::solveTemperatures()");
+    }
+
     /**
      * Returns a vector of length n_species times n_energies with each corresponding
 	 * energy per unit mass.  The first n_species values correspond to the total energy
@@ -280,6 +306,29 @@ public:
             p_omega[m_transfer_models[i].first] +=
                 m_transfer_models[i].second->source();
     }
+
+    /**
+     * Provides the Jacobian of the total energy transfer source terms with
+     * respect to the species densities, the translational temperature, and
+     * the vibrational-electronic temperature.  The matrix is stored in
+     * row-major order with one row of length ns+2 per energy transfer source
+     * term, ordered as in energyTransferSource().
+     *
+     * @see Mutation::Transfer::TransferModel::jacobian()
+     */
+    virtual void energyTransferJacobian(double* const p_jac)
+    {
+        const int nc = m_thermo.nSpecies()+2;
+        std::fill(p_jac, p_jac+(m_nenergy-1)*nc, 0.0);
+
+        std::vector<double> row(nc);
+        for (int i = 0; i < m_transfer_models.size(); ++i) {
+            m_transfer_models[i].second->jacobian(&row[0]);
+            double* const p_row = p_jac + m_transfer_models[i].first*nc;
+            for (int j = 0; j < nc; ++j)
+                p_row[j] += row[j];
+        }
+    }
     
 protected:
     /**
@@ -299,10 +348,10 @@ protected:
      * \f[ f(T) = T \left[\sum_i \tilde{\rho}_i \left(\frac{H_i(T)}{R_uT}\right)
      *            + \alpha\right] - \frac{\rho e}{R_u} = 0 \f]
      * for the temperature given the \f$C_{p,i}/R_u\f$ and \f$H_i/R_uT\f$
-     * function providers using a Newton-Rhapson iterative procedure.  This
-     * function assumes that the mp_X array is filled with the species molar
-     * densities (concentrations) prior to being called. The convergence
-     * criteria for the Newton iterations is taken to be
+     * function providers using a safeguarded Newton-secant iterative procedure
+     * (see solveTFromRhoE()).  This function assumes that the mp_X array is
+     * filled with the species molar densities (concentrations) prior to being
+     * called. The convergence criteria for the iterations is taken to be
      * \f[ |f(T)| < \epsilon_r\left|\frac{\rho e}{R_u}\right| + \epsilon_a \f]
      * where \f$\epsilon_a\f$ and \f$\epsilon_r\f$ are absolute and relative
      * tolerances respectively.  Note that if the total energy equation is
@@ -318,9 +367,11 @@ protected:
      * @param alpha     arbitrary temperature coefficient in energy equation
      * @param atol      absolute tolerance, \f$\epsilon_a\f$, on \f$f\f$
      * @param rtol      relative tolerance, \f$\epsilon_r\f$, on \f$f\f$
-     * @param max_iters maximum number of iterations (warns user if exceeded)
+     * @param max_iters maximum number of iterations (reported to the
+     *                  mixture Diagnostics if exceeded)
      *
-     * @return false if max iterations exceeded, true otherwise
+     * @return false if max iterations exceeded or the temperature was clamped
+     * at 50 K, true otherwise
      */
     template <typename CpProvider, typename HProvider>
     bool getTFromRhoE(
@@ -334,57 +385,178 @@ protected:
         const double rtol = 1.0e-12,
         const int max_iters = 100)
     {
-        using std::cerr;
+        int iters;
+        switch (solveTFromRhoE(
+            cp, h, mp_X, rhoe, T, p_work, alpha, atol, rtol, max_iters, iters)) {
+        case MAX_ITERATIONS:
+            m_thermo.diagnostics().report(Diagnostics::TEMPERATURE_NOT_CONVERGED)
+                << "Exceeded max iterations when computing temperature, T = "
+                << T;
+            return false;
+        case CLAMPED:
+            m_thermo.diagnostics().report(Diagnostics::TEMPERATURE_CLAMPED)
+                << "Clamping T at 50 K, energy is too low for the given "
+                << "species densities";
+            return false;
+        default:
+            return true;
+        }
+    }
+
+    /**
+     * Batched version of getTFromRhoE() which solves the energy equation for
+     * a block of n states.  The concentrations of each state are stored
+     * row-major in p_c, n_species per state, and the temperatures in p_T are
+     * used as initial guesses.  Instead of printing warnings, the outcome of
+     * each state is returned in p_converged.
+     *
+     * @param cp          class providing species specific heats
+     * @param h           class providing species enthalpies
+     * @param n           number of states
+     * @param p_c         species concentrations, n x n_species
+     * @param p_rhoe      values of \f$\rho e\f$ for each state
+     * @param p_alpha     temperature coefficient for each state
+     * @param p_T         initial guesses on input, solutions on output
+     * @param p_converged on output, true for each state which converged
+     * @param p_iters     if not NULL, the number of iterations for each state
+     * @param p_work      work array, at least number of species long
+     *
+     * @return the number of states which converged
+     */
+    template <typename CpProvider, typename HProvider>
+    int getTFromRhoE(
+        const CpProvider& cp,
+        const HProvider& h,
+        const int n,
+        const double* const p_c,
+        const double* const p_rhoe,
+        const double* const p_alpha,
+        double* const p_T,
+        bool* const p_converged,
+        int* const p_iters,
+        double* const p_work,
+        const double atol = 1.0e-12,
+        const double rtol = 1.0e-12,
+        const int max_iters = 100)
+    {
+        const int ns = m_thermo.nSpecies();
+        int converged = 0, iters;
+
+        for (int k = 0; k < n; ++k) {
+            p_converged[k] = (solveTFromRhoE(
+                cp, h, p_c+k*ns, p_rhoe[k], p_T[k], p_work, p_alpha[k], atol,
+                rtol, max_iters, iters) == CONVERGED);
+            if (p_converged[k]) converged++;
+            if (p_iters != NULL) p_iters[k] = iters;
+        }
+
+        return converged;
+    }
+
+    /// Outcome of solveTFromRhoE().
+    enum TSolveStatus {
+        CONVERGED,
+        MAX_ITERATIONS,
+        CLAMPED
+    };
+
+    /**
+     * Solves the energy equation described in getTFromRhoE() for a single
+     * state with concentrations p_c.  The first update is a Newton step using
+     * the analytic \f$ df/dT \f$, after which secant steps are taken so that
+     * only the enthalpies need to be evaluated as long as the iterates stay on
+     * the same side of the solution.  Since
+     * \f$ f(T) \f$ is monotonic, every evaluation narrows a bracket on the
+     * solution and any step leaving the bracket (or the 50 K lower limit) is
+     * replaced by bisection toward the violated bound.  On return, iters holds
+     * the number of iterations taken.
+     */
+    template <typename CpProvider, typename HProvider>
+    TSolveStatus solveTFromRhoE(
+        const CpProvider& cp,
+        const HProvider& h,
+        const double* const p_c,
+        const double rhoe,
+        double& T,
+        double* const p_work,
+        const double alpha,
+        const double atol,
+        const double rtol,
+        const int max_iters,
+        int& iters) const
+    {
         const int ns = m_thermo.nSpecies();
         const double rhoe_over_Ru = rhoe/RU;
         const double tol = rtol*std::abs(rhoe_over_Ru) + atol;
 
-        double f, fp, dT;
+        double f, fp, Tnew, fnew;
+        double Tlo = 50.0, Thi = std::numeric_limits<double>::max();
+        iters = 0;
 
         // Compute initial value of f
         h(T, p_work);
         f = alpha;
         for (int i = 0; i < ns; ++i)
-            f += mp_X[i]*p_work[i];
+            f += p_c[i]*p_work[i];
         f = T*f - rhoe_over_Ru;
 
-        int iter = 0;
-        //cout << iter << " " << f << " " << T << endl;
-        while (std::abs(f) > tol) {
-            // Check for max iterations
-            if (iter++ == max_iters) {
-                std::cerr << "Exceeded max iterations when computing temperature!\n";
-                std::cerr << "res = " << f / rhoe_over_Ru << ", T = " << T << std::endl;
-                return false;
-            }
+        if (std::abs(f) <= tol)
+            return CONVERGED;
 
-            // Compute df/dT
-            cp(T, p_work);
-            fp = alpha;
-            for (int i = 0; i < ns; ++i)
-                fp += mp_X[i]*p_work[i];
-
-            // Update T
-            dT = f/fp;
-            if (std::abs(T - 50.0) < 1.0e-10 && dT > 0) {
-                std::cerr << "Clamping T at 50 K, energy is too low for the "
-                     << "given species densities..." << std::endl;
-                return false;
-            }
-            while (T - dT < 50.0) dT *= 0.5; // prevent non-positive T
-            T -= dT;
+        // Compute df/dT for the first step
+        cp(T, p_work);
+        fp = alpha;
+        for (int i = 0; i < ns; ++i)
+            fp += p_c[i]*p_work[i];
+
+        for ( ; iters < max_iters; ++iters) {
+            // Update the bracket on the solution
+            if (f > 0.0)
+                Thi = std::min(Thi, T);
+            else
+                Tlo = std::max(Tlo, T);
+
+            // Energy is too low to be reached above the lower limit
+            if (std::abs(T - 50.0) < 1.0e-10 && f > 0.0)
+                return CLAMPED;
+
+            // Take the Newton/secant step, bisecting if it leaves the bracket
+            Tnew = T - f/fp;
+            if (!(Tnew > Tlo))
+                Tnew = 0.5*(T + Tlo);
+            else if (!(Tnew < Thi))
+                Tnew = 0.5*(T + Thi);
 
             // Recompute f
-            h(T, p_work);
-            f = alpha;
+            h(Tnew, p_work);
+            fnew = alpha;
             for (int i = 0; i < ns; ++i)
-                f += mp_X[i]*p_work[i];
-            f = T*f - rhoe_over_Ru;
-            //cout << iter << " " << f << " " << T << endl;
+                fnew += p_c[i]*p_work[i];
+            fnew = Tnew*fnew - rhoe_over_Ru;
+
+            // Secant approximation of df/dT, recomputed analytically if it
+            // degenerates or if the step crossed the solution (where the
+            // secant of a convex f(T) stagnates, as in regula falsi)
+            bool newton = (f*fnew < 0.0);
+            fp = (fnew - f)/(Tnew - T);
+            T = Tnew;
+            f = fnew;
+
+            if (std::abs(f) <= tol) {
+                iters++;
+                return CONVERGED;
+            }
+
+            if (newton || !(fp > 0.0) ||
+                fp == std::numeric_limits<double>::infinity()) {
+                cp(T, p_work);
+                fp = alpha;
+                for (int i = 0; i < ns; ++i)
+                    fp += p_c[i]*p_work[i];
+            }
         }
 
-        // Let the user know if we converged or not
-        return true;
+        return MAX_ITERATIONS;
     }
 
 protected:
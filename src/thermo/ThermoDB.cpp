@@ -26,6 +26,7 @@
  */
 
 #include "ThermoDB.h"
+#include "SpeciesCatalog.h"
 #include "Utilities.h"
 
 #include <eigen3/Eigen/Dense>
@@ -33,6 +34,9 @@ using namespace Eigen;
 
 #include <algorithm>
 #include <cassert>
+#include <map>
+#include <mutex>
+#include <typeinfo>
 using namespace std;
 
 namespace Mutation {
@@ -50,49 +54,52 @@ ThermoDB::ThermoDB(double sst, double ssp)
 //==============================================================================
 
 bool ThermoDB::load(const SpeciesListDescriptor& descriptor)
+{
+    const std::string source = speciesSource();
+    if (!source.empty())
+        return load(descriptor, sharedCatalog(source));
+
+    // Load all possible species from the concrete database type
+    std::list<Species> species_list;
+    loadAvailableSpecies(species_list);
+    return load(descriptor, SpeciesCatalog(species_list));
+}
+
+//==============================================================================
+
+const SpeciesCatalog& ThermoDB::sharedCatalog(const std::string& source)
+{
+    // Catalogs are never freed, as mixtures may be loaded until the end
+    static std::map<std::string, SpeciesCatalog*> catalogs;
+    static std::mutex catalogs_mutex;
+
+    const std::string key = std::string(typeid(*this).name()) + ":" + source;
+    std::lock_guard<std::mutex> lock(catalogs_mutex);
+
+    std::map<std::string, SpeciesCatalog*>::iterator iter = catalogs.find(key);
+    if (iter == catalogs.end()) {
+        std::list<Species> species_list;
+        loadAvailableSpecies(species_list);
+        iter = catalogs.insert(
+            std::make_pair(key, new SpeciesCatalog(species_list))).first;
+    }
+
+    return *iter->second;
+}
+
+//==============================================================================
+
+bool ThermoDB::load(
+    const SpeciesListDescriptor& descriptor, const SpeciesCatalog& catalog)
 {
     // It is possible that this isn't the first call to load so just make sure
     // species and elements are cleared
     m_species.clear();
     m_elements.clear();
     
-    // Load all possible species from the concrete database type
+    // Use the species list descriptor to select the wanted species
     std::list<Species> species_list;
-    loadAvailableSpecies(species_list);
-    
-    // Check for duplicate species in the database
-    std::list<Species>::iterator iter1 = species_list.begin();
-    std::list<Species>::iterator iter2;
-    
-    while (iter1 != species_list.end()) {
-        (iter2 = iter1)++;
-        while (iter2 != species_list.end()) {
-            if (iter1->name() == iter2->name()) {
-                std::cout << "Warning, species \"" << iter1->name()
-                          << "\" is defined more than once in the thermodynamic"
-                          << " database.  I will ignore recurrences..."
-                          << std::endl;
-                iter2 = species_list.erase(iter2);
-                while (iter2 != species_list.end()) {
-                    if (iter1->name() == iter2->name())
-                        iter2 = species_list.erase(iter2);
-                    else
-                        iter2++;
-                }
-            } else
-                iter2++;
-        }
-        iter1++;
-    }
-    
-    // Use the species list descriptor to remove unwanted species
-    iter1 = species_list.begin();
-    while (iter1 != species_list.end()) {
-        if (descriptor.matches(*iter1))
-            iter1++;
-        else
-            iter1 = species_list.erase(iter1);
-    }
+    descriptor.select(catalog, species_list);
     
     // Now we have all of the species that we want but possibly in the wrong
     // order so use the descriptor to tell us the correct order
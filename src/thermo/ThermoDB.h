@@ -33,10 +33,13 @@
 
 #include <vector>
 #include <list>
+#include <string>
 
 namespace Mutation {
     namespace Thermodynamics {
 
+class SpeciesCatalog;
+
 /**
  * Abstract base class for all thermodynamic databases.  This provides the 
  * construct for self registering thermodynamic database types so that it is 
@@ -53,7 +56,8 @@ public:
     
     /**
      * Type of arguments required in constructor for all classes derived from
-     * ThermoDB.
+     * ThermoDB.  A nonzero value asks the database to tabulate the species
+     * properties of each energy mode, which databases are free to ignore.
      */
     typedef int ARGS;
     
@@ -260,6 +264,15 @@ protected:
      */
     virtual void loadAvailableSpecies(std::list<Species>& species) = 0;
     
+    /**
+     * Returns a name (usually the path of the database file) which identifies
+     * the species returned by loadAvailableSpecies().  Databases which return
+     * a nonempty name have their species catalog built once per process and
+     * shared by every later call to load(), instead of loading the species
+     * each time.
+     */
+    virtual std::string speciesSource() const { return ""; }
+    
     /**
      * Implemented by the concrete class which loads any data from the database
      * required to compute the necessary thermodynamic quantities.  This is 
@@ -268,6 +281,16 @@ protected:
      */
     virtual void loadThermodynamicData() = 0;
     
+private:
+
+    /// Returns the catalog of this database type shared for the given source.
+    const SpeciesCatalog& sharedCatalog(const std::string& source);
+
+    /// Loads the species of the catalog matching the descriptor.
+    bool load(
+        const SpeciesListDescriptor& descriptor,
+        const SpeciesCatalog& catalog);
+
 private:
 
     double m_sst;
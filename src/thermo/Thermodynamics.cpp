@@ -46,13 +46,17 @@ namespace Mutation {
 Thermodynamics::Thermodynamics(
     const string& species_descriptor,
     const string& thermo_db,
-    const string& state_model )
-    : mp_work1(NULL), mp_work2(NULL), mp_wrkcp(NULL), mp_default_composition(NULL),
+    const string& state_model,
+    bool tabulate )
+    : mp_work1(NULL), mp_work2(NULL), mp_wrkcp(NULL), mp_y(NULL),
+      m_y_valid(false), mp_default_composition(NULL),
+      mp_diagnostics(new Diagnostics()),
       m_has_electrons(false), m_natoms(0), m_nmolecules(0)
 {
     try {
         // Load the thermodynamic database
-        mp_thermodb = Config::Factory<ThermoDB>::create(thermo_db, 0);
+        mp_thermodb = Config::Factory<ThermoDB>::create(
+            thermo_db, tabulate ? 1 : 0);
     } catch (Error& e) {
         e << "\nWas trying to load the thermodynamic database.";
         throw;
@@ -87,6 +91,19 @@ Thermodynamics::Thermodynamics(
         for (int j = 0; j < nElements(); ++j)
             m_element_matrix(i,j) = 
                 species(i).nAtoms(element(j).name());
+
+    // Most species are made of one or two elements, so the conversions only
+    // loop over the nonzero entries of the matrix
+    m_element_offsets.assign(1, 0);
+    for (int i = 0; i < nSpecies(); ++i) {
+        for (int j = 0; j < nElements(); ++j) {
+            if (m_element_matrix(i,j) != 0.0) {
+                ElementEntry entry = { j, m_element_matrix(i,j) };
+                m_element_entries.push_back(entry);
+            }
+        }
+        m_element_offsets.push_back(m_element_entries.size());
+    }
     
     // Store the species molecular weights for faster access
     m_species_mw.resize(nSpecies());
@@ -136,6 +153,7 @@ Thermodynamics::~Thermodynamics()
     delete mp_thermodb;
     delete mp_equil;
     delete mp_state;
+    delete mp_diagnostics;
 }
 
 //==============================================================================
@@ -179,7 +197,7 @@ void Thermodynamics::setState(
     const double* const p_v1, const double* const p_v2, const int vars)
 {
     mp_state->setState(p_v1, p_v2, vars);
-    convert<X_TO_Y>(X(), mp_y);
+    m_y_valid = false;
 }
 
 //==============================================================================
@@ -275,6 +293,10 @@ const double* const Thermodynamics::X() const {
 //==============================================================================
 
 const double* const Thermodynamics::Y() const {
+    if (!m_y_valid) {
+        convert<X_TO_Y>(X(), mp_y);
+        m_y_valid = true;
+    }
     return mp_y;
 }
 
@@ -312,7 +334,7 @@ std::pair<int, int> Thermodynamics::equilibriumComposition(
 void Thermodynamics::equilibrate(double T, double P, double* const p_Xe) const
 {
     mp_state->equilibrate(T, P, p_Xe);
-    convert<X_TO_Y>(X(), mp_y);
+    m_y_valid = false;
 }
 
 //==============================================================================
@@ -716,7 +738,7 @@ void Thermodynamics::sumSpeciesMass(
 
     Map<VectorXd>(p_e, size) =
         Map<const Matrix<double, -1, -1, RowMajor> >(p_s, size, ns) *
-        Map<const VectorXd>(mp_y, ns);
+        Map<const VectorXd>(Y(), ns);
 }
 
 //==============================================================================
@@ -1042,8 +1064,7 @@ void Thermodynamics::speciesSTGOverRT(double T, double* const p_g) const {
 void Thermodynamics::elementMoles(
     const double *const species_N, double *const element_N) const
 {
-    Map<VectorXd>(element_N, nElements()) =
-        Map<const VectorXd>(species_N, nSpecies()) * m_element_matrix;
+    sumElements(species_N, element_N);
 }
 
 //==============================================================================
@@ -1059,19 +1080,10 @@ void Thermodynamics::elementFractions(
     //wrapper = wrapper / wrapper.sum();
 
     const int ne = nElements();
-    const int ns = nSpecies();
 
-    double temp = Xs[0];
-    for (int k = 0; k < ne; ++k)
-        Xe[k] = m_element_matrix(0,k)*temp;
+    sumElements(Xs, Xe);
 
-    for (int i = 1; i < ns; ++i) {
-        temp = Xs[i];
-        for (int k = 0; k < ne; ++k)
-            Xe[k] += m_element_matrix(i,k)*temp;
-    }
-
-    temp = 0.0;
+    double temp = 0.0;
     for (int k = 0; k < ne; ++k) {
         Xe[k] = std::max(0.0, Xe[k]);
         temp += Xe[k];
@@ -1083,6 +1095,43 @@ void Thermodynamics::elementFractions(
 
 //==============================================================================
 
+void Thermodynamics::convertDensities(
+    const double* const p_rho, double* const p_X, double* const p_Y,
+    double* const p_C, double* const p_Xe, int n) const
+{
+    const int ns = nSpecies();
+    const int ne = nElements();
+
+    for (int s = 0; s < n; ++s) {
+        const double* const rho = p_rho + std::size_t(s)*ns;
+        double* const X = (p_X == NULL ? mp_work1 : p_X + std::size_t(s)*ns);
+
+        // Species moles and the sums of both densities in one pass
+        double rho_sum = 0.0, conc_sum = 0.0;
+        for (int i = 0; i < ns; ++i) {
+            rho_sum += rho[i];
+            conc_sum += (X[i] = rho[i] / speciesMw(i));
+        }
+
+        if (p_C != NULL)
+            std::copy(X, X + ns, p_C + std::size_t(s)*ns);
+
+        if (p_Y != NULL) {
+            double* const Y = p_Y + std::size_t(s)*ns;
+            for (int i = 0; i < ns; ++i)
+                Y[i] = rho[i] / rho_sum;
+        }
+
+        for (int i = 0; i < ns; ++i)
+            X[i] /= conc_sum;
+
+        if (p_Xe != NULL)
+            convert<X_TO_XE>(X, p_Xe + std::size_t(s)*ne);
+    }
+}
+
+//==============================================================================
+
 void Thermodynamics::surfaceMassBalance(
     const double *const p_Yke, const double *const p_Ykg, const double T, 
     const double P, const double Bg, double &Bc, double &hw, double *const p_Xs)
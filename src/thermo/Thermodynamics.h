@@ -28,6 +28,7 @@
 #ifndef THERMO_THERMODYNAMICS_H
 #define THERMO_THERMODYNAMICS_H
 
+#include <algorithm>
 #include <map>
 #include <numeric>
 #include <string>
@@ -35,6 +36,7 @@
 
 #include "Species.h"
 #include "Constants.h"
+#include "Diagnostics.h"
 #include "ThermoDB.h"
 #include "MultiPhaseEquilSolver.h"
 
@@ -83,12 +85,14 @@ public:
     /**
      * Constructs a Thermodynamics object given a vector of species names.  The
      * names must correspond to defined species in the thermo database of 
-     * mutation++.
+     * mutation++.  If tabulate is true, the database may tabulate the species
+     * properties of each energy mode instead of evaluating them directly.
      */
     Thermodynamics(
         const std::string& species_descriptor,
         const std::string& database,
-        const std::string& state_model);
+        const std::string& state_model,
+        bool tabulate = false);
     
     /**
      * Destructor.
@@ -107,6 +111,14 @@ public:
         return mp_state;
     }
     
+    /**
+     * Returns the Diagnostics object which collects the non-fatal problems,
+     * such as unconverged temperatures, encountered by this mixture.
+     */
+    Diagnostics& diagnostics() const {
+        return *mp_diagnostics;
+    }
+
     /**
      * Returns a pointer to the Equilibrium solver object owned by this
      * Thermodynamics object.
@@ -442,7 +454,9 @@ public:
     const double* const X() const;
     
     /**
-     * Returns the current species mass fractions.
+     * Returns the current species mass fractions.  They are only computed
+     * from the mole fractions the first time they are needed after the state
+     * changes.
      */
     const double* const Y() const;
     
@@ -846,6 +860,18 @@ public:
      */
     void elementFractions(
         const double* const Xs, double* const Xe) const;
+
+    /**
+     * Computes the species mole fractions, mass fractions, molar densities in
+     * mol/m^3 and element mole fractions of n states from their species
+     * densities in kg/m^3, with a single pass over the species of each state.
+     * The states and each of the results are stored one after the other.  Any
+     * of the results may be NULL if it is not needed.  This gives the same
+     * values as the corresponding conversions with convert().
+     */
+    void convertDensities(
+        const double* const p_rho, double* const p_X, double* const p_Y,
+        double* const p_C = NULL, double* const p_Xe = NULL, int n = 1) const;
     
     /**
      * Converts species properties from one value to another such as mole to 
@@ -890,6 +916,21 @@ private:
 
     void sumSpeciesMass(
         const double* const p_s, double* const p_e, const int size) const;
+
+    /**
+     * Computes the sum over the species of the number of atoms of each
+     * element weighted by the species values, using the nonzero entries of
+     * the element matrix only.
+     */
+    void sumElements(const double* const p_s, double* const p_e) const {
+        std::fill(p_e, p_e + nElements(), 0.0);
+        for (int i = 0; i < nSpecies(); ++i) {
+            const double s = p_s[i];
+            for (int k = m_element_offsets[i]; k < m_element_offsets[i+1]; ++k)
+                p_e[m_element_entries[k].element] +=
+                    m_element_entries[k].atoms*s;
+        }
+    }
     
     /**
      * Loads the elements and species given by the species names vector from the
@@ -908,6 +949,12 @@ protected:
     std::map<std::string, int> m_element_indices;
 
 private:
+
+    /// A nonzero entry of the element matrix.
+    struct ElementEntry {
+        int element;
+        double atoms;
+    };
   
     ThermoDB* mp_thermodb;
     MultiPhaseEquilSolver* mp_equil;
@@ -915,12 +962,19 @@ private:
     
     Eigen::MatrixXd m_element_matrix;
     Eigen::ArrayXd m_species_mw;
+
+    // Nonzero entries of the element matrix, row by row, with the entries of
+    // species i in [m_element_offsets[i], m_element_offsets[i+1])
+    std::vector<ElementEntry> m_element_entries;
+    std::vector<int> m_element_offsets;
     
     double* mp_work1;
     double* mp_work2;
     double* mp_wrkcp;
-    double* mp_y;
+    mutable double* mp_y;
+    mutable bool m_y_valid;
     double* mp_default_composition;
+    Diagnostics* mp_diagnostics;
     
     bool m_has_electrons;
     int  m_natoms;
@@ -961,29 +1015,33 @@ inline void Thermodynamics::convert<CONC_TO_X>(
 template <>
 inline void Thermodynamics::convert<RHO_TO_X>(
     const double *const a, double *const b) const {
-    convert<RHO_TO_CONC>(a, b);
-    convert<CONC_TO_X>(b, b);        
+    double sum = 0.0;
+    for (int i = 0; i < nSpecies(); ++i)
+        sum += (b[i] = a[i] / speciesMw(i));
+    for (int i = 0; i < nSpecies(); ++i)
+        b[i] /= sum;
 }
 
 template <>
 inline void Thermodynamics::convert<CONC_TO_Y>(
     const double *const a, double *const b) const {
-    convert<CONC_TO_RHO>(a, b);
-    convert<RHO_TO_Y>(b, b);
+    double sum = 0.0;
+    for (int i = 0; i < nSpecies(); ++i)
+        sum += (b[i] = a[i] * speciesMw(i));
+    for (int i = 0; i < nSpecies(); ++i)
+        b[i] /= sum;
 }
 
 template <>
 inline void Thermodynamics::convert<X_TO_Y>(
     const double *const a, double *const b) const {
-    convert<CONC_TO_RHO>(a, b);
-    convert<RHO_TO_Y>(b, b);
+    convert<CONC_TO_Y>(a, b);
 }
 
 template <>
 inline void Thermodynamics::convert<Y_TO_X>(
     const double *const a, double *const b) const {
-    convert<RHO_TO_CONC>(a, b);
-    convert<CONC_TO_X>(b, b);
+    convert<RHO_TO_X>(a, b);
 }
 
 template <>
@@ -1010,11 +1068,10 @@ template <>
 inline void Thermodynamics::convert<X_TO_XE>(
     const double *const a, double *const b) const
 {
-    Eigen::Map<const Eigen::VectorXd> X(a, nSpecies());
-    Eigen::Map<Eigen::VectorXd> Xe(b, nElements());
-
-    Xe = m_element_matrix.transpose() * X;
-    Xe /= Xe.sum();
+    sumElements(a, b);
+    const double sum = std::accumulate(b, b + nElements(), 0.0);
+    for (int i = 0; i < nElements(); ++i)
+        b[i] /= sum;
 }
 
 
@@ -1022,17 +1079,19 @@ template <>
 inline void Thermodynamics::convert<Y_TO_YE>(
         const double *const a, double *const b) const {
 
-    Eigen::Map<Eigen::VectorXd> Ye(b, nElements());
-
-    Ye.setZero();
-
-    for (int j = 0; j < nSpecies(); ++j)
-        Ye += (a[j]/speciesMw(j)) * elementMatrix().row(j);
+    std::fill(b, b + nElements(), 0.0);
+    for (int j = 0; j < nSpecies(); ++j) {
+        const double moles = a[j]/speciesMw(j);
+        for (int k = m_element_offsets[j]; k < m_element_offsets[j+1]; ++k)
+            b[m_element_entries[k].element] +=
+                moles*m_element_entries[k].atoms;
+    }
 
+    double sum = 0.0;
     for (int i = 0; i < nElements(); ++i)
-            Ye(i) *= atomicMass(i);
-
-    Ye /= Ye.sum();
+        sum += (b[i] *= atomicMass(i));
+    for (int i = 0; i < nElements(); ++i)
+        b[i] /= sum;
 
 }
 
@@ -41,25 +41,53 @@ class OmegaCE : public TransferModel
 {
 public:
 	OmegaCE(Mutation::Mixture& mix)
-		: TransferModel(mix)
+		: TransferModel(mix), m_cv(1.5*RU/mix.speciesMw(0))
 	{
 		mp_wrk1 = new double [mix.nSpecies()];
+		mp_dwdT = new double [mix.nSpecies()];
+		mp_dwdTv = new double [mix.nSpecies()];
+		mp_jac = new double [mix.nSpecies()*mix.nSpecies()];
 	}
 
 	~OmegaCE()
 	{
 		delete [] mp_wrk1;
+		delete [] mp_dwdT;
+		delete [] mp_dwdTv;
+		delete [] mp_jac;
 	}
 
 	double source()
 	{
-		static const double cv = 1.5*RU/m_mixture.speciesMw(0);
 		m_mixture.netProductionRates(mp_wrk1);
-		return mp_wrk1[0]*cv*m_mixture.Te();
+		return mp_wrk1[0]*m_cv*m_mixture.Te();
+	}
+
+	/**
+	 * Computes the derivatives of the Chemistry-Electron source term from the
+	 * electron production rate Jacobians.
+	 */
+	void jacobian(double* const p_jac)
+	{
+		const int ns = m_mixture.nSpecies();
+		const double Te = m_mixture.Te();
+
+		m_mixture.netProductionRates(mp_wrk1);
+		m_mixture.jacobianRho(mp_jac);
+		m_mixture.jacobianTTv(mp_dwdT, mp_dwdTv);
+
+		for (int j = 0; j < ns; ++j)
+			p_jac[j] = mp_jac[j]*m_cv*Te;
+		p_jac[ns]   = mp_dwdT[0]*m_cv*Te;
+		p_jac[ns+1] = mp_dwdTv[0]*m_cv*Te + mp_wrk1[0]*m_cv;
 	}
 
 private:
+	const double m_cv;
 	double* mp_wrk1;
+	double* mp_dwdT;
+	double* mp_dwdTv;
+	double* mp_jac;
 };
 
 // Register the transfer model
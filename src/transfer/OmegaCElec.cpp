@@ -48,12 +48,20 @@ public:
 	{
 		mp_wrk1 = new double [mix.nSpecies()];
 		mp_wrk2 = new double [mix.nSpecies()];
+		mp_wrk3 = new double [mix.nSpecies()];
+		mp_dwdT = new double [mix.nSpecies()];
+		mp_dwdTv = new double [mix.nSpecies()];
+		mp_jac = new double [mix.nSpecies()*mix.nSpecies()];
 	};
 
 	~OmegaCElec()
 	{
 		delete [] mp_wrk1;
 		delete [] mp_wrk2;
+		delete [] mp_wrk3;
+		delete [] mp_dwdT;
+		delete [] mp_dwdTv;
+		delete [] mp_jac;
 	};
 
 	double source()
@@ -69,9 +77,42 @@ public:
 		return (sum*m_mixture.T()*RU);
 	}
 
+	/**
+	 * Computes the derivatives of the Chemistry-Electronic source term from the
+	 * species production rate Jacobians.
+	 */
+	void jacobian(double* const p_jac)
+	{
+		const int ns = m_mixture.nSpecies();
+		const double T = m_mixture.T();
+
+		m_mixture.speciesHOverRT(NULL, NULL, NULL, NULL, mp_wrk1, NULL);
+		m_mixture.speciesCpOverR(
+			T, m_mixture.Te(), m_mixture.Tr(), m_mixture.Tv(), m_mixture.Tel(),
+			NULL, NULL, NULL, NULL, mp_wrk3);
+
+		m_mixture.netProductionRates(mp_wrk2);
+		m_mixture.jacobianRho(mp_jac);
+		m_mixture.jacobianTTv(mp_dwdT, mp_dwdTv);
+
+		std::fill(p_jac, p_jac+ns+2, 0.0);
+		for (int i = 0; i < ns; ++i) {
+			const double eel = mp_wrk1[i]*T*RU/m_mixture.speciesMw(i);
+			const double cel = mp_wrk3[i]*RU/m_mixture.speciesMw(i);
+			for (int j = 0; j < ns; ++j)
+				p_jac[j] += eel*mp_jac[i*ns+j];
+			p_jac[ns]   += eel*mp_dwdT[i];
+			p_jac[ns+1] += eel*mp_dwdTv[i] + cel*mp_wrk2[i];
+		}
+	}
+
 private:
 	double* mp_wrk1;
 	double* mp_wrk2;
+	double* mp_wrk3;
+	double* mp_dwdT;
+	double* mp_dwdTv;
+	double* mp_jac;
 };
 
 // Register the transfer model
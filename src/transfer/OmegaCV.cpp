@@ -62,12 +62,20 @@ public:
 		m_ns = m_mixture.nSpecies();
 		mp_wrk1 = new double [m_ns];
 		mp_wrk2 = new double [m_ns];
+		mp_wrk3 = new double [m_ns];
+		mp_dwdT = new double [m_ns];
+		mp_dwdTv = new double [m_ns];
+		mp_jac = new double [m_ns*m_ns];
 	};
 
 	~OmegaCV()
 	{
 		delete [] mp_wrk1;
 		delete [] mp_wrk2;
+		delete [] mp_wrk3;
+		delete [] mp_dwdT;
+		delete [] mp_dwdTv;
+		delete [] mp_jac;
 	};
 /**
  * Computes the source terms of the Vibration-Chemistry energy transfer in \f$ [J/(m^3\cdot s)] \f$
@@ -83,15 +91,56 @@ public:
 			  return compute_source_Candler();
 		  break;
 		   default:
-			  std::cerr << "The selected Chemistry-Vibration-Chemistry model is not implemented yet";
+			  m_mixture.diagnostics().report(
+			      Diagnostics::MODEL_NOT_IMPLEMENTED)
+			      << "The selected Chemistry-Vibration-Chemistry model is "
+			      << "not implemented yet";
 			  return 0.0;
 		}
 	}
 
+/**
+ * Computes the derivatives of the non-preferential Vibration-Chemistry source
+ * term from the species production rate Jacobians
+ *
+ * \f[ \frac{\partial \Omega^{CV}}{\partial x} = \sum_i e^V_i
+ *     \frac{\partial \dot{\omega}_i}{\partial x} +
+ *     \dot{\omega}_i \frac{\partial e^V_i}{\partial x} \f]
+ */
+	void jacobian(double* const p_jac)
+	{
+		const double T = m_mixture.T();
+
+		// Getting Vibrational Energy and Specific Heat
+		m_mixture.speciesHOverRT(NULL, NULL, NULL, mp_wrk1, NULL, NULL);
+		m_mixture.speciesCpOverR(
+			T, m_mixture.Te(), m_mixture.Tr(), m_mixture.Tv(), m_mixture.Tel(),
+			NULL, NULL, NULL, mp_wrk3, NULL);
+
+		// Getting Production Rate and its Jacobians
+		m_mixture.netProductionRates(mp_wrk2);
+		m_mixture.jacobianRho(mp_jac);
+		m_mixture.jacobianTTv(mp_dwdT, mp_dwdTv);
+
+		std::fill(p_jac, p_jac+m_ns+2, 0.0);
+		for (int i = 0; i < m_ns; ++i) {
+			const double ev = mp_wrk1[i]*T*RU/m_mixture.speciesMw(i);
+			const double cv = mp_wrk3[i]*RU/m_mixture.speciesMw(i);
+			for (int j = 0; j < m_ns; ++j)
+				p_jac[j] += ev*mp_jac[i*m_ns+j];
+			p_jac[m_ns]   += ev*mp_dwdT[i];
+			p_jac[m_ns+1] += ev*mp_dwdTv[i] + cv*mp_wrk2[i];
+		}
+	}
+
 private:
 	int m_ns;
 	double* mp_wrk1;
 	double* mp_wrk2;
+	double* mp_wrk3;
+	double* mp_dwdT;
+	double* mp_dwdTv;
+	double* mp_jac;
 
 	double const compute_source_Candler();
 };
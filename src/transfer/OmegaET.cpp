@@ -67,26 +67,69 @@ public:
 	    if (!m_has_electrons)
 		    return 0.0;
 
-	    const double * p_X = m_mixture.X();
-        double nd = m_mixture.numberDensity();
-        double T = m_mixture.T();
-        double Te = m_mixture.Te();
+        const double ne = m_mixture.numberDensity()*m_mixture.X()[0];
+        const double T = m_mixture.T();
+        const double Te = m_mixture.Te();
 
-        const double ns = m_mixture.nSpecies();
-        Map<const ArrayXd> X(m_mixture.X(),ns);
+        return 1.5*KB*ne*(T-Te)*relaxationFrequency();
+	}
+
+	/**
+	 * Computes the derivatives of the electron-heavy translational energy
+	 * transfer.  The collision integrals are held constant, so that the
+	 * derivatives with respect to the electron density and temperature
+	 * neglect the dependence of \f$\overline{\Omega}_{ej}^{11}\f$ on the
+	 * electron temperature and Debye length.
+	 */
+	void jacobian(double* const p_jac)
+	{
+	    const int ns = m_mixture.nSpecies();
+	    std::fill(p_jac, p_jac+ns+2, 0.0);
+
+	    if (!m_has_electrons)
+		    return;
+
+        const double* p_Y = m_mixture.Y();
+        const double rho = m_mixture.density();
+        const double T = m_mixture.T();
+        const double Te = m_mixture.Te();
 
         // CollisionDB data
         const ArrayXd& Q11ei = m_collisions.Q11ei();
         const ArrayXd& mass  = m_collisions.mass();
 
-        // Electron velocity
-        double ve = sqrt(KB*8.*Te/(PI*mass(0)));
-        double tau = 1.0/(mass(0)*8./3.*ve*nd*(X*Q11ei/mass).tail(ns-1).sum());
+        // Electron velocity and relaxation frequency
+        const double ve = sqrt(KB*8.*Te/(PI*mass(0)));
+        const double fac = mass(0)*8./3.*ve;
+        const double nu = relaxationFrequency();
 
-        return 1.5*KB*nd*p_X[0]*(T-Te)/tau;
+        const double ne = rho*p_Y[0]/mass(0);
+        const double omega = 1.5*KB*ne*(T-Te)*nu;
+
+        p_jac[0] = 1.5*KB*(T-Te)*nu/mass(0);
+        for (int j = 1; j < ns; ++j)
+            p_jac[j] = 1.5*KB*ne*(T-Te)*fac*Q11ei(j)/(mass(j)*mass(j));
+        p_jac[ns]   = 1.5*KB*ne*nu;
+        p_jac[ns+1] = -1.5*KB*ne*nu + 0.5*omega/Te;
 	}
 
 private:
+
+	/**
+	 * Returns the relaxation frequency \f$ 1/\tau^{ET} \f$ from the cached
+	 * electron-heavy collision frequencies.
+	 */
+	double relaxationFrequency()
+	{
+	    const Eigen::ArrayXd& nu   = m_collisions.nuei();
+	    const Eigen::ArrayXd& mass = m_collisions.mass();
+
+	    double sum = 0.0;
+	    for (int j = 1; j < nu.size(); ++j)
+	        sum += nu(j)/mass(j);
+	    return mass(0)*sum;
+	}
+
 	Transport::CollisionDB& m_collisions;
 	bool m_has_electrons;
 
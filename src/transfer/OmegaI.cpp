@@ -48,6 +48,8 @@ public:
         mp_h = new double [m_ns];
         mp_rate = new double [m_nr];
         mp_delta = new double [m_nr];
+        mp_drate = new double [m_nr];
+        mp_jac = new double [m_nr*m_ns];
         for(int i=0; i<m_nr; ++i) {
             if ( (mix.reactions()[i].type() == Kinetics::IONIZATION_E)
                 || (mix.reactions()[i].type() == Kinetics::DISSOCIATION_E)
@@ -65,6 +67,8 @@ public:
         delete [] mp_h;
         delete [] mp_rate;
         delete [] mp_delta;
+        delete [] mp_drate;
+        delete [] mp_jac;
     };
 
     /**
@@ -104,6 +108,35 @@ public:
 
     }
 
+    /**
+     * Computes the derivatives of the Electron-Impact reactions heat
+     * generation from the Jacobians of the molar rates of progress.  The
+     * reaction enthalpies are formation enthalpies and do not depend on
+     * temperature.
+     */
+    void jacobian(double* const p_jac)
+    {
+        // Get reaction enthalpies
+        m_mixture.speciesHOverRT(mp_h, NULL, NULL, NULL, NULL, mp_hf);
+        std::fill(mp_delta, mp_delta+m_nr, 0.0);
+        m_mixture.getReactionDelta(mp_hf,mp_delta);
+
+        // Get derivatives of the molar rates of progress
+        m_mixture.ropJacobianRho(mp_jac);
+        m_mixture.ropJacobianTTv(mp_rate, mp_drate);
+
+        std::fill(p_jac, p_jac+m_ns+2, 0.0);
+        const double fac = -RU*m_mixture.T();
+        int j;
+        for (int i = 0; i < m_rId.size(); ++i) {
+            j = m_rId[i];
+            for (int k = 0; k < m_ns; ++k)
+                p_jac[k] += fac*mp_delta[j]*mp_jac[j*m_ns+k];
+            p_jac[m_ns]   += fac*mp_delta[j]*mp_rate[j];
+            p_jac[m_ns+1] += fac*mp_delta[j]*mp_drate[j];
+        }
+    }
+
 private:
     int m_ns;
     int m_nr;
@@ -112,6 +145,8 @@ private:
     double* mp_h;
     double* mp_rate;
     double* mp_delta;
+    double* mp_drate;
+    double* mp_jac;
 };
   
 // Register the transfer model
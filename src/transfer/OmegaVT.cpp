@@ -30,6 +30,9 @@
 #include "TransferModel.h"
 #include <cmath>
 
+#include <eigen3/Eigen/Dense>
+using namespace Eigen;
+
 using namespace Mutation;
 
 namespace Mutation {
@@ -43,7 +46,7 @@ class OmegaVT : public TransferModel
 public:
 
     OmegaVT(Mixture& mix)
-        : TransferModel(mix), m_mw(mix)
+        : TransferModel(mix)
     {
         m_const_Park_correction = std::sqrt(PI*KB/(8.E0*NA));
         m_ns              = m_mixture.nSpecies();
@@ -54,6 +57,34 @@ public:
             mp_Mw[i] = m_mixture.speciesMw(i);
         mp_hv = new double [m_ns];
         mp_hveq = new double [m_ns];
+        mp_cpv = new double [m_ns];
+        mp_cpveq = new double [m_ns];
+
+        // Store the Millikan-White data as dense vibrator x partner matrices
+        MillikanWhite mw(m_mixture);
+        const int nv = mw.nVibrators();
+        const int nh = m_mixture.nHeavy();
+
+        m_index.resize(nv);
+        m_omega.resize(nv);
+        m_a.resize(nv, nh);
+        m_b.resize(nv, nh);
+        m_sqrt_mu.resize(nv, nh);
+
+        for (int m = 0; m < nv; ++m) {
+            m_index[m] = mw[m].index();
+            m_omega[m] = mw[m].omega();
+            for (int j = 0; j < nh; ++j) {
+                m_a(m,j) = mw[m][j].a();
+                m_b(m,j) = mw[m][j].b();
+                m_sqrt_mu(m,j) = std::sqrt(mw[m][j].mu());
+            }
+        }
+
+        m_tau_mj.resize(nv, nh);
+        m_dtau_mj.resize(nv, nh);
+        m_tau_m.resize(nv);
+        m_nj.resize(nh);
     }
 
     virtual ~OmegaVT()
@@ -61,6 +92,8 @@ public:
         delete [] mp_Mw;
         delete [] mp_hv;
         delete [] mp_hveq;
+        delete [] mp_cpv;
+        delete [] mp_cpveq;
     }
 
     /**
@@ -88,54 +121,97 @@ public:
         m_mixture.speciesHOverRT(T, T, T, T, T, NULL, NULL, NULL, mp_hveq, NULL, NULL);
         m_mixture.speciesHOverRT(T, Tv, T, Tv, Tv, NULL, NULL, NULL, mp_hv, NULL, NULL);
 
-        int inv = 0;
+        compute_tau_VT_m();
+
         double src = 0.0;
-        for (int iv = 0; iv-inv < m_mw.nVibrators(); ++iv){
-            if(m_mixture.species(iv).type() != Mutation::Thermodynamics::MOLECULE){
-                inv++;
-            } else {
-                src += p_Y[iv]*rho*RU*T/mp_Mw[iv]*(mp_hveq[iv] - mp_hv[iv])/compute_tau_VT_m(iv-inv);
-            }
+        for (int m = 0; m < m_index.size(); ++m) {
+            const int iv = m_index[m];
+            src += p_Y[iv]*rho*RU*T/mp_Mw[iv]*(mp_hveq[iv] - mp_hv[iv])/m_tau_m[m];
         }
         return src;
     }
 
-private:
+    /**
+     * Computes the derivatives of the VT source term.  Writing the averaged
+     * relaxation frequency as
+     * \f[ \frac{1}{\tau^{VT}_m} = \frac{1}{n_h}
+     *     \sum_{j \in \mathcal{H}} \frac{n_j}{\tau^{VT}_{mj}}, \f]
+     * where \f$ n_j = \rho_j / M_j \f$ and every \f$ \tau^{VT}_{mj} \f$ is
+     * inversely proportional to the pressure, the derivatives follow from
+     * those of the pressure, the species moles, the vibrational energies, and
+     * the temperature dependence of the Millikan-White and Park relaxation
+     * times.
+     */
+    void jacobian(double* const p_jac)
+    {
+        const double* p_Y = m_mixture.Y();
+        const double rho = m_mixture.density();
+        const double T  = m_mixture.T();
+        const double Tv = m_mixture.Tv();
+        const double P  = m_mixture.P();
+        const int nh = m_nj.size();
+
+        m_mixture.speciesHOverRT(T, T, T, T, T, NULL, NULL, NULL, mp_hveq, NULL, NULL);
+        m_mixture.speciesHOverRT(T, Tv, T, Tv, Tv, NULL, NULL, NULL, mp_hv, NULL, NULL);
+        m_mixture.speciesCpOverR(T, T, T, T, T, NULL, NULL, NULL, mp_cpveq, NULL);
+        m_mixture.speciesCpOverR(T, Tv, T, Tv, Tv, NULL, NULL, NULL, mp_cpv, NULL);
+
+        compute_tau_VT_m();
+        compute_dtau_VT_mj();
+
+        // Heavy particle moles and derivatives of the pressure
+        const double n_h = rho*m_nj.sum();
+        const double dPdT = RU*n_h;
+        const double dPdTv = (m_transfer_offset == 1 ? RU*rho*p_Y[0]/mp_Mw[0] : 0.0);
 
-    MillikanWhite m_mw;
+        std::fill(p_jac, p_jac+m_ns+2, 0.0);
 
-   /**
-    * @brief This function computes the Millikan and White relaxation time
-    * for each diatomic collision
-    *
-    * @param vibrator index
-    * @param partner index
-    *
-    * @return Millikan and White relaxation time \tau_{m,j}^{MW}
-    */
+        for (int m = 0; m < m_index.size(); ++m) {
+            const int iv = m_index[m];
+            const double rho_m = rho*p_Y[iv];
+            const double de = RU*T/mp_Mw[iv]*(mp_hveq[iv] - mp_hv[iv]);
+            const double freq = 1.0/m_tau_m[m];
+            const double omega = rho_m*de*freq;
 
-   inline double const compute_tau_VT_mj(int const, int const);
+            // Density derivatives
+            p_jac[iv] += de*freq;
+            for (int j = 0; j < nh; ++j) {
+                const int k = j + m_transfer_offset;
+                p_jac[k] += omega*RU*T/(mp_Mw[k]*P) +
+                    rho_m*de*(1.0/m_tau_mj(m,j) - freq)/(mp_Mw[k]*n_h);
+            }
+            if (m_transfer_offset == 1)
+                p_jac[0] += omega*RU*m_mixture.Te()/(mp_Mw[0]*P);
+
+            // Temperature derivatives
+            double dfreq = 0.0;
+            for (int j = 0; j < nh; ++j)
+                dfreq += m_nj[j]*m_dtau_mj(m,j)/(m_tau_mj(m,j)*m_tau_mj(m,j));
+            dfreq = freq*dPdT/P - rho*dfreq/n_h;
+
+            p_jac[m_ns]   += rho_m*RU*mp_cpveq[iv]/mp_Mw[iv]*freq + rho_m*de*dfreq;
+            p_jac[m_ns+1] += -rho_m*RU*mp_cpv[iv]/mp_Mw[iv]*freq + omega*dPdTv/P;
+        }
+    }
+
+private:
 
     /**
-     * @brief Computes the frequency average over heavy particles.
-     * @param vibrator index
-     *
-     * @return
+     * @brief Computes the frequency averaged relaxation time of every vibrator
+     * over the heavy particles for the current state.  The temperature and
+     * pressure dependent factors are evaluated once, after which the matrix of
+     * Millikan-White relaxation times with Park's correction,
+     * \f$ \tau_{m,j}^{MW} + \tau_{m,j}^P \f$, is computed in a single pass
+     * over all vibrator-partner pairs.
      */
-    double compute_tau_VT_m(int const);
+    void compute_tau_VT_m();
 
     /**
-     * @brief This function computes the Park correction
-     * for vibrational-translational energy transfer
-     * for each collision pair.
-     *
-     * @param vibrator index
-     * @param partner index
-     *
-     * @return Park correction \tau_{m,j}^P
+     * @brief Computes the derivatives of the vibrator-partner relaxation times
+     * with respect to the translational temperature at constant pressure.
+     * Must be called after compute_tau_VT_m().
      */
-
-    inline double const compute_Park_correction_VT(int const, int const);
+    void compute_dtau_VT_mj();
 
     /**
      * Necessary variables
@@ -145,53 +221,65 @@ private:
     double* mp_Mw;
     double* mp_hv;
     double* mp_hveq;
+    double* mp_cpv;
+    double* mp_cpveq;
 
     double m_const_Park_correction;
+
+    // Millikan-White data (vibrator x partner)
+    std::vector<int> m_index;
+    ArrayXd  m_omega;
+    ArrayXXd m_a;
+    ArrayXXd m_b;
+    ArrayXXd m_sqrt_mu;
+
+    // Work arrays
+    ArrayXXd m_tau_mj;
+    ArrayXXd m_dtau_mj;
+    VectorXd m_tau_m;
+    VectorXd m_nj;
 };
       
 // Implementation of the Vibrational-Translational Energy Transfer.
-      
-inline double const OmegaVT::compute_Park_correction_VT(int const i_vibrator, int const i_partner)
-{
-    // Limiting cross section for Park's Correction
-    double P = m_mixture.P();
-    double T = m_mixture.T();
-
-    double sigma;
-    if (T > 20000.0) {
-      sigma = m_mw[i_vibrator].omega() * 6.25 ; // 6.25 = (50000/20000)^2
-    } else {
-      sigma = m_mw[i_vibrator].omega() *(2.5E9/(T*T));
-    }
-    
-    return(m_const_Park_correction * sqrt(m_mw[i_vibrator][i_partner].mu()*T)/(sigma*P));
-}
 
- 
-inline double const OmegaVT::compute_tau_VT_mj(int const i_vibrator, int const i_partner)
+void OmegaVT::compute_tau_VT_m()
 {
-//    Enable in the future for multiple vibrational temperatures
-      double P = m_mixture.P();
-      double T = m_mixture.T();
+    const double * p_Y = m_mixture.Y();
+    const double P = m_mixture.P();
+    const double T = m_mixture.T();
+
+    // Limiting cross section for Park's Correction (6.25 = (50000/20000)^2)
+    const double sigma_fac = (T > 20000.0 ? 6.25 : 2.5E9/(T*T));
+    const double park_fac =
+        m_const_Park_correction*std::sqrt(T)/(sigma_fac*P);
 
-      return( exp( m_mw[i_vibrator][i_partner].a() * (pow(T,-1.0/3.0) - m_mw[i_vibrator][i_partner].b()) -18.421) * ONEATM / P );
+    // Millikan-White relaxation times plus Park's correction for all pairs
+    m_tau_mj = (m_a*(std::pow(T,-1.0/3.0) - m_b) - 18.421).exp()*(ONEATM/P) +
+        m_sqrt_mu.colwise()*(park_fac/m_omega);
+
+    // Frequency average over the heavy particles
+    for (int j = 0; j < m_nj.size(); ++j)
+        m_nj[j] = p_Y[j+m_transfer_offset]/mp_Mw[j+m_transfer_offset];
+
+    m_tau_m = m_tau_mj.inverse().matrix()*m_nj;
+    m_tau_m = m_tau_m.cwiseInverse()*m_nj.sum();
 }
-      
-double OmegaVT::compute_tau_VT_m(int const i_vibrator)
+
+void OmegaVT::compute_dtau_VT_mj()
 {
-    const double * p_Y = m_mixture.Y();
-    
-    double sum1 = 0.0;
-    double sum2 = 0.0;
-    
-    // Partner offset
-    for (int i_partner = m_transfer_offset; i_partner < m_ns; ++i_partner){
-        double tau_j = compute_tau_VT_mj(i_vibrator, i_partner-m_transfer_offset) + compute_Park_correction_VT(i_vibrator, i_partner-m_transfer_offset);
-        sum1 += p_Y[i_partner]/(mp_Mw[i_partner]);
-        sum2 += p_Y[i_partner]/(mp_Mw[i_partner]*tau_j);
-    }
-  
-    return(sum1/sum2);
+    const double P = m_mixture.P();
+    const double T = m_mixture.T();
+
+    // Park's correction goes as T^2.5 below 20000 K and T^0.5 above
+    const double sigma_fac = (T > 20000.0 ? 6.25 : 2.5E9/(T*T));
+    const double park_fac =
+        m_const_Park_correction*std::sqrt(T)/(sigma_fac*P);
+    const double park_exp = (T > 20000.0 ? 0.5 : 2.5);
+    const double t13 = std::pow(T,-1.0/3.0);
+
+    m_dtau_mj =
+        (m_a*(t13 - m_b) - 18.421).exp()*(ONEATM/P)*m_a*(-t13/(3.0*T)) +
+        m_sqrt_mu.colwise()*(park_exp/T*park_fac/m_omega);
 }
 
 
@@ -28,6 +28,8 @@
 #ifndef TRANSFER_TRANSFER_MODEL_H
 #define TRANSFER_TRANSFER_MODEL_H
 
+#include "Errors.h"
+
 namespace Mutation {
 
 	// Forward declaration of Mixture type
@@ -74,6 +76,21 @@ public:
  */
     virtual double source() = 0;
 
+/**
+ *@brief Computes the analytic derivatives of the source term with respect to
+ * the species densities, the translational temperature, and the
+ * vibrational-electronic temperature (equal to the electron temperature) at
+ * the current state of the mixture.
+ *
+ * @param p_jac on return, the row of length ns+2 ordered as
+ * \f$ [\partial\Omega/\partial\rho_1, \dots,
+ * \partial\Omega/\partial\rho_{ns}, \partial\Omega/\partial T,
+ * \partial\Omega/\partial T_v] \f$
+ */
+    virtual void jacobian(double* const p_jac) {
+        throw NotImplementedError("TransferModel::jacobian()");
+    }
+
 protected:
     Mutation::Mixture& m_mixture;
 };
@@ -53,7 +53,7 @@ BrunoEq11ColInt::BrunoEq11ColInt(CollisionIntegral::ARGS args) :
             args.xml.parseError("Must provide 7 coefficients.");
 }
 
-double BrunoEq11ColInt::compute_(double T)
+double BrunoEq11ColInt::compute_(double T) const
 {
     double x  = std::log(T);
     double e1 = std::exp((x - m_a[2])/m_a[3]);
@@ -86,7 +86,7 @@ BrunoEq17ColInt::BrunoEq17ColInt(CollisionIntegral::ARGS args) :
 }
 
 
-double BrunoEq17ColInt::compute_(double T)
+double BrunoEq17ColInt::compute_(double T) const
 {
     double x  = std::log(T);
     return m_d[0] + x*(m_d[1] + x*m_d[2]);
@@ -118,7 +118,7 @@ BrunoEq19ColInt::BrunoEq19ColInt(CollisionIntegral::ARGS args) :
             args.xml.parseError("Must provide 8 coefficients.");
 }
 
-double BrunoEq19ColInt::compute_(double T)
+double BrunoEq19ColInt::compute_(double T) const
 {
     double x  = std::log(T);
     double e1 = std::exp((x-m_g[0])/m_g[1]);
@@ -179,7 +179,7 @@ PiraniColInt::PiraniColInt(CollisionIntegral::ARGS args) :
     m_a = iter->second * b;
 }
 
-double PiraniColInt::compute_(double T)
+double PiraniColInt::compute_(double T) const
 {
     const double x  = std::log(KB*T/m_phi0);
     const double e1 = std::exp((x - m_a[2])/m_a[3]);
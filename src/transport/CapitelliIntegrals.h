@@ -61,7 +61,7 @@ class BrunoEq11ColInt : public CapitelliIntegral
 public:
     BrunoEq11ColInt(CollisionIntegral::ARGS args);
 private:
-    double compute_(double T);
+    double compute_(double T) const;
 
     /**
      * Returns true if the coefficients are the same.
@@ -83,7 +83,7 @@ public:
     BrunoEq17ColInt(CollisionIntegral::ARGS args);
     virtual bool canTabulate() const { return true; }
 private:
-    double compute_(double T);
+    double compute_(double T) const;
 
     /**
      * Returns true if the coefficients are the same.
@@ -105,7 +105,7 @@ public:
     BrunoEq19ColInt(CollisionIntegral::ARGS args);
     virtual bool canTabulate() const { return true; }
 private:
-    double compute_(double T);
+    double compute_(double T) const;
 
     /**
      * Returns true if the coefficients are the same.
@@ -128,7 +128,7 @@ public:
     virtual bool loaded() const { return m_loaded; }
 
 private:
-    double compute_(double T);
+    double compute_(double T) const;
 
     /**
      * Returns true if the coefficients are the same.
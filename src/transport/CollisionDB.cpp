@@ -39,7 +39,9 @@ using namespace Eigen;
 
 #include <cassert>
 #include <fstream>
+#include <iomanip>
 #include <iostream>
+#include <sstream>
 using namespace std;
 
 namespace Mutation {
@@ -61,10 +63,12 @@ CollisionDB::CollisionDB(
     m_nDij(m_nh*(m_nh+1)/2),
     m_Dijfac(m_nh*(m_nh+1)/2),
     m_Dim(m_ng),
+    m_nuei(m_ng*(thermo.hasElectrons() ? 1 : 0)),
     m_L01ei(m_ng*(thermo.hasElectrons() ? 1 : 0)),
     m_L02ei(m_ng*(thermo.hasElectrons() ? 1 : 0))
 {
     XmlElement& root = m_database.root();
+    bool prebuild = false;
 
     // Load global options
     XmlElement::const_iterator opts = root.findTag("global-options");
@@ -76,6 +80,7 @@ CollisionDB::CollisionDB(
             tabulate->getAttribute("Tmin", m_table_min, m_table_min);
             tabulate->getAttribute("Tmax", m_table_max, m_table_max);
             tabulate->getAttribute("dT",   m_table_del, m_table_del);
+            tabulate->getAttribute("prebuild", prebuild, prebuild);
         }
 
         // Check the table data
@@ -91,6 +96,18 @@ CollisionDB::CollisionDB(
         }
     }
 
+    // Tables depend on the whole database and the grid, which form the base
+    // of the keys identifying the tables in the table cache and between the
+    // processes sharing them
+    if (m_tabulate && (TableCache::enabled() || SharedTable::enabled())) {
+        IO::DataFileStream file(databaseFileName(db_name, "transport"));
+        stringstream contents, key;
+        contents << file.rdbuf();
+        key << setprecision(17) << m_table_min << " " << m_table_max << " "
+            << m_table_del << " " << TableCache::digest(contents.str());
+        m_table_key = key.str();
+    }
+
     // Loop over the species and create the list of species pairs
     const vector<Species>& species = m_thermo.species();
     for (int i = 0; i < nSpecies(); ++i)
@@ -117,6 +134,10 @@ CollisionDB::CollisionDB(
         for (int j = i; j < nSpecies(); ++j, index++)
             m_Dijfac(index) = 3./16.*std::sqrt(TWOPI*KB*
                 (m_mass(i)+m_mass(j))/(m_mass(i)*m_mass(j)));
+
+    // Build all the tables now instead of on first use if requested
+    if (prebuild)
+        tabulate();
 }
 
 //==============================================================================
@@ -164,15 +185,19 @@ const CollisionGroup& CollisionDB::group(const string& name)
     GroupType type = groupType(name);
     assert(type != BAD_TYPE);
 
-    // Check if this group is already being managed
-    map<string, CollisionGroup>::iterator iter = m_groups.find(name);
-    if (iter != m_groups.end()) return iter->second.update(
+    // Compute integrals and return the group
+    return loadGroup(name, type).update(
         (type < II ? m_thermo.Te() : m_thermo.T()), m_thermo);
+}
 
-    // Create a new group to manage this type
-    CollisionGroup& new_group = m_groups.insert(
-        make_pair(name, CollisionGroup(
-            m_tabulate, m_table_min, m_table_max, m_table_del))).first->second;
+//==============================================================================
+
+CollisionGroup& CollisionDB::loadGroup(const string& name, GroupType type)
+{
+    // Check if this group is already being managed
+    map<string, CollisionGroup>::iterator iter = m_groups.find(name);
+    if (iter != m_groups.end())
+        return iter->second;
 
     // Determine start and end iterator for this group
     const int ns = nSpecies();
@@ -202,13 +227,54 @@ const CollisionGroup& CollisionDB::group(const string& name)
         exit(1);
     }
 
+    // The cached table is specific to this group and its collision pairs
+    string key;
+    if (!m_table_key.empty()) {
+        key = m_table_key + "\n" + name;
+        for (std::vector<CollisionPair>::iterator it = start; it != end; ++it)
+            key += it->name();
+    }
+
+    // Create a new group to manage this type
+    CollisionGroup& new_group = m_groups.insert(
+        make_pair(name, CollisionGroup(
+            m_tabulate, m_table_min, m_table_max, m_table_del, key))
+        ).first->second;
+
     // Manage the collision integrals
     string kind = name.substr(0, name.length()-2);
-    new_group.manage(start, end, &CollisionPair::get, kind);
+    try {
+        new_group.manage(start, end, &CollisionPair::get, kind);
+    } catch (Error&) {
+        m_groups.erase(name);
+        throw;
+    }
 
-    // Compute integrals and return the group
-    return new_group.update(
-        (type < II ? m_thermo.Te() : m_thermo.T()), m_thermo);
+    return new_group;
+}
+
+//==============================================================================
+
+int CollisionDB::tabulate()
+{
+    static const char* const names[] = {
+        "Q11ee", "Q11ei", "Q11ii", "Q11ij", "Q12ei", "Q13ei", "Q14ei", "Q15ei",
+        "Q22ee", "Q22ei", "Q22ii", "Q22ij", "Q23ee", "Q24ee", "Astei", "Astij",
+        "Bstei", "Bstij", "Cstei", "Cstij"
+    };
+    const int n = sizeof(names) / sizeof(names[0]);
+
+    int loaded = 0;
+    for (int i = 0; i < n; ++i) {
+        try {
+            loadGroup(names[i], groupType(names[i]));
+            loaded++;
+        } catch (MissingDataError&) {
+            // Not available for this mixture, fails again if ever requested
+        }
+    }
+
+    return loaded;
 }
 
 //==============================================================================
@@ -275,6 +341,23 @@ const ArrayXd& CollisionDB::Dim(bool include_one_minus_x)
 
 //==============================================================================
 
+const ArrayXd& CollisionDB::nuei()
+{
+    if (m_nuei.size() > 0) {
+        const ArrayXd& Q11 = Q11ei();
+        const double* const X = m_thermo.X();
+        const double fac = 8./3.*m_thermo.numberDensity()*
+            std::sqrt(8.*KB*m_thermo.Te()/(PI*m_mass(0)));
+
+        m_nuei(0) = 0.0;
+        for (int i = 1; i < m_ng; ++i)
+            m_nuei(i) = fac*X[i]*Q11(i);
+    }
+    return m_nuei;
+}
+
+//==============================================================================
+
 const ArrayXd& CollisionDB::L01ei()
 {
     if (m_L01ei.size() > 0) {
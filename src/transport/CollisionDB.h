@@ -91,6 +91,15 @@ public:
      */
     const CollisionGroup& group(const std::string& name);
 
+    /**
+     * Eagerly loads every collision group for which the database provides
+     * data, building the tables of tabulated integrals (or reloading them from
+     * the table cache) up front rather than on first use.  Returns the number
+     * of groups which are loaded.  This is done on construction when the
+     * tabulate option of the database has prebuild="true".
+     */
+    int tabulate();
+
     /// Provides Q11 collision integral for the electron-electron interaction.
     double Q11ee() { return group("Q11ee")[0]; }
 
@@ -169,6 +178,15 @@ public:
      */
     const Eigen::ArrayXd& Dim(bool include_one_minus_x = true);
 
+    /**
+     * Returns the electron-heavy momentum transfer collision frequencies
+     * \f[ \nu_{ei} = \frac{8}{3}\bar{v}_e n_i \bar{Q}^{(1,1)}_{ei}, \quad
+     *     \bar{v}_e = \sqrt{\frac{8k_BT_e}{\pi m_e}}, \f]
+     * with the electron entry set to zero.  The array is empty if there are no
+     * electrons in the mixture.
+     */
+    const Eigen::ArrayXd& nuei();
+
     /// Returns the \f$\Lambda^{01}_{ei}\f$ array.
     const Eigen::ArrayXd& L01ei();
 
@@ -300,6 +318,12 @@ private:
     /// Determines the type of group from the group name.
     GroupType groupType(const std::string& name);
 
+    /**
+     * Returns the collision group corresponding to name, loading it from the
+     * database if necessary, without updating it to the current state.
+     */
+    CollisionGroup& loadGroup(const std::string& name, GroupType type);
+
 private:
 
     Mutation::Utilities::IO::XmlDocument m_database;
@@ -315,6 +339,9 @@ private:
     double m_table_max;
     double m_table_del;
 
+    // Base of the keys of cached tables (empty if not caching)
+    std::string m_table_key;
+
     // List of collision pairs
     std::vector<CollisionPair> m_pairs;
 
@@ -330,6 +357,7 @@ private:
     Eigen::ArrayXd m_nDij;
     Eigen::ArrayXd m_Dijfac;
     Eigen::ArrayXd m_Dim;
+    Eigen::ArrayXd m_nuei;
     Eigen::ArrayXd m_L01ei;
     Eigen::ArrayXd m_L02ei;
 };
@@ -28,6 +28,8 @@
  */
 
 #include "CollisionGroup.h"
+#include "TableCache.h"
+#include "Thermodynamics.h"
 
 #include <iostream>
 using namespace std;
@@ -90,13 +92,44 @@ void CollisionGroup::manage(
         return;
 
     // Generate the table
-    m_table.resize(next, int((m_table_max-m_table_min)/m_table_delta)+1);
+    m_table_rows = next;
+    m_table_cols = int((m_table_max-m_table_min)/m_table_delta)+1;
+
+    // Attach to the table published by another process on this node, or else
+    // reserve it so that the other processes wait for this one to compute it
+    Utilities::SharedTable* p_shared = NULL;
+    if (!m_table_key.empty())
+        p_shared = Utilities::SharedTable::open("collisions", m_table_key,
+            sizeof(double)*m_table_rows*m_table_cols);
+    if (p_shared != NULL) {
+        m_shared_table = SharedPtr<Utilities::SharedTable>(p_shared);
+        if (p_shared->published())
+            return;
+    }
+
+    m_table.resize(m_table_rows, m_table_cols);
+
+    if (m_table_key.empty() || !Utilities::TableCache::load(
+            "collisions", m_table_key, m_table.data(), m_table.size())) {
+        // Tabulatable integrals only depend on T, so columns are independent
+#ifdef _OPENMP
+        #pragma omp parallel for schedule(static)
+#endif
+        for (int j = 0; j < m_table_cols; ++j) {
+            const double T = m_table_min + j*m_table_delta;
+            for (int i = 0; i < m_table_rows; ++i)
+                m_table(i,j) = m_integrals[i]->compute(T);
+        }
+
+        if (!m_table_key.empty())
+            Utilities::TableCache::save(
+                "collisions", m_table_key, m_table.data(), m_table.size());
+    }
 
-    double T = m_table_min;
-    for (int j = 0; j < m_table.cols(); ++j) {
-        for (int i = 0; i < m_table.rows(); ++i)
-            m_table(i,j) = m_integrals[i]->compute(T);
-        T += m_table_delta;
+    // Replace the private table with the shared copy
+    if (p_shared != NULL) {
+        p_shared->publish(m_table.data());
+        m_table.resize(0,0);
     }
 }
 
@@ -105,23 +138,39 @@ void CollisionGroup::manage(
 CollisionGroup& CollisionGroup::update(
     double T, const Thermodynamics::Thermodynamics& thermo)
 {
+    // Nothing to do if the state affecting the integrals has not changed
+    const double Te = thermo.Te();
+    const double ne =
+        (thermo.hasElectrons() ? thermo.numberDensity()*thermo.X()[0] : 0.0);
+    if (T == m_last_T && Te == m_last_Te && ne == m_last_ne)
+        return *this;
+
+    m_last_T  = T;
+    m_last_Te = Te;
+    m_last_ne = ne;
+
     // Compute tabulated data
-    if (m_table.rows() > 0) {
+    if (m_table_rows > 0) {
+        const Eigen::Map<const Eigen::ArrayXXd> table(m_table.size() > 0 ?
+            m_table.data() :
+            static_cast<const double*>(m_shared_table->data()),
+            m_table_rows, m_table_cols);
+
         // Clip the temperature to the table bounds
         double Tc = std::max(std::min(T, m_table_max), m_table_min);
 
         // Compute index of temperature >= to T
         int i = std::min(
-            (int)((Tc-m_table_min)/m_table_delta)+1, (int)m_table.cols()-1);
+            (int)((Tc-m_table_min)/m_table_delta)+1, m_table_cols-1);
         double ratio = (Tc - m_table_min - i*m_table_delta)/m_table_delta;
 
         // Linearly interpolate the table
-        m_unique_vals.head(m_table.rows()) =
-            ratio*(m_table.col(i) - m_table.col(i-1)) + m_table.col(i);
+        m_unique_vals.head(m_table_rows) =
+            ratio*(table.col(i) - table.col(i-1)) + table.col(i);
     }
 
     // Compute non tabulated data
-    for (int i = m_table.rows(); i < m_integrals.size(); ++i) {
+    for (int i = m_table_rows; i < m_integrals.size(); ++i) {
         m_integrals[i]->getOtherParams(thermo);
         m_unique_vals[i] = m_integrals[i]->compute(T);
     }
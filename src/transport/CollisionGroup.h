@@ -32,9 +32,11 @@
 
 #include "CollisionIntegral.h"
 #include "SharedPtr.h"
+#include "SharedTable.h"
 
 #include <eigen3/Eigen/Dense>
 
+#include <string>
 #include <vector>
 
 namespace Mutation { namespace Thermodynamics { class Thermodynamics; }}
@@ -56,13 +58,20 @@ public:
      * @param min      - minimum temperature for tabulation
      * @param max      - maximum temperature for tabulation
      * @param delta    - temperature spacing in the table
+     * @param key      - key identifying the table in the on-disk table cache
+     *                   and between processes sharing it (an empty key
+     *                   disables caching and sharing)
      */
     CollisionGroup(
         bool tabulate = true,
-        double min = 300.0, double max = 20000.0, double delta = 100.0) :
+        double min = 300.0, double max = 20000.0, double delta = 100.0,
+        const std::string& key = "") :
         m_tabulate(tabulate),
         m_size(0),
-        m_table_min(min), m_table_max(max), m_table_delta(delta)
+        m_last_T(-1.0), m_last_Te(-1.0), m_last_ne(-1.0),
+        m_table_min(min), m_table_max(max), m_table_delta(delta),
+        m_table_rows(0), m_table_cols(0),
+        m_table_key(key)
     { }
 
     /**
@@ -81,13 +90,19 @@ public:
     }
 
     /**
-     * Sets the collision integrals that are managed by this group.
+     * Sets the collision integrals that are managed by this group.  When
+     * tabulating, the table of the tabulatable integrals is loaded from the
+     * table cache if possible; otherwise it is generated (in parallel when
+     * built with OpenMP) and stored in the cache.
      */
     void manage(const std::vector< SharedPtr<CollisionIntegral> >& integrals);
 
     /**
      * Updates the collision integral values for this collision group using the
-     * given temperature.  Returns a reference to itself.
+     * given temperature.  Returns a reference to itself.  The values are only
+     * recomputed when the temperature, electron temperature, or electron
+     * number density (which sets the Debye length of the Coulomb integrals)
+     * have changed since the last update.
      */
     CollisionGroup& update(
         double T, const Thermodynamics::Thermodynamics& thermo);
@@ -123,6 +138,11 @@ private:
     /// vector of non-tabulated integrals
     std::vector< SharedPtr<CollisionIntegral> > m_integrals;
 
+    /// State at which the values were last computed
+    double m_last_T;
+    double m_last_Te;
+    double m_last_ne;
+
     /// Internal vector of computed collision integral values
     Eigen::ArrayXd   m_values;
     Eigen::ArrayXd   m_unique_vals;
@@ -132,7 +152,13 @@ private:
     double m_table_min;
     double m_table_max;
     double m_table_delta;
+    int m_table_rows;
+    int m_table_cols;
     Eigen::ArrayXXd m_table;
+    std::string m_table_key;
+
+    /// Copy of the table shared with other processes (replaces m_table)
+    SharedPtr<Utilities::SharedTable> m_shared_table;
 };
 
 	} // namespace Transport
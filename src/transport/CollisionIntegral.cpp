@@ -197,7 +197,7 @@ public:
 
 private:
 
-    double compute_(double T) { return m_value; }
+    double compute_(double T) const { return m_value; }
 
     /**
      * Returns true if the constant value is the same.
@@ -233,7 +233,7 @@ public:
 
 private:
 
-	double compute_(double T) { return m_value; }
+	double compute_(double T) const { return m_value; }
 
 	/**
      * Returns true if the constant value is the same.
@@ -279,7 +279,7 @@ public:
 
 private:
 
-    double compute_(double T) {
+    double compute_(double T) const {
         double lnT = std::log(T);
         double val = m_params[0];
         for (int i = 1; i < m_params.size(); ++i)
@@ -363,7 +363,7 @@ private:
     };
 
     // Evaluate the A* expression
-    double compute_(double T) {
+    double compute_(double T) const {
         switch(m_type) {
         case AST: return // Q22/Q11
             (m_ci2->compute(T)/m_ci1->compute(T));
@@ -465,7 +465,7 @@ private:
     };
 
     // Evaluate the B* expression
-    double compute_(double T) {
+    double compute_(double T) const {
         switch(m_type) {
         case BST: return // (5Q12 - 4Q13)/Q11
             (5.*m_ci2->compute(T)-4.*m_ci3->compute(T))/m_ci1->compute(T);
@@ -558,7 +558,7 @@ private:
     };
 
     // Evaluate the A* expression
-    double compute_(double T) {
+    double compute_(double T) const {
         switch(m_type) {
         case CST: return // Q12/Q11
             (m_ci2->compute(T)/m_ci1->compute(T));
@@ -621,7 +621,7 @@ public:
 
 private:
 
-    double compute_(double T) { return m_ratio * m_integral->compute(T); }
+    double compute_(double T) const { return m_ratio * m_integral->compute(T); }
 
     /**
      * Returns true if the ratio and integral are the same.
@@ -682,7 +682,7 @@ public:
 
 private:
 
-    double compute_(double T)
+    double compute_(double T) const
     {
         double Q1 = m_Q1->compute(T);
         double Q2 = m_Q2->compute(T);
@@ -773,7 +773,7 @@ public:
 private:
 
 	// Interpolate from a table
-	double compute_(double T)
+	double compute_(double T) const
 	{
 		// Clip the temperature if requested
 	    if (m_clip) {
@@ -100,7 +100,7 @@ public:
 	/**
 	 * Returns the value of this integral at the given temperature in m^2.
 	 */
-	double compute(double T) {
+	double compute(double T) const {
 		return m_fac*m_units.convertToBase(compute_(T));
 	}
 
@@ -134,7 +134,7 @@ public:
 
 protected:
 
-	virtual double compute_(double T) = 0;
+	virtual double compute_(double T) const = 0;
 
 	/**
 	 * Ensures that collision integral types can be compared.
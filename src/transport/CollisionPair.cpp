@@ -48,6 +48,9 @@ CollisionPair::CollisionPair(
 {
     // First initialize species info
     initSpeciesData(s1, s2);
+
+    // Every integral of the pair is looked up in the same element
+    m_xml_pair = findPair();
 }
 
 //==============================================================================
@@ -144,7 +147,7 @@ CollisionPair::findXmlElementWithIntegralType(
     const string& kind) const
 {
     // First check if this collision pair is explicitly given in the database
-    IO::XmlElement::const_iterator iter = findPair();
+    IO::XmlElement::const_iterator iter = m_xml_pair;
 
     // Found the pair, so check if the integral is explicitly given
     if (iter != mp_xml->end()) {
@@ -117,6 +117,9 @@ private:
     // Reference to xml database
     const Mutation::Utilities::IO::XmlElement* mp_xml;
 
+    /// Element of this pair in the database (or mp_xml->end())
+    Mutation::Utilities::IO::XmlElement::const_iterator m_xml_pair;
+
     /// Group of collision integrals loaded for this pair
     std::map<std::string, SharedPtr<CollisionIntegral> > m_integrals;
 
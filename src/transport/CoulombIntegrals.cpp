@@ -226,7 +226,7 @@ public:
 
 private:
 
-    double compute_(double T) { return sm_evaluator(T, m_type); }
+    double compute_(double T) const { return sm_evaluator(T, m_type); }
 
     /**
      * Returns true if the constant value is the same.
@@ -240,12 +240,12 @@ private:
 private:
 
     CoulombType m_type;
-    static DebyeHuckleEvaluator sm_evaluator;
+    static thread_local DebyeHuckleEvaluator sm_evaluator;
 
 }; // class CoulombColInt
 
 // Initialization of the DebyeHuckleEvaluator
-DebyeHuckleEvaluator DebyeHuckleColInt::sm_evaluator;
+thread_local DebyeHuckleEvaluator DebyeHuckleColInt::sm_evaluator;
 
 // Register the "Debye-Huckle" CollisionIntegral
 ObjectProvider<DebyeHuckleColInt, CollisionIntegral> DebyeHuckle_ci("Debye-Huckel");
@@ -65,8 +65,9 @@ double ElectronSubSystem::electronDiffusionCoefficient(int order)
     case 2: return electronDiffusionCoefficient<2>();
     case 3: return electronDiffusionCoefficient<3>();
     default:
-        std::cout << "Warning: invalid order for electron diffusion coefficient.  ";
-        std::cout << "Using order 3..." << std::endl;
+        m_thermo.diagnostics().report(Diagnostics::INVALID_ORDER)
+            << "Invalid order for "
+            << "electron diffusion coefficient, using order 3";
         return electronDiffusionCoefficient<3>();
     }
 }
@@ -80,8 +81,9 @@ Eigen::Vector3d ElectronSubSystem::electronDiffusionCoefficientB(int order)
     case 2: return electronDiffusionCoefficientB<2>();
     case 3: return electronDiffusionCoefficientB<3>();
     default:
-        std::cout << "Warning: invalid order for electron diffusion coefficient.  ";
-        std::cout << "Using order 3..." << std::endl;
+        m_thermo.diagnostics().report(Diagnostics::INVALID_ORDER)
+            << "Invalid order for "
+            << "electron diffusion coefficient, using order 3";
         return electronDiffusionCoefficientB<3>();
     }
 }
@@ -124,8 +126,8 @@ Eigen::Vector3d ElectronSubSystem::electronThermalConductivityB(int order)
     case 2: return electronThermalConductivityB<2>();
     case 3: return electronThermalConductivityB<3>();
     default:
-        std::cout << "Warning: invalid order for electron thermal conductivity.  ";
-        std::cout << "Using order 3..." << std::endl;
+        m_thermo.diagnostics().report(Diagnostics::INVALID_ORDER)
+            << "Invalid order for electron thermal conductivity, using order 3";
         return electronThermalConductivityB<3>();
     }
 }
@@ -139,8 +141,8 @@ const Eigen::VectorXd& ElectronSubSystem::alpha(int order)
     case 2: return alpha<2>();
     case 3: return alpha<3>();
     default:
-        std::cout << "Warning: invalid order for alpha coefficients.  ";
-        std::cout << "Using order 3..." << std::endl;
+        m_thermo.diagnostics().report(Diagnostics::INVALID_ORDER)
+            << "Invalid order for alpha coefficients, using order 3";
         return alpha<3>();
     }
 }
@@ -154,8 +156,8 @@ const Eigen::Matrix<double,-1,3>& ElectronSubSystem::alphaB(int order)
     case 2: return alphaB<2>();
     case 3: return alphaB<3>();
     default:
-        std::cout << "Warning: invalid order for alpha coefficients.  ";
-        std::cout << "Using order 3..." << std::endl;
+        m_thermo.diagnostics().report(Diagnostics::INVALID_ORDER)
+            << "Invalid order for alpha coefficients, using order 3";
         return alphaB<3>();
     }
 }
@@ -176,8 +178,9 @@ double ElectronSubSystem::electronThermalDiffusionRatio(int order)
     case 2: return electronThermalDiffusionRatio<2>();
     case 3: return electronThermalDiffusionRatio<3>();
     default:
-        std::cout << "Warning: invalid order for electron thermal diffusion ratio.  ";
-        std::cout << "Using order 3..." << std::endl;
+        m_thermo.diagnostics().report(Diagnostics::INVALID_ORDER)
+            << "Invalid order for "
+            << "electron thermal diffusion ratio, using order 3";
         return electronThermalDiffusionRatio<3>();
     }
 }
@@ -198,8 +201,9 @@ Eigen::Vector3d ElectronSubSystem::electronThermalDiffusionRatioB(int order)
     case 2: return electronThermalDiffusionRatioB<2>();
     case 3: return electronThermalDiffusionRatioB<3>();
     default:
-        std::cout << "Warning: invalid order for electron thermal diffusion ratio.  ";
-        std::cout << "Using order 3..." << std::endl;
+        m_thermo.diagnostics().report(Diagnostics::INVALID_ORDER)
+            << "Invalid order for "
+            << "electron thermal diffusion ratio, using order 3";
         return electronThermalDiffusionRatioB<3>();
     }
 }
@@ -213,8 +217,9 @@ const Eigen::VectorXd& ElectronSubSystem::electronThermalDiffusionRatios2(int or
     case 2: return electronThermalDiffusionRatios2<2>();
     case 3: return electronThermalDiffusionRatios2<3>();
     default:
-        std::cout << "Warning: invalid order for 2nd order electron thermal diffusion ratios.  ";
-        std::cout << "Using order 3..." << std::endl;
+        m_thermo.diagnostics().report(Diagnostics::INVALID_ORDER)
+            << "Invalid order for "
+            << "2nd order electron thermal diffusion ratios, using order 3";
         return electronThermalDiffusionRatios2<3>();
     }
 }
@@ -228,8 +233,9 @@ const Eigen::Matrix<double,-1,3>& ElectronSubSystem::electronThermalDiffusionRat
     case 2: return electronThermalDiffusionRatios2B<2>();
     case 3: return electronThermalDiffusionRatios2B<3>();
     default:
-        std::cout << "Warning: invalid order for 2nd order electron thermal diffusion ratios.  ";
-        std::cout << "Using order 3..." << std::endl;
+        m_thermo.diagnostics().report(Diagnostics::INVALID_ORDER)
+            << "Invalid order for "
+            << "2nd order electron thermal diffusion ratios, using order 3";
         return electronThermalDiffusionRatios2B<3>();
     }
 }
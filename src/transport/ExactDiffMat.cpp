@@ -57,8 +57,8 @@ public:
         //Eigen::Map<const Eigen::ArrayXd> X = m_collisions.X();
         //Eigen::Map<const Eigen::ArrayXd> Y = m_collisions.Y();
 
-        static Eigen::ArrayXd X; X = m_collisions.X()+1.0e-16; X /= X.sum();
-        static Eigen::ArrayXd Y; Y.resize(ns);
+        thread_local Eigen::ArrayXd X; X = m_collisions.X()+1.0e-16; X /= X.sum();
+        thread_local Eigen::ArrayXd Y; Y.resize(ns);
         m_collisions.thermo().convert<Thermodynamics::X_TO_Y>(X.data(), Y.data());
 
 
@@ -93,11 +93,11 @@ public:
         m_Dij.selfadjointView<Eigen::Lower>().rankUpdate(
             Y.matrix(), nd/nDij.diagonal().mean());
 
-        static Eigen::LDLT<Eigen::MatrixXd, Eigen::Lower> ldlt;
+        thread_local Eigen::LDLT<Eigen::MatrixXd, Eigen::Lower> ldlt;
         ldlt.compute(m_Dij.bottomRightCorner(ns-k,ns-k));
 
-        static Eigen::VectorXd alpha; alpha.resize(ns-k);
-        static Eigen::VectorXd b; b.resize(ns-k);
+        thread_local Eigen::VectorXd alpha; alpha.resize(ns-k);
+        thread_local Eigen::VectorXd b; b.resize(ns-k);
         b.array() = Y.tail(ns-k);
 
         for (int i = k; i < ns ; ++i ){
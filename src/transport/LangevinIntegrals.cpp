@@ -99,7 +99,7 @@ public:
 
 private:
 
-    double compute_(double T) { return m_fac * std::sqrt(m_alpha / T); }
+    double compute_(double T) const { return m_fac * std::sqrt(m_alpha / T); }
 
     /**
      * Returns true if the constant value is the same.
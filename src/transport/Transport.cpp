@@ -48,9 +48,11 @@ using Mutation::Thermodynamics::Thermodynamics;
 //==============================================================================
 
 Transport::Transport(
-    Thermodynamics& thermo, const std::string& viscosity, const std::string& lambda)
+    Thermodynamics& thermo, const std::string& viscosity,
+    const std::string& lambda, bool enabled)
     : m_thermo(thermo),
-      m_collisions("collisions.xml", thermo),
+      m_enabled(enabled),
+      mp_collisions(NULL),
       mp_esubsyst(NULL),
       mp_viscosity(NULL),
       mp_thermal_conductivity(NULL),
@@ -58,17 +60,13 @@ Transport::Transport(
       mp_wrk1(NULL),
       mp_tag(NULL)
 {
-    // Setup the electron subsystem object
-    mp_esubsyst = new ElectronSubSystem(m_thermo, m_collisions);
-
-    // Load the viscosity calculator
-    setViscosityAlgo(viscosity);
-
-    // Load the thermal conductivity calculator
-    setThermalConductivityAlgo(lambda);
-
-    // Load the diffusion matrix calculator
-    setDiffusionMatrixAlgo("Ramshaw");
+    // Check the algorithms, which are only created with the collision
+    // integral database on first use
+    if (m_enabled) {
+        setViscosityAlgo(viscosity);
+        setThermalConductivityAlgo(lambda);
+        setDiffusionMatrixAlgo("Ramshaw");
+    }
 
     // Allocate work array storage
     mp_wrk1 = new double [m_thermo.nGas()*3];
@@ -90,6 +88,7 @@ Transport::~Transport()
     delete mp_viscosity;
     delete mp_thermal_conductivity;
     delete mp_diffusion_matrix;
+    delete mp_collisions;
 
     delete [] mp_wrk1;
     delete [] mp_tag;
@@ -97,43 +96,105 @@ Transport::~Transport()
 
 //==============================================================================
 
-void Transport::setViscosityAlgo(const std::string& algo)
+void Transport::initialize()
 {
-    if (mp_viscosity != NULL)
+    try {
+        loadCollisionDB();
+    } catch (...) {
+        // Release whatever was created, as the database is never loaded again
         delete mp_viscosity;
+        delete mp_thermal_conductivity;
+        delete mp_diffusion_matrix;
+        delete mp_esubsyst;
+        delete mp_collisions;
+        mp_viscosity = NULL;
+        mp_thermal_conductivity = NULL;
+        mp_diffusion_matrix = NULL;
+        mp_esubsyst = NULL;
+        mp_collisions = NULL;
+
+        m_load_error = std::current_exception();
+    }
+}
+
+//==============================================================================
+
+void Transport::loadCollisionDB()
+{
+    if (!m_enabled) {
+        throw LogicError()
+            << "Transport properties are disabled in the mixture options.";
+    }
+
+    // Load the collision integral database
+    mp_collisions = new CollisionDB("collisions.xml", m_thermo);
+
+    // Setup the electron subsystem object
+    mp_esubsyst = new ElectronSubSystem(m_thermo, *mp_collisions);
 
+    // Create the algorithms which were set so far
+    setViscosityAlgo(m_viscosity_algo);
+    setThermalConductivityAlgo(m_lambda_algo);
+    setDiffusionMatrixAlgo(m_diffusion_algo);
+}
+
+//==============================================================================
+
+void Transport::setViscosityAlgo(const std::string& algo)
+{
     try {
-        mp_viscosity = Factory<ViscosityAlgorithm>::create(algo, m_collisions);
+        if (mp_collisions == NULL)
+            Factory<ViscosityAlgorithm>::getInstance().getProvider(algo);
+        else {
+            ViscosityAlgorithm* p_viscosity =
+                Factory<ViscosityAlgorithm>::create(algo, *mp_collisions);
+            delete mp_viscosity;
+            mp_viscosity = p_viscosity;
+        }
     } catch (Error& e) {
         e << "\nWas trying to set the viscosity algorithm.";
         throw;
     }
+
+    m_viscosity_algo = algo;
 }
 
 //==============================================================================
 
-double Transport::viscosity() { return mp_viscosity->viscosity(); }
+double Transport::viscosity()
+{
+    load();
+    return mp_viscosity->viscosity();
+}
 
 //==============================================================================
 
 void Transport::setThermalConductivityAlgo(const std::string& algo)
 {
-    if (mp_thermal_conductivity != NULL)
-        delete mp_thermal_conductivity;
-
     try {
-        mp_thermal_conductivity =
-            Factory<ThermalConductivityAlgorithm>::create(algo, m_collisions);
+        if (mp_collisions == NULL)
+            Factory<ThermalConductivityAlgorithm>::getInstance().getProvider(
+                algo);
+        else {
+            ThermalConductivityAlgorithm* p_lambda =
+                Factory<ThermalConductivityAlgorithm>::create(
+                    algo, *mp_collisions);
+            delete mp_thermal_conductivity;
+            mp_thermal_conductivity = p_lambda;
+        }
     } catch (Error& e) {
         e << "\nWas trying to set the thermal conductivity algorithm.";
         throw;
     }
+
+    m_lambda_algo = algo;
 }
 
 //==============================================================================
 
 double Transport::heavyThermalConductivity()
 {
+    load();
     return mp_thermal_conductivity->thermalConductivity();
 }
 
@@ -141,22 +202,28 @@ double Transport::heavyThermalConductivity()
 
 void Transport::setDiffusionMatrixAlgo(const std::string& algo)
 {
-    if (mp_diffusion_matrix != NULL)
-        delete mp_diffusion_matrix;
-
     try {
-        mp_diffusion_matrix =
-            Factory<DiffusionMatrix>::create(algo, m_collisions);
+        if (mp_collisions == NULL)
+            Factory<DiffusionMatrix>::getInstance().getProvider(algo);
+        else {
+            DiffusionMatrix* p_diffusion_matrix =
+                Factory<DiffusionMatrix>::create(algo, *mp_collisions);
+            delete mp_diffusion_matrix;
+            mp_diffusion_matrix = p_diffusion_matrix;
+        }
     } catch (Error& e) {
         e << "\nWas trying to set the diffusion matrix algorithm.";
         throw;
     }
+
+    m_diffusion_algo = algo;
 }
 
 //==============================================================================
 
 const Eigen::MatrixXd& Transport::diffusionMatrix()
 {
+    load();
     return mp_diffusion_matrix->diffusionMatrix();
 }
 
@@ -164,6 +231,7 @@ const Eigen::MatrixXd& Transport::diffusionMatrix()
 
 void Transport::heavyThermalDiffusionRatios(double* const p_k)
 {
+    load();
     mp_thermal_conductivity->thermalDiffusionRatios(p_k);
 }
 
@@ -310,17 +378,17 @@ double Transport::butlerBrokawThermalConductivity()
     Eigen::MatrixXd nDij(ns,ns);
     if (m_thermo.hasElectrons()) {
         for (int i = 0; i < ns; ++i) {
-            nDij(i,0) = m_collisions.nDei()(i);
-            nDij(0,i) = m_collisions.nDei()(i);
+            nDij(i,0) = collisionDB().nDei()(i);
+            nDij(0,i) = collisionDB().nDei()(i);
         }
     }
     for (int i = a, s = 0; i < ns; ++i) {
         for (int j = i; j < ns; ++j, s++) {
-            nDij(i,j) = m_collisions.nDij()(s);
-            nDij(j,i) = m_collisions.nDij()(s);
+            nDij(i,j) = collisionDB().nDij()(s);
+            nDij(j,i) = collisionDB().nDij()(s);
         }
     }
-    const Eigen::ArrayXd X = m_collisions.X().max(1.0e-16);
+    const Eigen::ArrayXd X = collisionDB().X().max(1.0e-16);
 
     // Heavy species
     for (int i = 0; i < nr; ++i) {
@@ -498,7 +566,7 @@ void Transport::stefanMaxwell(double Th, double Te,
     const int k  = ns - m_thermo.nHeavy();
     const double nd = m_thermo.numberDensity();
 
-    static ArrayXd X;
+    thread_local ArrayXd X;
     X = Map<const ArrayXd>(m_thermo.X(), ns) + 1.0e-16;
     X /= X.sum();
 
@@ -515,7 +583,7 @@ void Transport::stefanMaxwell(double Th, double Te,
     double s = 0.0;
     double a = 0.0;
     if (k == 1) {
-        const ArrayXd& nDei = m_collisions.nDei();
+        const ArrayXd& nDei = collisionDB().nDei();
         ArrayXd phi; smCorrectionsElectron(order, phi);
         for (int i = 1; i < ns; ++i) {
             const double fac = Te/Th*X(0)*X(i)/nDei(i)*nd*(1.0+phi(i));
@@ -537,7 +605,7 @@ void Transport::stefanMaxwell(double Th, double Te,
     }
 
     // heavy subsystem
-    const ArrayXd& nDij = m_collisions.nDij();
+    const ArrayXd& nDij = collisionDB().nDij();
     ArrayXd phi; smCorrectionsHeavy(order, phi);
     for (int i = k, is = 1; i < ns; ++i, ++is) {
         for (int j = i+1; j < ns; ++j, ++is) {
@@ -582,12 +650,11 @@ void Transport::smCorrectionsElectron(int order, Eigen::ArrayXd& phi)
         return;
 
     const ArrayXd X = Map<const ArrayXd>(m_thermo.X(), ns).max(1.0e-16);
-    const ArrayXd& nDei = m_collisions.nDei();
-    const Matrix2d Lee = mp_esubsyst->Lee<2>();
-    const ArrayXd& L01 = m_collisions.L01ei();
+    const ArrayXd& nDei = collisionDB().nDei();
+    const Matrix2d Lee = esubsyst().Lee<2>();
+    const ArrayXd& L01 = collisionDB().L01ei();
 
     phi = 25./4.*KB*nDei/(X*X(0))*Lee(0,1)/Lee(1,1)*L01;
-    std::cout << phi << "\n" << std::endl;
 }
 
 void Transport::smCorrectionsHeavy(int order, Eigen::ArrayXd& phi)
@@ -607,12 +674,12 @@ void Transport::smCorrectionsHeavy(int order, Eigen::ArrayXd& phi)
     ArrayXd X = Map<const ArrayXd>(m_thermo.X(), ns) + 1.0e-16;
     X /= X.sum();
 
-    const ArrayXd& mi = m_collisions.mass();
-    const ArrayXd& Ast = m_collisions.Astij();
-    const ArrayXd& Bst = m_collisions.Bstij();
-    const ArrayXd& Cst = m_collisions.Cstij();
-    const ArrayXd& nDij = m_collisions.nDij();
-    const ArrayXd& etai = m_collisions.etai();
+    const ArrayXd& mi = collisionDB().mass();
+    const ArrayXd& Ast = collisionDB().Astij();
+    const ArrayXd& Bst = collisionDB().Bstij();
+    const ArrayXd& Cst = collisionDB().Cstij();
+    const ArrayXd& nDij = collisionDB().nDij();
+    const ArrayXd& etai = collisionDB().etai();
 
     // Compute the Lam01 matrix
     MatrixXd Lam01(nh,nh);
@@ -756,9 +823,9 @@ double Transport::meanFreePath()
                  const double nd = m_thermo.numberDensity();
                     const double* const X = m_thermo.X();
                     const double me = m_thermo.speciesMw(0)/NA;
-                   const Eigen::ArrayXd& Q11 = m_collisions.Q11ij();
-        const double Q11ee = m_collisions.Q11ee();
-        const Eigen::ArrayXd& Q11ei = m_collisions.Q11ei();
+                   const Eigen::ArrayXd& Q11 = collisionDB().Q11ij();
+        const double Q11ee = collisionDB().Q11ee();
+        const Eigen::ArrayXd& Q11ei = collisionDB().Q11ei();
 
 
                                          double sum = 0.0;
@@ -788,8 +855,8 @@ double Transport::electronMeanFreePath()
     const double nd = m_thermo.numberDensity();
     const double* const X = m_thermo.X();
 
-    const double Q11ee = m_collisions.Q11ee();
-    const Eigen::ArrayXd& Q11ei = m_collisions.Q11ei();
+    const double Q11ee = collisionDB().Q11ee();
+    const Eigen::ArrayXd& Q11ei = collisionDB().Q11ei();
     double sum = 0.0;
             sum +=X[0]*X[0]*Q11ee;
                         for (int i = 1; i < ns; ++i)
@@ -847,7 +914,13 @@ double Transport::electronHeavyCollisionFreq()
 {
     if (!m_thermo.hasElectrons())
         return 0.0;
-    return electronThermalSpeed()/electronMeanFreePath();
+
+    // Equivalent to electronThermalSpeed()/electronMeanFreePath() but reuses
+    // the electron-heavy collision frequencies cached in the collision database
+    const double xe = m_thermo.X()[0];
+    const double nu_ee = electronThermalSpeed()*m_thermo.numberDensity()*
+        xe*collisionDB().Q11ee();
+    return xe*(nu_ee + 3./8.*collisionDB().nuei().sum());
 }
 //==============================================================================
 double Transport::coulombMeanCollisionTime()
@@ -861,9 +934,9 @@ double Transport::coulombMeanCollisionTime()
     const double nd = m_thermo.numberDensity();
     const double* const X = m_thermo.X();
     double sum = 0.0;
-    const Eigen::ArrayXd& Q11 = m_collisions.Q11ij();
-    const double Q11ee = m_collisions.Q11ee();
-    const Eigen::ArrayXd& Q11ei = m_collisions.Q11ei();
+    const Eigen::ArrayXd& Q11 = collisionDB().Q11ij();
+    const double Q11ee = collisionDB().Q11ee();
+    const Eigen::ArrayXd& Q11ei = collisionDB().Q11ei();
                         sum +=X[0]*X[0]*Q11ee;
                         for (int i = 1; i < ns; ++i)
                         {
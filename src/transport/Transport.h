@@ -34,6 +34,8 @@
 #include "Utilities.h"
 
 #include <eigen3/Eigen/Dense>
+#include <exception>
+#include <mutex>
 
 namespace Mutation {
     namespace Transport {
@@ -44,17 +46,25 @@ class ViscosityAlgorithm;
 
 /**
  * Manages the computation of transport properties.
+ *
+ * The collision integral database, the electron subsystem and the transport
+ * algorithms are only loaded when a transport property is first needed, so
+ * that mixtures used for thermodynamics alone do not pay for them.  Loading is
+ * done once, even if several threads ask for properties at the same time.
  */
 class Transport
 {
 public:
     
     /**
-     * Constructs a Transport object given a Thermodynamics reference.
+     * Constructs a Transport object given a Thermodynamics reference.  The
+     * algorithm names are checked immediately.  If enabled is false, asking
+     * for any transport property throws a LogicError.
      */
     Transport(
         Mutation::Thermodynamics::Thermodynamics& thermo, 
-        const std::string& viscosity, const std::string& lambda);
+        const std::string& viscosity, const std::string& lambda,
+        bool enabled = true);
     
     /**
      * Destructor.
@@ -62,7 +72,7 @@ public:
     ~Transport();
     
     /// Provides reference to the underlying collision integral database.
-    CollisionDB& collisionDB() { return m_collisions; }
+    CollisionDB& collisionDB() { load(); return *mp_collisions; }
     
     /// Sets the viscosity algorithm.
     void setViscosityAlgo(const std::string& algo);
@@ -74,7 +84,7 @@ public:
     void setDiffusionMatrixAlgo(const std::string& algo);
 
     /// Returns the number of collision pairs accounted for in this mixture.
-    int nCollisionPairs() const { return m_collisions.size(); }
+    int nCollisionPairs() const { load(); return mp_collisions->size(); }
     
     //void omega11ii(double* const p_omega);
     //void omega22ii(double* const p_omega);
@@ -128,8 +138,8 @@ public:
         const int k  = ns-nh;
 
         Eigen::Map<const Eigen::ArrayXd> X(m_thermo.X()+k, nh);
-        static Eigen::ArrayXd avDij; avDij.resize(nh);
-        const Eigen::ArrayXd& nDij = m_collisions.nDij();
+        thread_local Eigen::ArrayXd avDij; avDij.resize(nh);
+        const Eigen::ArrayXd& nDij = collisionDB().nDij();
 
         avDij.setZero();
         for (int i = 0, index = 0; i < nh; ++i) {
@@ -195,7 +205,7 @@ public:
      */
     void averageDiffusionCoeffs(double *const p_Di) {
         Eigen::Map<Eigen::ArrayXd>(p_Di, m_thermo.nGas()) =
-            m_collisions.Dim();
+            collisionDB().Dim();
     }
     
     /**
@@ -385,39 +395,39 @@ public:
 
     /// Isotropic electric conductivity in S/m (no magnetic field).
     double electricConductivity(int order = 3) {
-        return mp_esubsyst->electricConductivity(order);
+        return esubsyst().electricConductivity(order);
     }
 
     /// Anisotropic electric conductivity in S/m (with magnetic field).
     Eigen::Vector3d electricConductivityB(int order = 3) {
-        return mp_esubsyst->electricConductivityB(order);
+        return esubsyst().electricConductivityB(order);
     }
 
     /// Returns the electron thermal conductivity in W/m-K
     double electronThermalConductivity(int order = 3) {
-        return mp_esubsyst->electronThermalConductivity(order);
+        return esubsyst().electronThermalConductivity(order);
     }
 
     /// Anisotropic electron thermal conductivity in W/m-K.
     Eigen::Vector3d electronThermalConductivityB(int order = 3) {
-        return mp_esubsyst->electronThermalConductivityB(order);
+        return esubsyst().electronThermalConductivityB(order);
     }
 
     /// Isotropic electron diffusion coefficient.
     double electronDiffusionCoefficient(int order = 3) {
-        return mp_esubsyst->electronDiffusionCoefficient(order);
+        return esubsyst().electronDiffusionCoefficient(order);
     }
 
     /// Anisotropic electron diffusion coefficient.
     Eigen::Vector3d electronDiffusionCoefficientB(int order = 3) {
-        return mp_esubsyst->electronDiffusionCoefficientB(order);
+        return esubsyst().electronDiffusionCoefficientB(order);
     }
 
     /// Isotropic second-order electron diffusion coefficient.
     double electronDiffusionCoefficient2(int order = 3)
     {
         const int nh = m_thermo.nHeavy();
-        return mp_esubsyst->electronDiffusionCoefficient2(
+        return esubsyst().electronDiffusionCoefficient2(
             diffusionMatrix().bottomRightCorner(nh,nh), order);
     }
 
@@ -425,38 +435,38 @@ public:
     Eigen::Vector3d electronDiffusionCoefficient2B(int order = 3)
     {
         const int nh = m_thermo.nHeavy();
-        return mp_esubsyst->electronDiffusionCoefficient2B(
+        return esubsyst().electronDiffusionCoefficient2B(
             diffusionMatrix().bottomRightCorner(nh,nh), order);
     }
 
     /// Isotropic alpha coefficients.
     const Eigen::VectorXd& alpha(int order = 3) {
-        return mp_esubsyst->alpha(order);
+        return esubsyst().alpha(order);
     }
 
     /// Anisotropic alpha coefficients.
     const Eigen::Matrix<double,-1,3>& alphaB(int order = 3) {
-        return mp_esubsyst->alphaB(order);
+        return esubsyst().alphaB(order);
     }
 
     /// Isotropic electron thermal diffusion ratio.
     double electronThermalDiffusionRatio(int order = 3) {
-        return mp_esubsyst->electronThermalDiffusionRatio(order);
+        return esubsyst().electronThermalDiffusionRatio(order);
     }
 
     /// Anisotropic electron thermal diffusion ratio.
     Eigen::Vector3d electronThermalDiffusionRatioB(int order = 3) {
-        return mp_esubsyst->electronThermalDiffusionRatioB(order);
+        return esubsyst().electronThermalDiffusionRatioB(order);
     }
 
     /// Isotropic second-order electron thermal diffusion ratios.
     const Eigen::VectorXd& electronThermalDiffusionRatios2(int order = 3) {
-        return mp_esubsyst->electronThermalDiffusionRatios2(order);
+        return esubsyst().electronThermalDiffusionRatios2(order);
     }
 
     /// Anisotropic second-order electron thermal diffusion ratios.
     const Eigen::Matrix<double,-1,3>& electronThermalDiffusionRatios2B(int order = 3) {
-        return mp_esubsyst->electronThermalDiffusionRatios2B(order);
+        return esubsyst().electronThermalDiffusionRatios2B(order);
     }
 
 
@@ -546,10 +556,35 @@ private:
 	 */
 	void equilDiffFluxFacs(double* const p_F);
 
+    /// Loads the collision integral database and algorithms on first use.
+    void load() const {
+        std::call_once(
+            m_load_flag, &Transport::initialize, const_cast<Transport*>(this));
+        if (m_load_error)
+            std::rethrow_exception(m_load_error);
+    }
+
+    /// Loads the collision integral database, keeping any error for later uses.
+    void initialize();
+
+    /// Creates the objects which depend on the collision integral database.
+    void loadCollisionDB();
+
+    /// Returns the electron subsystem, loading it if necessary.
+    ElectronSubSystem& esubsyst() { load(); return *mp_esubsyst; }
+
 private:
 
     Mutation::Thermodynamics::Thermodynamics& m_thermo;
-    CollisionDB m_collisions;
+
+    bool m_enabled;
+    mutable std::once_flag m_load_flag;
+    std::exception_ptr m_load_error;
+    std::string m_viscosity_algo;
+    std::string m_lambda_algo;
+    std::string m_diffusion_algo;
+
+    CollisionDB* mp_collisions;
     ElectronSubSystem* mp_esubsyst;
     
     ViscosityAlgorithm* mp_viscosity;
@@ -0,0 +1,167 @@
+/**
+ * @file EmbeddedData.cpp
+ *
+ * @brief Implementation of the access to the data files embedded in the
+ * library.
+ */
+
+/*
+ * Copyright 2018 von Karman Institute for Fluid Dynamics (VKI)
+ *
+ * This file is part of MUlticomponent Thermodynamic And Transport
+ * properties for IONized gases in C++ (Mutation++) software package.
+ *
+ * Mutation++ is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as
+ * published by the Free Software Foundation, either version 3 of the
+ * License, or (at your option) any later version.
+ *
+ * Mutation++ is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with Mutation++.  If not, see
+ * <http://www.gnu.org/licenses/>.
+ */
+
+#include "EmbeddedData.h"
+
+#include <algorithm>
+#include <cstring>
+
+namespace Mutation {
+    namespace Utilities {
+        namespace IO {
+
+/// Prefix of the file names returned by embeddedDataPath().
+static const char EMBEDDED_PREFIX[] = "embedded:";
+static const std::size_t EMBEDDED_PREFIX_LENGTH = sizeof(EMBEDDED_PREFIX) - 1;
+
+//==============================================================================
+
+static bool comparePath(const EmbeddedFile& file, const std::string& path)
+{
+    return path.compare(file.path) > 0;
+}
+
+//==============================================================================
+
+const EmbeddedFile* findEmbeddedFile(const std::string& path)
+{
+    std::size_t n;
+    const EmbeddedFile* const begin = embeddedFiles(n);
+    const EmbeddedFile* const end = begin + n;
+
+    const EmbeddedFile* iter = std::lower_bound(begin, end, path, comparePath);
+    if (iter == end || path != iter->path)
+        return NULL;
+    return iter;
+}
+
+//==============================================================================
+
+std::string embeddedDataPath(const std::string& path)
+{
+    if (findEmbeddedFile(path) == NULL)
+        return "";
+    return EMBEDDED_PREFIX + path;
+}
+
+//==============================================================================
+
+std::string embeddedDatabasePath(
+    const std::string& name, const std::string& dir)
+{
+    std::string path = embeddedDataPath(name);
+    if (path.empty())
+        path = embeddedDataPath(dir + '/' + name);
+    return path;
+}
+
+//==============================================================================
+
+bool isEmbeddedDataPath(const std::string& path)
+{
+    return path.compare(0, EMBEDDED_PREFIX_LENGTH, EMBEDDED_PREFIX) == 0;
+}
+
+//==============================================================================
+
+DataFileStream::DataFileStream(
+    const std::string& path, std::ios::openmode mode)
+    : std::istream(NULL), mp_embedded(NULL)
+{
+    if (isEmbeddedDataPath(path)) {
+        mp_embedded = findEmbeddedFile(path.substr(EMBEDDED_PREFIX_LENGTH));
+        if (mp_embedded != NULL)
+            m_memory.open(*mp_embedded);
+        rdbuf(&m_memory);
+    } else {
+        m_file.open(path.c_str(), mode | std::ios::in);
+        rdbuf(&m_file);
+    }
+
+    if (!is_open())
+        setstate(std::ios::failbit);
+}
+
+//==============================================================================
+
+bool DataFileStream::is_open() const
+{
+    return (mp_embedded != NULL || m_file.is_open());
+}
+
+//==============================================================================
+
+void DataFileStream::close()
+{
+    if (mp_embedded == NULL && m_file.close() == NULL)
+        setstate(std::ios::failbit);
+}
+
+//==============================================================================
+
+void DataFileStream::MemoryBuffer::open(const EmbeddedFile& file)
+{
+    // The buffer is never written to, so the const_cast is safe
+    char* begin = const_cast<char*>(reinterpret_cast<const char*>(file.data));
+    setg(begin, begin, begin + file.size);
+}
+
+//==============================================================================
+
+DataFileStream::MemoryBuffer::pos_type DataFileStream::MemoryBuffer::seekoff(
+    off_type off, std::ios::seekdir dir, std::ios::openmode which)
+{
+    if ((which & std::ios::in) == 0)
+        return pos_type(off_type(-1));
+
+    off_type pos = off;
+    if (dir == std::ios::cur)
+        pos += gptr() - eback();
+    else if (dir == std::ios::end)
+        pos += egptr() - eback();
+
+    if (pos < 0 || pos > egptr() - eback())
+        return pos_type(off_type(-1));
+
+    setg(eback(), eback() + pos, egptr());
+    return pos_type(pos);
+}
+
+//==============================================================================
+
+DataFileStream::MemoryBuffer::pos_type DataFileStream::MemoryBuffer::seekpos(
+    pos_type pos, std::ios::openmode which)
+{
+    return seekoff(off_type(pos), std::ios::beg, which);
+}
+
+//==============================================================================
+
+        } // namespace IO
+    } // namespace Utilities
+} // namespace Mutation
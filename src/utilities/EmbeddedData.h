@@ -0,0 +1,124 @@
+/**
+ * @file EmbeddedData.h
+ *
+ * @brief Access to the data files embedded in the library.
+ */
+
+/*
+ * Copyright 2018 von Karman Institute for Fluid Dynamics (VKI)
+ *
+ * This file is part of MUlticomponent Thermodynamic And Transport
+ * properties for IONized gases in C++ (Mutation++) software package.
+ *
+ * Mutation++ is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as
+ * published by the Free Software Foundation, either version 3 of the
+ * License, or (at your option) any later version.
+ *
+ * Mutation++ is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with Mutation++.  If not, see
+ * <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef UTILITIES_EMBEDDED_DATA_H
+#define UTILITIES_EMBEDDED_DATA_H
+
+#include <cstddef>
+#include <fstream>
+#include <istream>
+#include <string>
+
+namespace Mutation {
+    namespace Utilities {
+        namespace IO {
+
+/**
+ * A file of the data directory compiled into the library.
+ */
+struct EmbeddedFile
+{
+    const char* path;           ///< path relative to the data directory
+    const unsigned char* data;  ///< contents, followed by a null byte
+    std::size_t size;           ///< size of the contents in bytes
+};
+
+/**
+ * Returns the table of files embedded in the library, sorted by path, and
+ * sets n to its size.  The table is generated at configure time, from the
+ * data directory when the library is built with EMBED_DATA_FILES, and is
+ * empty otherwise.
+ */
+const EmbeddedFile* embeddedFiles(std::size_t& n);
+
+/**
+ * Returns the embedded file with the given path, relative to the data
+ * directory and with '/' separators, or NULL if there is no such file.
+ */
+const EmbeddedFile* findEmbeddedFile(const std::string& path);
+
+/**
+ * Returns the name under which the embedded file with the given relative path
+ * can be opened by a DataFileStream, or an empty string if the file is not
+ * embedded.
+ */
+std::string embeddedDataPath(const std::string& path);
+
+/**
+ * Returns the embedded data path of the database file name or else of
+ * dir/name, or an empty string if neither file is embedded in the library.
+ */
+std::string embeddedDatabasePath(
+    const std::string& name, const std::string& dir);
+
+/// Returns true if the file name designates an embedded file.
+bool isEmbeddedDataPath(const std::string& path);
+
+/**
+ * Input stream over a data file, which is read from memory if the file name
+ * was returned by embeddedDataPath() and from disk otherwise.  Embedded files
+ * support seeking just like files on disk.
+ */
+class DataFileStream : public std::istream
+{
+public:
+
+    /// Opens the given file for reading.
+    explicit DataFileStream(
+        const std::string& path, std::ios::openmode mode = std::ios::in);
+
+    /// Returns true if the file could be opened.
+    bool is_open() const;
+
+    /// Closes the file.
+    void close();
+
+private:
+
+    /// Read-only stream buffer over the contents of an embedded file.
+    class MemoryBuffer : public std::streambuf
+    {
+    public:
+        void open(const EmbeddedFile& file);
+
+    protected:
+        pos_type seekoff(
+            off_type off, std::ios::seekdir dir, std::ios::openmode which);
+        pos_type seekpos(pos_type pos, std::ios::openmode which);
+    };
+
+    std::filebuf m_file;
+    MemoryBuffer m_memory;
+    const EmbeddedFile* mp_embedded;
+
+}; // class DataFileStream
+
+        } // namespace IO
+    } // namespace Utilities
+} // namespace Mutation
+
+#endif // UTILITIES_EMBEDDED_DATA_H
@@ -0,0 +1,233 @@
+/**
+ * @file GridTable.cpp
+ *
+ * @brief Implementation of the GridAxis and GridTable classes.
+ */
+
+/*
+ * Copyright 2018 von Karman Institute for Fluid Dynamics (VKI)
+ *
+ * This file is part of MUlticomponent Thermodynamic And Transport
+ * properties for IONized gases in C++ (Mutation++) software package.
+ *
+ * Mutation++ is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as
+ * published by the Free Software Foundation, either version 3 of the
+ * License, or (at your option) any later version.
+ *
+ * Mutation++ is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with Mutation++.  If not, see
+ * <http://www.gnu.org/licenses/>.
+ */
+
+#include "GridTable.h"
+
+#include <cstring>
+#include <fstream>
+
+#ifndef _WIN32
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace Mutation {
+    namespace Utilities {
+
+/// Header at the beginning of a grid table file.
+struct GridTableHeader
+{
+    char magic[8];
+    int version;
+    int naxes;
+    int nf;
+    int reserved;
+    struct {
+        double min;
+        double max;
+        int size;
+        int spacing;
+    } axes[GridTable::MAX_AXES];
+};
+
+// Identifies grid table files
+static const char GRID_MAGIC[8] = {'M','P','P','G','R','I','D','\0'};
+
+// Increment when the layout of the file changes
+static const int GRID_VERSION = 1;
+
+// The data starts after the header, on a cache line boundary
+static const std::size_t GRID_HEADER_BYTES = 128;
+
+//==============================================================================
+
+GridAxis::GridAxis(double min, double max, int n, Spacing spacing) :
+    m_min(min), m_max(max), m_size(n), m_spacing(spacing)
+{
+    if (n < 2)
+        throw InvalidInputError("grid axis size", n)
+            << "A grid axis needs at least 2 nodes.";
+    if (!(max > min))
+        throw InvalidInputError("grid axis range", max)
+            << "The maximum of a grid axis must be larger than its minimum.";
+    if (spacing == LOGARITHMIC && min <= 0.0)
+        throw InvalidInputError("grid axis minimum", min)
+            << "A logarithmic grid axis must be positive.";
+
+    m_v0 = (spacing == LOGARITHMIC ? std::log(min) : min);
+    const double v1 = (spacing == LOGARITHMIC ? std::log(max) : max);
+    m_inv_dv = (n - 1) / (v1 - m_v0);
+}
+
+//==============================================================================
+
+GridTable::GridTable(const std::vector<GridAxis>& axes, int nf) :
+    m_axes(axes), m_nf(nf), mp_data(NULL), mp_map(NULL), m_map_bytes(0)
+{
+    if (m_axes.empty() || m_axes.size() > MAX_AXES)
+        throw InvalidInputError("grid table axes", m_axes.size())
+            << "Grid tables have between 1 and " << MAX_AXES << " axes.";
+    if (nf < 1)
+        throw InvalidInputError("grid table functions", nf)
+            << "Grid tables need at least one function.";
+
+    initialize();
+    m_storage.assign(std::size_t(m_nodes)*m_nf, 0.0);
+    mp_data = &m_storage[0];
+}
+
+//==============================================================================
+
+GridTable::GridTable(const std::string& file_name) :
+    m_nf(0), mp_data(NULL), mp_map(NULL), m_map_bytes(0)
+{
+    std::ifstream file(file_name.c_str(), std::ios::binary);
+    if (!file.is_open())
+        throw FileNotFoundError(file_name);
+
+    GridTableHeader header;
+    file.read(reinterpret_cast<char*>(&header), sizeof(header));
+
+    if (!file || std::memcmp(header.magic, GRID_MAGIC, sizeof(GRID_MAGIC)) != 0)
+        throw FileParseError(file_name, 0) << "Not a grid table file.";
+    if (header.version != GRID_VERSION)
+        throw FileParseError(file_name, 0)
+            << "Unsupported grid table version " << header.version << ".";
+    if (header.naxes < 1 || header.naxes > MAX_AXES || header.nf < 1)
+        throw FileParseError(file_name, 0) << "Bad grid table dimensions.";
+
+    for (int d = 0; d < header.naxes; ++d)
+        m_axes.push_back(GridAxis(
+            header.axes[d].min, header.axes[d].max, header.axes[d].size,
+            GridAxis::Spacing(header.axes[d].spacing)));
+    m_nf = header.nf;
+    initialize();
+
+    const std::size_t data_bytes = std::size_t(m_nodes)*m_nf*sizeof(double);
+    file.seekg(0, std::ios::end);
+    if (std::size_t(file.tellg()) != GRID_HEADER_BYTES + data_bytes)
+        throw FileParseError(file_name, 0)
+            << "Grid table file size does not match its header.";
+
+#ifndef _WIN32
+    // Map the file read-only so that the page cache is shared between
+    // processes
+    const int fd = open(file_name.c_str(), O_RDONLY);
+    if (fd >= 0) {
+        void* p_map = mmap(
+            NULL, GRID_HEADER_BYTES + data_bytes, PROT_READ, MAP_SHARED, fd,
+            0);
+        close(fd);
+        if (p_map != MAP_FAILED) {
+            mp_map = p_map;
+            m_map_bytes = GRID_HEADER_BYTES + data_bytes;
+            mp_data = reinterpret_cast<const double*>(
+                static_cast<char*>(p_map) + GRID_HEADER_BYTES);
+            return;
+        }
+    }
+#endif
+
+    // Otherwise simply read the data
+    m_storage.resize(std::size_t(m_nodes)*m_nf);
+    file.seekg(GRID_HEADER_BYTES);
+    file.read(reinterpret_cast<char*>(&m_storage[0]), data_bytes);
+    if (!file)
+        throw FileParseError(file_name, 0) << "Grid table file is truncated.";
+    mp_data = &m_storage[0];
+}
+
+//==============================================================================
+
+GridTable::~GridTable()
+{
+#ifndef _WIN32
+    if (mp_map != NULL)
+        munmap(mp_map, m_map_bytes);
+#endif
+}
+
+//==============================================================================
+
+void GridTable::initialize()
+{
+    const int na = m_axes.size();
+
+    m_nodes = 1;
+    for (int d = na-1; d >= 0; --d) {
+        m_strides[d] = std::size_t(m_nodes)*m_nf;
+        m_nodes *= m_axes[d].size();
+    }
+}
+
+//==============================================================================
+
+void GridTable::save(const std::string& file_name) const
+{
+    std::ofstream file(file_name.c_str(), std::ios::binary);
+    if (!file.is_open())
+        throw FileNotFoundError(file_name);
+
+    char buffer[GRID_HEADER_BYTES];
+    std::memset(buffer, 0, sizeof(buffer));
+
+    GridTableHeader header;
+    std::memset(&header, 0, sizeof(header));
+    std::memcpy(header.magic, GRID_MAGIC, sizeof(GRID_MAGIC));
+    header.version = GRID_VERSION;
+    header.naxes = m_axes.size();
+    header.nf = m_nf;
+    for (int d = 0; d < m_axes.size(); ++d) {
+        header.axes[d].min = m_axes[d].min();
+        header.axes[d].max = m_axes[d].max();
+        header.axes[d].size = m_axes[d].size();
+        header.axes[d].spacing = m_axes[d].spacing();
+    }
+    std::memcpy(buffer, &header, sizeof(header));
+
+    file.write(buffer, sizeof(buffer));
+    file.write(
+        reinterpret_cast<const char*>(mp_data),
+        std::size_t(m_nodes)*m_nf*sizeof(double));
+}
+
+//==============================================================================
+
+void GridTable::nodeCoordinates(int n, double* const p_x) const
+{
+    for (int d = m_axes.size()-1; d >= 0; --d) {
+        p_x[d] = m_axes[d].node(n % m_axes[d].size());
+        n /= m_axes[d].size();
+    }
+}
+
+//==============================================================================
+
+    } // namespace Utilities
+} // namespace Mutation
@@ -0,0 +1,429 @@
+/**
+ * @file GridTable.h
+ *
+ * @brief Declaration of the GridAxis and GridTable classes and of the
+ * interpolation schemes which can be used with GridTable::lookup().
+ */
+
+/*
+ * Copyright 2018 von Karman Institute for Fluid Dynamics (VKI)
+ *
+ * This file is part of MUlticomponent Thermodynamic And Transport
+ * properties for IONized gases in C++ (Mutation++) software package.
+ *
+ * Mutation++ is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as
+ * published by the Free Software Foundation, either version 3 of the
+ * License, or (at your option) any later version.
+ *
+ * Mutation++ is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with Mutation++.  If not, see
+ * <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef UTILITIES_GRID_TABLE_H
+#define UTILITIES_GRID_TABLE_H
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <string>
+#include <vector>
+
+#include "Errors.h"
+
+namespace Mutation {
+    namespace Utilities {
+
+/**
+ * An axis of a GridTable, made of equally spaced nodes in either the variable
+ * itself or its logarithm.  Because the spacing is constant, the interval
+ * containing a value is found directly, without any search.
+ */
+class GridAxis
+{
+public:
+
+    /// Spacing of the nodes.
+    enum Spacing {
+        UNIFORM,    ///< nodes equally spaced in x
+        LOGARITHMIC ///< nodes equally spaced in ln(x)
+    };
+
+    /**
+     * Creates an axis of n nodes between min and max (included).
+     */
+    GridAxis(double min, double max, int n, Spacing spacing = UNIFORM);
+
+    /// Returns the first node.
+    double min() const { return m_min; }
+
+    /// Returns the last node.
+    double max() const { return m_max; }
+
+    /// Returns the number of nodes.
+    int size() const { return m_size; }
+
+    /// Returns the spacing of the nodes.
+    Spacing spacing() const { return m_spacing; }
+
+    /// Returns the value of node i.
+    double node(int i) const {
+        if (i == 0) return m_min;
+        if (i == m_size - 1) return m_max;
+        const double v = m_v0 + i/m_inv_dv;
+        return (m_spacing == LOGARITHMIC ? std::exp(v) : v);
+    }
+
+    /**
+     * Finds the interval i containing x and the fraction t of the interval at
+     * x.  Values outside of the axis are clamped to its bounds.
+     */
+    void locate(double x, int& i, double& t) const {
+        const double v = (m_spacing == LOGARITHMIC ? std::log(x) : x);
+        const double u = std::min(
+            std::max((v - m_v0)*m_inv_dv, 0.0), double(m_size - 1));
+        i = std::min(int(u), m_size - 2);
+        t = u - i;
+    }
+
+private:
+
+    double m_min;
+    double m_max;
+    int m_size;
+    Spacing m_spacing;
+
+    // Node coordinates are v = v0 + i/inv_dv with v = x or ln(x)
+    double m_v0;
+    double m_inv_dv;
+
+}; // class GridAxis
+
+//==============================================================================
+
+/**
+ * Linear interpolation between the two nodes surrounding a value.
+ *
+ * Interpolation schemes are given to GridTable::lookup() as template
+ * parameters.  Each scheme uses a stencil of width nodes along each axis and
+ * provides a combine() function which interpolates all the functions of the
+ * table at the fraction t of the interval between nodes j and j+1 of the
+ * stencil.
+ */
+struct GridLinear
+{
+    static const int width = 2;
+
+    static void combine(
+        double t, int j, const double* const* p_rows, int nf,
+        double* const p_values)
+    {
+        const double* const y0 = p_rows[0];
+        const double* const y1 = p_rows[1];
+        for (int f = 0; f < nf; ++f)
+            p_values[f] = y0[f] + t*(y1[f] - y0[f]);
+    }
+}; // struct GridLinear
+
+//==============================================================================
+
+/**
+ * Cubic Hermite interpolation with centered difference slopes (Catmull-Rom),
+ * and second order one-sided slopes at the ends of the axes.  Quadratic
+ * functions of the node coordinate are reproduced exactly.
+ */
+struct GridCubic
+{
+    static const int width = 4;
+
+    static void combine(
+        double t, int j, const double* const* p_rows, int nf,
+        double* const p_values)
+    {
+        const double t2  = t*t;
+        const double t3  = t2*t;
+        const double h00 = 2.0*t3 - 3.0*t2 + 1.0;
+        const double h10 = t3 - 2.0*t2 + t;
+        const double h01 = 3.0*t2 - 2.0*t3;
+        const double h11 = t3 - t2;
+
+        // At the ends of the axis, the slope is taken from the two nodes
+        // following the end node
+        const double* const y0 = p_rows[j];
+        const double* const y1 = p_rows[j+1];
+        const double* const ym = p_rows[j > 0 ? j-1 : 2];
+        const double* const yp = p_rows[j < 2 ? j+2 : 1];
+        const double a0 = (j > 0 ?  0.0 : -1.5);
+        const double b0 = (j > 0 ?  0.5 :  2.0);
+        const double a1 = (j < 2 ? -0.5 : -2.0);
+        const double b1 = (j < 2 ?  0.0 :  1.5);
+
+        for (int f = 0; f < nf; ++f) {
+            const double d0 = a0*y0[f] + b0*y1[f] - 0.5*ym[f];
+            const double d1 = a1*y0[f] + b1*y1[f] + 0.5*yp[f];
+            p_values[f] = h00*y0[f] + h10*d0 + h01*y1[f] + h11*d1;
+        }
+    }
+}; // struct GridCubic
+
+//==============================================================================
+
+/**
+ * Monotone cubic Hermite interpolation, with the same slopes as the
+ * Numerics::MCHInterpolator in the node coordinate.  The interpolated values
+ * never overshoot the values of the surrounding nodes.
+ */
+struct GridMonotoneCubic
+{
+    static const int width = 4;
+
+    static void combine(
+        double t, int j, const double* const* p_rows, int nf,
+        double* const p_values)
+    {
+        const double t2  = t*t;
+        const double t3  = t2*t;
+        const double h00 = 2.0*t3 - 3.0*t2 + 1.0;
+        const double h10 = t3 - 2.0*t2 + t;
+        const double h01 = 3.0*t2 - 2.0*t3;
+        const double h11 = t3 - t2;
+
+        const double* const y0 = p_rows[j];
+        const double* const y1 = p_rows[j+1];
+        const double* const ym = p_rows[j > 0 ? j-1 : j];
+        const double* const yp = p_rows[j < 2 ? j+2 : j+1];
+
+        for (int f = 0; f < nf; ++f) {
+            const double m  = y1[f] - y0[f];
+            const double m0 = (j > 0 ? y0[f] - ym[f] : m);
+            const double m1 = (j < 2 ? yp[f] - y1[f] : m);
+            const double d0 = (m0*m > 0.0 ? 2.0*m0*m/(m0 + m) : 0.0);
+            const double d1 = (m*m1 > 0.0 ? 2.0*m*m1/(m + m1) : 0.0);
+            p_values[f] = h00*y0[f] + h10*d0 + h01*y1[f] + h11*d1;
+        }
+    }
+}; // struct GridMonotoneCubic
+
+//==============================================================================
+
+/**
+ * A table of one or more functions tabulated on the nodes of a 1-D to 3-D
+ * grid of GridAxis.
+ *
+ * The values of all the functions at a node are stored contiguously, with the
+ * last axis varying fastest, so that interpolation loops run over contiguous
+ * memory and can be vectorized by the compiler.  The interpolation scheme is
+ * a template parameter of lookup(), which lets the compiler inline it.
+ *
+ * Tables are filled by the caller, node after node, and can be saved to a
+ * binary file.  Loading a file maps it in memory read-only, so that the page
+ * cache shares one copy of the table between all the processes which use it.
+ *
+ * <b>Example usage:</b>
+ * @code
+ * std::vector<GridAxis> axes;
+ * axes.push_back(GridAxis(200.0, 20000.0, 500, GridAxis::LOGARITHMIC));
+ * GridTable table(axes, nf);
+ * for (int n = 0; n < table.nNodes(); ++n) {
+ *     table.nodeCoordinates(n, &T);
+ *     computeFunctions(T, table.values(n));
+ * }
+ * table.lookup<GridMonotoneCubic>(&T, p_values);
+ * @endcode
+ */
+class GridTable
+{
+public:
+
+    /// Maximum number of axes of a table.
+    static const int MAX_AXES = 3;
+
+    /**
+     * Creates a table of nf functions on the grid given by the axes, with all
+     * values set to zero.
+     */
+    GridTable(const std::vector<GridAxis>& axes, int nf);
+
+    /**
+     * Loads a table from a file written by save().
+     */
+    explicit GridTable(const std::string& file_name);
+
+    /// Releases the table memory.
+    ~GridTable();
+
+    /// Writes the table to a binary file in the native byte order.
+    void save(const std::string& file_name) const;
+
+    /// Returns the number of axes.
+    int nAxes() const { return m_axes.size(); }
+
+    /// Returns axis d.
+    const GridAxis& axis(int d) const { return m_axes[d]; }
+
+    /// Returns the number of functions tabulated at each node.
+    int nFunctions() const { return m_nf; }
+
+    /// Returns the total number of nodes.
+    int nNodes() const { return m_nodes; }
+
+    /// Returns true if the table is mapped read-only from a file.
+    bool isMapped() const { return mp_map != NULL; }
+
+    /// Gets the coordinates of node n (one per axis).
+    void nodeCoordinates(int n, double* const p_x) const;
+
+    /// Returns the values of the functions at node n, to be filled.
+    double* values(int n) {
+        if (isMapped()) throw LogicError()
+            << "Cannot modify a GridTable mapped from a file.";
+        return &m_storage[std::size_t(n)*m_nf];
+    }
+
+    /// Returns the values of the functions at node n.
+    const double* values(int n) const {
+        return mp_data + std::size_t(n)*m_nf;
+    }
+
+    /**
+     * Interpolates all the functions at the point p_x (one coordinate per
+     * axis) with the given scheme.  Points outside of the grid are clamped to
+     * its bounds.
+     */
+    template <typename Scheme>
+    void lookup(const double* const p_x, double* const p_values) const {
+        lookup<Scheme>(p_x, 1, p_values);
+    }
+
+    /**
+     * Interpolates all the functions at n points.  The coordinates of point i
+     * are p_x[i*nAxes()+d] and its values are stored in p_values[i*nf+f].
+     */
+    template <typename Scheme>
+    void lookup(
+        const double* const p_x, int n, double* const p_values) const;
+
+private:
+
+    /// Sets up the strides and the storage.
+    void initialize();
+
+    /**
+     * Recursively interpolates along axes d and higher, over the stencil
+     * starting at the given offset.
+     */
+    template <typename Scheme>
+    void interpolate(
+        int d, std::size_t offset, const int* const p_start,
+        const int* const p_j, const double* const p_t, double* const p_work,
+        double* const p_values) const;
+
+    // Not copyable
+    GridTable(const GridTable&);
+    GridTable& operator=(const GridTable&);
+
+private:
+
+    std::vector<GridAxis> m_axes;
+    int m_nf;
+    int m_nodes;
+    std::size_t m_strides[MAX_AXES];
+
+    std::vector<double> m_storage;
+    const double* mp_data;
+
+    void* mp_map;
+    std::size_t m_map_bytes;
+
+}; // class GridTable
+
+//==============================================================================
+
+template <typename Scheme>
+void GridTable::lookup(
+    const double* const p_x, int n, double* const p_values) const
+{
+    const int W  = Scheme::width;
+    const int na = m_axes.size();
+
+    for (int d = 0; d < na; ++d)
+        if (m_axes[d].size() < W) throw InvalidInputError(
+            "grid table axis size", m_axes[d].size())
+            << "The interpolation scheme needs at least " << W
+            << " nodes per axis.";
+
+    // Each axis but the last one needs the stencil values of the next axis
+    double stack_work[256];
+    std::vector<double> heap_work;
+    double* p_work = stack_work;
+    const std::size_t work_size = std::size_t(na-1)*W*m_nf;
+    if (work_size > 256) {
+        heap_work.resize(work_size);
+        p_work = &heap_work[0];
+    }
+
+    int start[MAX_AXES], j[MAX_AXES], i;
+    double t[MAX_AXES];
+
+    // Tables of a single variable do not need the recursion
+    if (na == 1) {
+        const double* p_rows[W];
+        for (int k = 0; k < n; ++k) {
+            m_axes[0].locate(p_x[k], i, t[0]);
+            start[0] = std::min(
+                std::max(i - (W/2 - 1), 0), m_axes[0].size() - W);
+            for (int r = 0; r < W; ++r)
+                p_rows[r] = mp_data + (start[0] + r)*m_strides[0];
+            Scheme::combine(
+                t[0], i - start[0], p_rows, m_nf, p_values + k*m_nf);
+        }
+        return;
+    }
+
+    for (int k = 0; k < n; ++k) {
+        for (int d = 0; d < na; ++d) {
+            m_axes[d].locate(p_x[k*na+d], i, t[d]);
+            start[d] = std::min(
+                std::max(i - (W/2 - 1), 0), m_axes[d].size() - W);
+            j[d] = i - start[d];
+        }
+        interpolate<Scheme>(0, 0, start, j, t, p_work, p_values + k*m_nf);
+    }
+}
+
+//==============================================================================
+
+template <typename Scheme>
+void GridTable::interpolate(
+    int d, std::size_t offset, const int* const p_start, const int* const p_j,
+    const double* const p_t, double* const p_work,
+    double* const p_values) const
+{
+    const int W = Scheme::width;
+    const double* p_rows[W];
+
+    if (d == int(m_axes.size()) - 1) {
+        for (int k = 0; k < W; ++k)
+            p_rows[k] = mp_data + offset + (p_start[d] + k)*m_strides[d];
+    } else {
+        for (int k = 0; k < W; ++k) {
+            interpolate<Scheme>(
+                d+1, offset + (p_start[d] + k)*m_strides[d], p_start, p_j, p_t,
+                p_work + W*m_nf, p_work + k*m_nf);
+            p_rows[k] = p_work + k*m_nf;
+        }
+    }
+
+    Scheme::combine(p_t[d], p_j[d], p_rows, m_nf, p_values);
+}
+
+    } // namespace Utilities
+} // namespace Mutation
+
+#endif // UTILITIES_GRID_TABLE_H
@@ -39,6 +39,7 @@
 
 #include "Errors.h"
 #include "Functors.h"
+#include "SharedTable.h"
 
 namespace Mutation {
     namespace Utilities {
@@ -204,6 +205,18 @@ public:
      * @param file_name  the name of the file to save to, it will be overwritten
      */
     void save(const std::string &file_name) const;
+
+    /**
+     * Replaces the table storage with a read-only copy shared by all the
+     * processes on the node which hold the same table, provided table sharing
+     * is enabled.
+     *
+     * @param tag  short name describing the table
+     * @return true if the table is now shared, false otherwise
+     *
+     * @see SharedTable
+     */
+    bool share(const std::string& tag);
     
     /**
      * Returns number of indices (rows) in the table.
@@ -297,6 +310,8 @@ private:
     
     IndexType *mp_indices;
     DataType  *mp_data;
+
+    SharedTable* mp_shared;
     
 }; // class LookupTable
 
@@ -427,8 +442,11 @@ LookupTable<IndexType, DataType, FunctionType>::LookupTable(
 template<typename IndexType, typename DataType, typename FunctionType>
 LookupTable<IndexType, DataType, FunctionType>::~LookupTable() 
 {
-    delete [] mp_indices;
-    delete [] mp_data;
+    if (mp_shared == NULL) {
+        delete [] mp_indices;
+        delete [] mp_data;
+    }
+    delete mp_shared;
     
     mp_indices = NULL;
     mp_data    = NULL;
@@ -446,6 +464,7 @@ void LookupTable<IndexType, DataType, FunctionType>::initialize(
     m_row_size = sizeof(DataType) * m_num_functions;
     
     m_is_constant_delta = false;
+    mp_shared = NULL;
     
     // Allocate table storage
     mp_indices = new IndexType [m_num_indices];
@@ -657,6 +676,44 @@ void LookupTable<IndexType, DataType, FunctionType>::save(
 
 //==============================================================================
 
+template<typename IndexType, typename DataType, typename FunctionType>
+bool LookupTable<IndexType, DataType, FunctionType>::share(const std::string& tag)
+{
+    if (mp_shared != NULL)
+        return true;
+    if (!SharedTable::enabled())
+        return false;
+
+    // Pack the indices followed by the (aligned) data in a single block
+    const size_t index_bytes = m_num_indices * sizeof(IndexType);
+    const size_t offset = (index_bytes + sizeof(DataType) - 1) /
+        sizeof(DataType) * sizeof(DataType);
+    const size_t bytes = offset + m_num_indices * m_row_size;
+
+    char* p_block = new char [bytes];
+    std::memset(p_block, 0, bytes);
+    memcpy(p_block, mp_indices, index_bytes);
+    memcpy(p_block + offset, mp_data, m_num_indices * m_row_size);
+
+    mp_shared = SharedTable::share(tag, p_block, bytes);
+    delete [] p_block;
+
+    if (mp_shared == NULL)
+        return false;
+
+    // Switch to the shared copy, which is only ever read
+    delete [] mp_indices;
+    delete [] mp_data;
+
+    char* p_shared = static_cast<char*>(const_cast<void*>(mp_shared->data()));
+    mp_indices = reinterpret_cast<IndexType*>(p_shared);
+    mp_data    = reinterpret_cast<DataType*>(p_shared + offset);
+
+    return true;
+} // share()
+
+//==============================================================================
+
 template<typename IndexType, typename DataType, typename FunctionType>
 template<typename OP>
 void LookupTable<IndexType, DataType, FunctionType>::lookup(
@@ -0,0 +1,394 @@
+/**
+ * @file SharedTable.cpp
+ *
+ * @brief Implementation of the SharedTable class.
+ */
+
+/*
+ * Copyright 2014-2018 von Karman Institute for Fluid Dynamics (VKI)
+ *
+ * This file is part of MUlticomponent Thermodynamic And Transport
+ * properties for IONized gases in C++ (Mutation++) software package.
+ *
+ * Mutation++ is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as
+ * published by the Free Software Foundation, either version 3 of the
+ * License, or (at your option) any later version.
+ *
+ * Mutation++ is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with Mutation++.  If not, see
+ * <http://www.gnu.org/licenses/>.
+ */
+
+#include "SharedTable.h"
+#include "GlobalOptions.h"
+
+#include <cstring>
+#include <sstream>
+#include <vector>
+
+#ifndef _WIN32
+#include <cerrno>
+#include <dirent.h>
+#include <fcntl.h>
+#include <signal.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace Mutation {
+    namespace Utilities {
+
+#ifndef _WIN32
+
+/// Header written at the beginning of every shared segment.
+struct SharedTableHeader
+{
+    unsigned long long magic;
+    unsigned long long bytes;
+    int owner;
+    volatile int ready;
+    unsigned int key_bytes;
+};
+
+// The key and the data follow the header, aligned for any table element type
+static const std::size_t SHARED_ALIGN_BYTES = 64;
+static const unsigned long long SHARED_MAGIC = 0x6d70702d7461626cULL;
+
+// Values of the ready flag
+static const int SHARED_RESERVED  = 0;
+static const int SHARED_PUBLISHED = 1;
+static const int SHARED_ABANDONED = -1;
+
+// Time to wait for a segment to get an owner (10 s), after which it is
+// considered stale.  Segments with a live owner are waited for until they are
+// published or abandoned.
+static const int SHARED_WAIT_STEPS = 10000;
+static const int SHARED_WAIT_USEC  = 1000;
+
+//==============================================================================
+
+/// 64 bit FNV-1a hash of a block of memory.
+static unsigned long long hashBytes(const void* const p_data, std::size_t bytes)
+{
+    const unsigned char* p = static_cast<const unsigned char*>(p_data);
+    unsigned long long hash = 0xcbf29ce484222325ULL;
+    for (std::size_t i = 0; i < bytes; ++i) {
+        hash ^= p[i];
+        hash *= 0x100000001b3ULL;
+    }
+    return hash;
+}
+
+//==============================================================================
+
+/// Offset of the data in a segment holding the given key.
+static std::size_t dataOffset(std::size_t key_bytes)
+{
+    return SHARED_ALIGN_BYTES *
+        (1 + (key_bytes + SHARED_ALIGN_BYTES - 1) / SHARED_ALIGN_BYTES);
+}
+
+//==============================================================================
+
+/// Opens either a POSIX shared memory segment or a regular file.
+static int openSegment(const std::string& path, bool shm, int flags)
+{
+    return (shm ? shm_open(path.c_str(), flags, 0644) :
+                  open(path.c_str(), flags, 0644));
+}
+
+//==============================================================================
+
+/// Removes a segment.
+static bool removeSegment(const std::string& path, bool shm)
+{
+    return (shm ? shm_unlink(path.c_str()) : unlink(path.c_str())) == 0;
+}
+
+//==============================================================================
+
+/**
+ * Sizes and maps a segment just created by this process, and records this
+ * process as its owner along with the key.  Returns the writable mapping of
+ * the segment, or MAP_FAILED after removing it.
+ */
+static void* reserveSegment(
+    int fd, const std::string& path, bool shm, const std::string& key,
+    std::size_t bytes, std::size_t map_bytes)
+{
+    void* p_map = MAP_FAILED;
+    if (ftruncate(fd, map_bytes) == 0)
+        p_map = mmap(
+            NULL, map_bytes, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    close(fd);
+    if (p_map == MAP_FAILED) {
+        removeSegment(path, shm);
+        return MAP_FAILED;
+    }
+
+    // Record the owner first so that waiting processes can tell if it dies
+    SharedTableHeader* p_header = static_cast<SharedTableHeader*>(p_map);
+    p_header->owner = getpid();
+    std::memcpy(
+        static_cast<char*>(p_map) + SHARED_ALIGN_BYTES, key.data(), key.size());
+    p_header->key_bytes = key.size();
+    p_header->bytes = bytes;
+    p_header->magic = SHARED_MAGIC;
+    return p_map;
+}
+
+//==============================================================================
+
+/**
+ * Waits for an existing segment to be published and returns its read-only
+ * mapping, or MAP_FAILED if it cannot be used.  The segment is flagged as
+ * stale if its owner died or gave up before publishing it, or if it never got
+ * an owner.
+ */
+static void* attachSegment(
+    const std::string& path, bool shm, std::size_t map_bytes, bool& stale)
+{
+    stale = false;
+    const int fd = openSegment(path, shm, O_RDONLY);
+    if (fd < 0)
+        return MAP_FAILED;
+
+    void* p_map = MAP_FAILED;
+    bool ready = false;
+    int waited = 0;
+    while (!ready && !stale && waited < SHARED_WAIT_STEPS) {
+        struct stat st;
+        if (fstat(fd, &st) != 0)
+            break;
+
+        bool owned = false;
+        if (st.st_size == static_cast<off_t>(map_bytes)) {
+            if (p_map == MAP_FAILED)
+                p_map = mmap(NULL, map_bytes, PROT_READ, MAP_SHARED, fd, 0);
+            if (p_map == MAP_FAILED)
+                break;
+
+            const SharedTableHeader* p_header =
+                static_cast<const SharedTableHeader*>(p_map);
+            const int owner = p_header->owner;
+            ready = (p_header->ready == SHARED_PUBLISHED);
+            owned = (owner > 0 && (kill(owner, 0) == 0 || errno != ESRCH));
+            stale = !ready && (p_header->ready == SHARED_ABANDONED ||
+                (owner > 0 && !owned));
+        } else if (st.st_size != 0)
+            break;
+
+        if (!ready && !stale) {
+            usleep(SHARED_WAIT_USEC);
+            if (!owned)
+                ++waited;
+        }
+    }
+    close(fd);
+
+    stale = stale || (waited == SHARED_WAIT_STEPS);
+    if (!ready && p_map != MAP_FAILED) {
+        munmap(p_map, map_bytes);
+        p_map = MAP_FAILED;
+    }
+
+    return p_map;
+}
+
+#endif // _WIN32
+
+//==============================================================================
+
+bool SharedTable::enabled()
+{
+#ifdef _WIN32
+    return false;
+#else
+    return !GlobalOptions::sharedTables().empty();
+#endif
+}
+
+//==============================================================================
+
+SharedTable* SharedTable::open(
+    const std::string& tag, const std::string& key, std::size_t bytes)
+{
+    if (!enabled() || bytes == 0)
+        return NULL;
+
+#ifdef _WIN32
+    return NULL;
+#else
+    // Name the segment after the tag, the key and the size of the table
+    const std::string& location = GlobalOptions::sharedTables();
+    const bool shm = (location == "shm");
+
+    std::stringstream ss;
+    ss << "mpp-" << tag << "-" << std::hex << hashBytes(key.data(), key.size())
+       << "-" << std::dec << bytes;
+
+    const std::string path = (shm ? "/" + ss.str() :
+        location + GlobalOptions::separator() + ss.str() + ".tbl");
+    const std::size_t offset = dataOffset(key.size());
+    const std::size_t map_bytes = offset + bytes;
+
+    // Try to create the segment, in which case this process must fill it, or
+    // else attach to it.  A stale segment is removed and created again.
+    void* p_map = MAP_FAILED;
+    bool stale = true;
+    for (int attempt = 0; attempt < 2 && stale; ++attempt) {
+        const int fd = openSegment(path, shm, O_RDWR | O_CREAT | O_EXCL);
+        if (fd >= 0) {
+            p_map = reserveSegment(fd, path, shm, key, bytes, map_bytes);
+            return (p_map == MAP_FAILED ? NULL :
+                new SharedTable(path, shm, p_map, map_bytes, offset, bytes,
+                    false));
+        }
+
+        if (errno != EEXIST)
+            return NULL;
+
+        p_map = attachSegment(path, shm, map_bytes, stale);
+        if (stale)
+            removeSegment(path, shm);
+    }
+
+    if (p_map == MAP_FAILED)
+        return NULL;
+
+    // Only use the segment if it was published for exactly the same key
+    __sync_synchronize();
+    const SharedTableHeader* p_header =
+        static_cast<const SharedTableHeader*>(p_map);
+    if (p_header->magic != SHARED_MAGIC || p_header->bytes != bytes ||
+        p_header->key_bytes != key.size() ||
+        std::memcmp(static_cast<char*>(p_map) + SHARED_ALIGN_BYTES,
+            key.data(), key.size()) != 0) {
+        munmap(p_map, map_bytes);
+        return NULL;
+    }
+
+    return new SharedTable(path, shm, p_map, map_bytes, offset, bytes, true);
+#endif
+}
+
+//==============================================================================
+
+SharedTable* SharedTable::share(
+    const std::string& tag, const void* const p_data, std::size_t bytes)
+{
+    // The contents of the table are their own key
+    std::stringstream ss;
+    ss << std::hex << hashBytes(p_data, bytes);
+
+    SharedTable* p_table = open(tag, ss.str(), bytes);
+    if (p_table == NULL)
+        return NULL;
+
+    if (!p_table->published())
+        p_table->publish(p_data);
+    else if (std::memcmp(p_table->data(), p_data, bytes) != 0) {
+        delete p_table;
+        return NULL;
+    }
+
+    return p_table;
+}
+
+//==============================================================================
+
+int SharedTable::removeAll()
+{
+    if (!enabled())
+        return 0;
+
+#ifdef _WIN32
+    return 0;
+#else
+    const std::string& location = GlobalOptions::sharedTables();
+    const bool shm = (location == "shm");
+
+    // POSIX shared memory is only listed as files on Linux
+    DIR* p_dir = opendir(shm ? "/dev/shm" : location.c_str());
+    if (p_dir == NULL)
+        return 0;
+
+    std::vector<std::string> paths;
+    for (dirent* p_entry = readdir(p_dir); p_entry != NULL;
+         p_entry = readdir(p_dir)) {
+        const std::string name = p_entry->d_name;
+        if (name.compare(0, 4, "mpp-") != 0)
+            continue;
+        if (shm)
+            paths.push_back("/" + name);
+        else if (name.size() > 4 &&
+            name.compare(name.size() - 4, 4, ".tbl") == 0)
+            paths.push_back(location + GlobalOptions::separator() + name);
+    }
+    closedir(p_dir);
+
+    int removed = 0;
+    for (int i = 0; i < paths.size(); ++i)
+        removed += removeSegment(paths[i], shm);
+    return removed;
+#endif
+}
+
+//==============================================================================
+
+SharedTable::SharedTable(
+    const std::string& name, bool shm, void* p_map, std::size_t map_bytes,
+    std::size_t offset, std::size_t bytes, bool published) :
+    m_name(name),
+    m_shm(shm),
+    mp_map(p_map),
+    m_map_bytes(map_bytes),
+    mp_data(static_cast<char*>(p_map) + offset),
+    m_bytes(bytes),
+    m_published(published)
+{ }
+
+//==============================================================================
+
+void SharedTable::publish(const void* const p_data)
+{
+#ifndef _WIN32
+    if (m_published)
+        return;
+
+    std::memcpy(mp_data, p_data, m_bytes);
+
+    // Make sure the data is visible before flagging it as ready
+    __sync_synchronize();
+    static_cast<SharedTableHeader*>(mp_map)->ready = SHARED_PUBLISHED;
+    m_published = true;
+
+    mprotect(mp_map, m_map_bytes, PROT_READ);
+#endif
+}
+
+//==============================================================================
+
+SharedTable::~SharedTable()
+{
+#ifndef _WIN32
+    // Let the processes waiting for a table which will never be filled know
+    if (!m_published) {
+        static_cast<SharedTableHeader*>(mp_map)->ready = SHARED_ABANDONED;
+        removeSegment(m_name, m_shm);
+    }
+    munmap(mp_map, m_map_bytes);
+#endif
+}
+
+//==============================================================================
+
+    } // namespace Utilities
+} // namespace Mutation
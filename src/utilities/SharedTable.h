@@ -0,0 +1,166 @@
+/**
+ * @file SharedTable.h
+ *
+ * @brief Declaration of the SharedTable class.
+ */
+
+/*
+ * Copyright 2014-2018 von Karman Institute for Fluid Dynamics (VKI)
+ *
+ * This file is part of MUlticomponent Thermodynamic And Transport
+ * properties for IONized gases in C++ (Mutation++) software package.
+ *
+ * Mutation++ is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as
+ * published by the Free Software Foundation, either version 3 of the
+ * License, or (at your option) any later version.
+ *
+ * Mutation++ is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with Mutation++.  If not, see
+ * <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef UTILITIES_SHARED_TABLE_H
+#define UTILITIES_SHARED_TABLE_H
+
+#include <cstddef>
+#include <string>
+
+namespace Mutation {
+    namespace Utilities {
+
+/**
+ * A read-only block of memory shared by all processes on a node which hold
+ * identical data, such as the tables of collision integrals or electronic
+ * partition functions that every MPI rank would otherwise keep a private copy
+ * of.
+ *
+ * Tables are identified by a tag and a key describing everything their values
+ * depend on.  The first process to open a table reserves its segment, fills
+ * it and publishes it; the other processes wait for it to be published and
+ * attach to it read-only, without computing the table at all.  The full key
+ * is stored in the segment, so a process never attaches to a table built for
+ * different inputs.  Tables which have no such key are shared with share(),
+ * which uses their contents as the key: every process then computes its own
+ * copy before it can attach, and only saves the memory.
+ *
+ * A segment whose owner died or threw before publishing it is detected from
+ * the process id recorded in its header, removed and created again.
+ * Segments outlive the processes which created them, so later runs attach
+ * immediately.  They are the files named mpp-* in the table directory, or in
+ * /dev/shm on Linux, and are removed with removeAll() or by deleting the
+ * files; processes already attached keep their mapping.
+ *
+ * Sharing is enabled through GlobalOptions::sharedTables() (or the
+ * MPP_SHARED_TABLES environment variable): "shm" uses named POSIX shared
+ * memory while any other value is the directory holding memory-mapped table
+ * files.  No MPI is required.
+ *
+ * <b>Example usage:</b>
+ * @code
+ * SharedTable* p_shared = SharedTable::open("table", key, bytes);
+ * if (p_shared != NULL && !p_shared->published()) {
+ *     fillTable(p_data);
+ *     p_shared->publish(p_data);
+ * }
+ * @endcode
+ */
+class SharedTable
+{
+public:
+
+    /**
+     * Returns the shared table with the given tag and key, owned by the
+     * caller.  If no other process has published it yet, the table is
+     * reserved for this process, which must fill it with publish(); the other
+     * processes opening it wait until then.  NULL is returned if sharing is
+     * disabled or the table could not be obtained, in which case the caller
+     * keeps a private table.
+     *
+     * @param tag    short name describing the table (used in the segment name)
+     * @param key    description of everything the table values depend on
+     * @param bytes  size of the table in bytes
+     */
+    static SharedTable* open(
+        const std::string& tag, const std::string& key, std::size_t bytes);
+
+    /**
+     * Returns a new shared, read-only copy of the given data, owned by the
+     * caller.  The data is its own key, so it must be computed by every
+     * process.  NULL is returned if sharing is disabled or the shared copy
+     * could not be obtained, in which case the caller simply keeps its
+     * private data.
+     *
+     * @param tag     short name describing the table (used in the segment name)
+     * @param p_data  pointer to the data to share
+     * @param bytes   size of the data in bytes
+     */
+    static SharedTable* share(
+        const std::string& tag, const void* const p_data, std::size_t bytes);
+
+    /**
+     * Removes all the shared tables of the current location, and returns
+     * their number.  Processes attached to them are not affected, while new
+     * processes create them again.
+     */
+    static int removeAll();
+
+    /// Returns true if table sharing is enabled.
+    static bool enabled();
+
+    /**
+     * Unmaps the shared memory.  A published segment is left in place, while
+     * a reserved one which was never published is removed.
+     */
+    ~SharedTable();
+
+    /// Returns true if the data of the table can be used.
+    bool published() const { return m_published; }
+
+    /**
+     * Copies the data into a table reserved by open() and makes it available
+     * to all processes.  Does nothing if the table is already published.
+     */
+    void publish(const void* const p_data);
+
+    /// Returns a pointer to the shared data.
+    const void* data() const { return mp_data; }
+
+    /// Returns the size of the shared data in bytes.
+    std::size_t size() const { return m_bytes; }
+
+    /// Returns the name of the shared memory segment or table file.
+    const std::string& name() const { return m_name; }
+
+private:
+
+    /// Only created through share().
+    SharedTable(
+        const std::string& name, bool shm, void* p_map, std::size_t map_bytes,
+        std::size_t offset, std::size_t bytes, bool published);
+
+    // Not copyable
+    SharedTable(const SharedTable&);
+    SharedTable& operator=(const SharedTable&);
+
+private:
+
+    std::string m_name;
+    bool m_shm;
+    void* mp_map;
+    std::size_t m_map_bytes;
+    void* mp_data;
+    std::size_t m_bytes;
+    bool m_published;
+
+}; // class SharedTable
+
+    } // namespace Utilities
+} // namespace Mutation
+
+#endif // UTILITIES_SHARED_TABLE_H
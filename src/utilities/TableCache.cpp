@@ -0,0 +1,182 @@
+/**
+ * @file TableCache.cpp
+ *
+ * @brief Implementation of the TableCache class.
+ */
+
+/*
+ * Copyright 2014-2018 von Karman Institute for Fluid Dynamics (VKI)
+ *
+ * This file is part of MUlticomponent Thermodynamic And Transport
+ * properties for IONized gases in C++ (Mutation++) software package.
+ *
+ * Mutation++ is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as
+ * published by the Free Software Foundation, either version 3 of the
+ * License, or (at your option) any later version.
+ *
+ * Mutation++ is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with Mutation++.  If not, see
+ * <http://www.gnu.org/licenses/>.
+ */
+
+#include "TableCache.h"
+#include "GlobalOptions.h"
+
+#include <algorithm>
+#include <cstdio>
+#include <fstream>
+#include <sstream>
+#include <vector>
+
+#ifndef _WIN32
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace Mutation {
+    namespace Utilities {
+
+/// Header written at the beginning of every cache file.
+struct TableCacheHeader
+{
+    unsigned long long magic;
+    unsigned long long version;
+    unsigned long long key_bytes;
+    unsigned long long size;
+};
+
+static const unsigned long long CACHE_MAGIC = 0x6d70702d63616368ULL;
+
+// Increment when the layout or the generation of cached tables changes
+static const unsigned long long CACHE_VERSION = 2;
+
+//==============================================================================
+
+/// 64 bit FNV-1a hash of a string.
+static unsigned long long hashKey(const std::string& key)
+{
+    unsigned long long hash = 0xcbf29ce484222325ULL;
+    for (std::size_t i = 0; i < key.size(); ++i) {
+        hash ^= static_cast<unsigned char>(key[i]);
+        hash *= 0x100000001b3ULL;
+    }
+    return hash;
+}
+
+//==============================================================================
+
+bool TableCache::enabled()
+{
+    return !GlobalOptions::tableCache().empty();
+}
+
+//==============================================================================
+
+std::string TableCache::digest(const std::string& data)
+{
+    std::stringstream ss;
+    ss << std::hex << hashKey(data);
+    return ss.str();
+}
+
+//==============================================================================
+
+std::string TableCache::fileName(
+    const std::string& tag, const std::string& key)
+{
+    std::stringstream ss;
+    ss << GlobalOptions::tableCache() << GlobalOptions::separator()
+       << "mpp-" << tag << "-" << std::hex << hashKey(key) << ".cache";
+    return ss.str();
+}
+
+//==============================================================================
+
+bool TableCache::load(
+    const std::string& tag, const std::string& key, double* const p_data,
+    std::size_t n)
+{
+    if (!enabled() || n == 0)
+        return false;
+
+    std::ifstream file(fileName(tag, key).c_str(), std::ios::binary);
+    if (!file.is_open())
+        return false;
+
+    TableCacheHeader header;
+    file.read(reinterpret_cast<char*>(&header), sizeof(header));
+    if (!file || header.magic != CACHE_MAGIC ||
+        header.version != CACHE_VERSION || header.key_bytes != key.size() ||
+        header.size != n)
+        return false;
+
+    // The file name only holds a hash of the key, so compare the full key
+    std::string file_key(key.size(), '\0');
+    if (!key.empty())
+        file.read(&file_key[0], file_key.size());
+    if (!file || file_key != key)
+        return false;
+
+    // Read into a buffer so that p_data is untouched if the file is truncated
+    std::vector<double> values(n);
+    file.read(reinterpret_cast<char*>(&values[0]), n*sizeof(double));
+    if (!file)
+        return false;
+
+    std::copy(values.begin(), values.end(), p_data);
+    return true;
+}
+
+//==============================================================================
+
+bool TableCache::save(
+    const std::string& tag, const std::string& key,
+    const double* const p_data, std::size_t n)
+{
+    if (!enabled() || n == 0)
+        return false;
+
+    const std::string name = fileName(tag, key);
+
+    // Write to a private file first so readers never see a partial table
+    std::stringstream ss;
+    ss << name << ".tmp";
+#ifndef _WIN32
+    mkdir(GlobalOptions::tableCache().c_str(), 0755);
+    ss << "." << getpid();
+#endif
+    const std::string tmp = ss.str();
+
+    TableCacheHeader header;
+    header.magic     = CACHE_MAGIC;
+    header.version   = CACHE_VERSION;
+    header.key_bytes = key.size();
+    header.size      = n;
+
+    std::ofstream file(tmp.c_str(), std::ios::binary);
+    if (!file.is_open())
+        return false;
+
+    file.write(reinterpret_cast<const char*>(&header), sizeof(header));
+    file.write(key.data(), key.size());
+    file.write(reinterpret_cast<const char*>(p_data), n*sizeof(double));
+    file.close();
+
+    if (!file || std::rename(tmp.c_str(), name.c_str()) != 0) {
+        std::remove(tmp.c_str());
+        return false;
+    }
+
+    return true;
+}
+
+//==============================================================================
+
+    } // namespace Utilities
+} // namespace Mutation
@@ -0,0 +1,100 @@
+/**
+ * @file TableCache.h
+ *
+ * @brief Declaration of the TableCache class.
+ */
+
+/*
+ * Copyright 2014-2018 von Karman Institute for Fluid Dynamics (VKI)
+ *
+ * This file is part of MUlticomponent Thermodynamic And Transport
+ * properties for IONized gases in C++ (Mutation++) software package.
+ *
+ * Mutation++ is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as
+ * published by the Free Software Foundation, either version 3 of the
+ * License, or (at your option) any later version.
+ *
+ * Mutation++ is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with Mutation++.  If not, see
+ * <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef UTILITIES_TABLE_CACHE_H
+#define UTILITIES_TABLE_CACHE_H
+
+#include <cstddef>
+#include <string>
+
+namespace Mutation {
+    namespace Utilities {
+
+/**
+ * Stores generated data tables on disk so that later runs can reload them
+ * instead of evaluating the underlying models again.
+ *
+ * A table is identified by a tag and a key.  The key must describe everything
+ * the table values depend on (the model data, the grid, ...).  Files are named
+ * after a hash of the key, and the full key is stored in the file and compared
+ * on load, so that a table is never loaded for a different key.  Large inputs
+ * such as database files can be replaced by their digest() in the key, at the
+ * price of trusting a 64 bit hash for them.  Files are written under a
+ * temporary name and then renamed, which makes it safe for several processes
+ * to fill the cache at the same time.
+ *
+ * The cache is enabled by setting GlobalOptions::tableCache() (or the
+ * MPP_TABLE_CACHE environment variable) to the cache directory.
+ *
+ * <b>Example usage:</b>
+ * @code
+ * if (!TableCache::load("table", key, p_data, n)) {
+ *     fillTable(p_data, n);
+ *     TableCache::save("table", key, p_data, n);
+ * }
+ * @endcode
+ */
+class TableCache
+{
+public:
+
+    /// Returns true if the table cache is enabled.
+    static bool enabled();
+
+    /**
+     * Fills p_data with the n values of the table cached for the given tag and
+     * key.  Returns false, leaving p_data untouched, if the cache is disabled
+     * or does not hold a matching table.
+     */
+    static bool load(
+        const std::string& tag, const std::string& key, double* const p_data,
+        std::size_t n);
+
+    /**
+     * Writes the n values of the table to the cache under the given tag and
+     * key.  Returns false if the cache is disabled or the file could not be
+     * written.
+     */
+    static bool save(
+        const std::string& tag, const std::string& key,
+        const double* const p_data, std::size_t n);
+
+    /**
+     * Returns a short digest of the given data, which can be used in keys in
+     * place of large inputs such as the contents of a database file.
+     */
+    static std::string digest(const std::string& data);
+
+    /// Returns the name of the cache file for the given tag and key.
+    static std::string fileName(const std::string& tag, const std::string& key);
+
+}; // class TableCache
+
+    } // namespace Utilities
+} // namespace Mutation
+
+#endif // UTILITIES_TABLE_CACHE_H
@@ -94,7 +94,7 @@ public:
     }
 
     /// Converts given number from these units to appropriate base units.
-    double convertToBase(const double number) {
+    double convertToBase(const double number) const {
         return m_factor * number;
     }
 
@@ -35,11 +35,15 @@
 #include <fstream>
 
 #include "AutoRegistration.h"
+#include "EmbeddedData.h"
 #include "GlobalOptions.h"
+#include "GridTable.h"
 #include "IteratorWrapper.h"
 #include "LookupTable.h"
 #include "ReferenceServer.h"
+#include "SharedTable.h"
 #include "StringUtils.h"
+#include "TableCache.h"
 #include "TemporaryFile.h"
 #include "Units.h"
 #include "XMLite.h"
@@ -103,6 +107,16 @@ static std::string appendExtension(
  * 4) data_directory/dir/name.ext
  *
  * If the file is not found, then the last location searched is returned.
+ *
+ * When the library embeds the data directory, a bare file name (without any
+ * directory) is also looked up among the embedded files as name.ext and
+ * dir/name.ext, in place of the data directory.  Without a working directory,
+ * this is done first so that bundled files are found without touching the
+ * disk.  Files on disk are used instead of the bundled ones by giving a name
+ * with a directory, by setting a working directory holding them, or by
+ * disabling the embedded files with GlobalOptions::embeddedData().  The
+ * returned name must be opened with an IO::DataFileStream (or an
+ * IO::XmlDocument).
  */
 static std::string databaseFileName(
     std::string name, const std::string& dir, const std::string& ext = ".xml")
@@ -112,26 +126,51 @@ static std::string databaseFileName(
         name.substr(name.length()-ext.length()) != ext)
         name = appendExtension(name, ext);
 
+    // Bundled files are read from the library when it embeds them, after the
+    // user's own files when a working directory is given
+    const bool embedded = GlobalOptions::embeddedData() &&
+        name.find('/') == std::string::npos &&
+        name.find(GlobalOptions::separator()) == std::string::npos;
+    const std::string& working_dir = GlobalOptions::workingDirectory();
+
+    std::string path;
+    if (embedded && working_dir.empty()) {
+        path = IO::embeddedDatabasePath(name, dir);
+        if (!path.empty())
+            return path;
+    }
+
     // Check the working directory first
-    std::string path = prependPath(GlobalOptions::workingDirectory(), name);
+    path = prependPath(working_dir, name);
     if (std::ifstream(path.c_str(), std::ios::in).is_open())
         return path;
 
     // Check the working directory with assumed folder hierarchy
-    path = prependPath(GlobalOptions::workingDirectory(), dir);
+    path = prependPath(working_dir, dir);
     path = prependPath(path, name);
     if (std::ifstream(path.c_str(), std::ios::in).is_open())
         return path;
 
+    if (embedded && !working_dir.empty()) {
+        path = IO::embeddedDatabasePath(name, dir);
+        if (!path.empty())
+            return path;
+    }
+
     // Check data directory
     path = prependPath(GlobalOptions::dataDirectory(), name);
     if (std::ifstream(path.c_str(), std::ios::in).is_open())
         return path;
 
-    // If we didn't find it there then just return path with data directory and
-    // assumed folder hierarchy
+    // Check data directory with assumed folder hierarchy
     path = prependPath(GlobalOptions::dataDirectory(), dir);
-    return prependPath(path, name);
+    path = prependPath(path, name);
+    if (std::ifstream(path.c_str(), std::ios::in).is_open())
+        return path;
+
+    // If we didn't find it anywhere then just return path with data directory
+    // and assumed folder hierarchy
+    return path;
 }
 
 /**
@@ -29,11 +29,14 @@
  */
 
 
+#include "EmbeddedData.h"
 #include "Errors.h"
 #include "XMLite.h"
 #include "StringUtils.h"
 
+#include <cstddef>
 #include <cstdlib>
+#include <cstring>
 #include <iostream>
 #include <fstream>
 
@@ -49,19 +52,54 @@ namespace Mutation {
 XmlDocument::XmlDocument(const std::string &filename)
     : m_filename(filename)
 {
-    ifstream xml_file(m_filename.c_str(), ios::in);
+    parse(readFile(filename));
+}
+
+//==============================================================================
+
+XmlDocument::XmlDocument(
+    const std::string& filename, const std::string& contents)
+    : m_filename(filename)
+{
+    parse(contents);
+}
+
+//==============================================================================
+
+std::string XmlDocument::readFile(const std::string& filename)
+{
+    DataFileStream xml_file(filename, ios::in | ios::binary);
 
     if (!xml_file.is_open())
         throw FileNotFoundError(filename);
-    
+
+    // Read the whole file at once and parse it from memory
+    xml_file.seekg(0, ios::end);
+    std::string buffer(static_cast<size_t>(xml_file.tellg()), '\0');
+    xml_file.seekg(0, ios::beg);
+    if (!buffer.empty())
+        xml_file.read(&buffer[0], buffer.size());
+    xml_file.close();
+
+    return buffer;
+}
+
+//==============================================================================
+
+void XmlDocument::parse(const std::string& buffer)
+{
+    const char* p = buffer.c_str();
+    const char* const end = p + buffer.size();
+
     int line = 1;
     m_elements.push_back(XmlElement(NULL, this));
-    while (m_elements.back().parse(xml_file, line)) {
+    while (m_elements.back().parse(p, end, line)) {
         m_elements.push_back(XmlElement(NULL, this));
     }
     m_elements.pop_back();
-    
-    xml_file.close();
+
+    for (int i = 0; i < m_elements.size(); ++i)
+        m_elements[i].setParents();
 }
 
 //==============================================================================
@@ -158,171 +196,175 @@ bool XmlElement::getAttribute(const std::string &name, bool &value) const
 
 //==============================================================================
 
-bool XmlElement::parse(
-    istream &is, int &line, string name, ParseState state)
+/// Returns true if c is an XML white space character.
+static inline bool isSpace(const char c)
+{
+    return (c == ' ' || c == '\t' || c == '\n' || c == '\r');
+}
+
+//==============================================================================
+
+/// Returns true if the range [p, end) starts with the given string.
+static inline bool startsWith(
+    const char* const p, const char* const end, const char* const str)
+{
+    const size_t n = std::strlen(str);
+    return (end - p >= static_cast<ptrdiff_t>(n) && std::strncmp(p, str, n) == 0);
+}
+
+//==============================================================================
+
+bool XmlElement::parse(const char*& p, const char* const end, int& line)
+{
+    while (p != end) {
+        const char c = *p;
+        if (isSpace(c)) {
+            if (c == '\n') line++;
+            ++p;
+        } else if (c != '<') {
+            _parseError(mp_document, line,
+                string("encountered character other than ") +
+                string("start-tag '<' at the top level of the") +
+                string(" document"));
+        } else if (startsWith(p, end, "<!--")) {
+            skipComment(p, end, line);
+        } else if (startsWith(p, end, "<?")) {
+            // Skip processing instructions such as the XML declaration
+            while (p != end && !startsWith(p, end, "?>"))
+                if (*p++ == '\n') line++;
+            if (p == end)
+                _parseError(mp_document, line,
+                    "reached end of file in processing instruction");
+            p += 2;
+        } else {
+            parseElement(p, end, line);
+            return true;
+        }
+    }
+
+    return false;
+}
+
+//==============================================================================
+
+void XmlElement::skipComment(
+    const char*& p, const char* const end, int& line) const
+{
+    const long int start = line;
+    p += 4;
+    while (p != end && !startsWith(p, end, "--"))
+        if (*p++ == '\n') line++;
+
+    if (p == end)
+        _parseError(mp_document, start, "reached end of file in comment");
+    if (!startsWith(p, end, "-->"))
+        _parseError(mp_document, line,
+            "cannot use \"--\" in comment except for end-tag");
+    p += 3;
+}
+
+//==============================================================================
+
+void XmlElement::parseElement(const char*& p, const char* const end, int& line)
 {
-    // State-machine logic for reading in XML data
-    char c;
-    m_tag = name;
-    name = "";
-    string value = "";
-    
-    // Record the start line for error statements
     m_line_number = line;
-    ParseState previous = state;
-    bool done = false;
-  
-    while (!done && is.get(c)) {
-        if (c == '\n')
-            line++;
-        
-        switch (state) {
-            case initial:
-                if ( !(c == ' ' || c == '\t' || c == '\n' || c == '\r') ) {
-                    m_line_number = line;
-                    if (c == '<')
-                        state = el_name;
-                    else
-                        _parseError(mp_document, line, 
-                            string("encountered character other than ") + 
-                            string("start-tag '<' at the top level of the") +
-                            string(" document"));
-                }
-                break;
-            case el_name:
-                if (m_tag == "!--") {
-                    previous = initial;
-                    state = comment;
-                    m_tag.clear();
-                    break;
-                }
-                if (c == ' ' || c == '\t' || c == '\n' || c == '\r') {
-                    if (m_tag.empty()) {
-                        _parseError(mp_document, line, 
-                            string("element names must begin directly after") +
-                            string(" the start-tag"));
-                    } else {
-                        state = attributes;
-                   }
-                } else if (c == '>') {
-                    state = el_value;
-                } else {
-                    m_tag += c;
-                }
-                break;
-            case attributes:
-                if (!(c == ' ' || c == '\t' || c == '=' || c == '\n' || c == '\r')) {
-                    if (c == '/') {
-                        done = true;
-                        is.get();
-                    } else if (c == '>') {
-                        state = el_value;
-                    } else if (c == '\"') {
-                        state = att_value;
-                    } else {
-                        state = att_name;
-                        is.unget();
-                    }
-                }
-                break;
-            case att_name:
-                if (!(c == '=' || c == ' ' || c == '\t'))
-                    name += c;
-                else
-                    state = attributes;
-                break;
-            case att_value:
-                if (c != '\"') {
-                    value += c;
-                } else {
-                    state = attributes;
-                    m_attributes[name] = value;
-                    name.clear();
-                    value.clear();
-                }
-                break;
-            case el_value:
-                if (c == '<') {
-                    state = child_name;
-                    m_text = value;
-                    value.clear();
-                } else {
-                    value += c;
-                }
-                break;
-            case child_name:
-                if (name == "!--") {
-                    previous = el_value;
-                    state = comment;
-                    name.clear();
-                    break;
-                }
-                if (c == ' ') {
-                    XmlElement element(this, mp_document);
-                    //element.parse(is, line, name, attributes);
-                    m_children.push_back(element);
-                    m_children.back().parse(is, line, name, attributes);
-                    name = "";
-                    state = el_value;
-                } else if (c == '>') {
-                    if (name[0] == '/') {
-                        if (name == "/"+m_tag)
-                            done = true;
-                        else
-                            _parseError(mp_document, line,
-                                "expecting end-tag </"+m_tag+"> but instead "+
-                                "found <"+name+">");
-                    } else {
-                        XmlElement element(this, mp_document);
-                        //element.parse(is, line, name, el_value);
-                        m_children.push_back(element);
-                        m_children.back().parse(is, line, name, el_value);
-                        name = "";
-                        state = el_value;
-                    }
-                } else {
-                    name += c;
-                }
-                break;
-            case comment:
-                if (c == '-')
-                    state = comment_end_1;
-                break;
-            case comment_end_1:
-                if (c == '-')
-                    state = comment_end_2;
-                else
-                    state = comment;
-                break;
-            case comment_end_2:
-                if (c == '>')
-                    state = previous;
-                else
-                    _parseError(mp_document, line, 
-                        "cannot use \"--\" in comment except for end-tag");
-                break;
-        } // state switch
-    } // while not done with state-machine
-    
-    // Make sure we ended where we thought we would
-    // note we could be more descriptive with the error statement by seeing
-    // what state actually is
-    if (!done) {
-        if (m_tag.empty())
-            return false;
-        else
-            _parseError(mp_document, m_line_number, 
+
+    // Element name
+    const char* start = ++p;
+    while (p != end && !isSpace(*p) && *p != '>' && *p != '/')
+        ++p;
+    if (p == start)
+        _parseError(mp_document, line,
+            "element names must begin directly after the start-tag");
+    m_tag.assign(start, p);
+
+    // Attributes
+    std::string name;
+    bool has_content = false;
+    while (true) {
+        if (p == end)
+            _parseError(mp_document, m_line_number,
+                "reached end of file before element " + m_tag + " ended");
+
+        const char c = *p;
+        if (isSpace(c) || c == '=') {
+            if (c == '\n') line++;
+            ++p;
+        } else if (c == '/') {
+            // Empty-element tag
+            if (++p != end) ++p;
+            break;
+        } else if (c == '>') {
+            ++p;
+            has_content = true;
+            break;
+        } else if (c == '"') {
+            start = ++p;
+            while (p != end && *p != '"')
+                if (*p++ == '\n') line++;
+            if (p == end)
+                continue;
+            m_attributes[name].assign(start, p++);
+            name.clear();
+        } else {
+            start = p;
+            while (p != end && !isSpace(*p) && *p != '=' && *p != '>' &&
+                   *p != '/' && *p != '"')
+                ++p;
+            name.assign(start, p);
+        }
+    }
+
+    // Content (text and child elements) up to the matching end-tag
+    while (has_content) {
+        start = p;
+        while (p != end && *p != '<')
+            if (*p++ == '\n') line++;
+        if (p == end)
+            _parseError(mp_document, m_line_number,
                 "reached end of file before element " + m_tag + " ended");
+        m_text.assign(start, p);
+
+        if (startsWith(p, end, "<!--")) {
+            skipComment(p, end, line);
+        } else if (startsWith(p, end, "</")) {
+            start = (p += 2);
+            while (p != end && *p != '>')
+                if (*p++ == '\n') line++;
+            if (p == end)
+                _parseError(mp_document, m_line_number,
+                    "reached end of file before element " + m_tag + " ended");
+
+            const char* name_end = p++;
+            while (name_end != start && isSpace(*(name_end-1)))
+                --name_end;
+            if (m_tag.compare(0, string::npos, start, name_end - start) != 0)
+                _parseError(mp_document, line,
+                    "expecting end-tag </" + m_tag + "> but instead found </" +
+                    string(start, name_end) + ">");
+            has_content = false;
+        } else {
+            m_children.push_back(XmlElement(this, mp_document));
+            m_children.back().parseElement(p, end, line);
+        }
     }
-    
+
     // If this element has children then force no value
     if (m_children.size() > 0)
         m_text.clear();
 
     // Add special end element
     m_children.push_back(XmlEndElement());
-        
-    return true;
+}
+
+//==============================================================================
+
+void XmlElement::setParents()
+{
+    for (int i = 0; i < int(m_children.size()) - 1; ++i) {
+        m_children[i].mp_parent = this;
+        m_children[i].setParents();
+    }
 }
 
 //==============================================================================
@@ -54,21 +54,6 @@ class XmlDocument;
  */
 class XmlElement
 {
-private:
-
-    enum ParseState {
-        initial,
-        el_name,
-        el_value,
-        child_name,
-        attributes,
-        att_name,
-        att_value,
-        comment,
-        comment_end_1,
-        comment_end_2,
-    };
-    
 public:
 
     typedef std::vector<XmlElement>::iterator iterator;
@@ -88,8 +73,9 @@ public:
         : mp_parent(NULL), mp_document(NULL), m_line_number(0)
     {
         int line = 0;
-        std::istringstream is(str);
-        parse(is, line);
+        const char* p = str.c_str();
+        parse(p, p + str.size(), line);
+        setParents();
     }
 
     XmlElement() :
@@ -269,6 +255,30 @@ public:
     }
     
     
+    /**
+     * Returns an iterator pointing to the first child element (starting from
+     * iter) which has the given tag and given attribute/value pair.  If no such
+     * child element exists, the iterator equals end().  The attribute values
+     * are compared in place, without copying them.
+     */
+    const_iterator findTagWithAttribute(
+        const std::string& tag, const std::string& attribute,
+        const std::string& value, const_iterator iter) const
+    {
+        iter = findTag(tag, iter);
+        while (iter != end()) {
+            std::map<std::string, std::string>::const_iterator att =
+                iter->m_attributes.find(attribute);
+            if (att == iter->m_attributes.end() ?
+                value.empty() : att->second == value)
+                break;
+
+            iter = findTag(tag, ++iter);
+        }
+
+        return iter;
+    }
+
     /**
      * Returns an iterator pointing to the first child element (starting from
      * iter) which has the given tag and given attribute/value pair.  If no such
@@ -284,7 +294,7 @@ public:
     template <typename T>
     bool getChildElementObject(const std::string& tag, T& object) const
     {
-        getChildElementObject(tag, object, begin());
+        return getChildElementObject(tag, object, begin());
     }
 
     template <typename T>
@@ -342,9 +352,30 @@ private:
     
 private:
 
-    bool parse(
-        std::istream &is, int &line, std::string name = "",
-        ParseState state = initial);
+    /**
+     * Parses the next top-level element in the character range [p, end),
+     * skipping leading white space, comments, and processing instructions.
+     * On return, p points past the element.  Returns false if no element was
+     * found before the end of the range.
+     */
+    bool parse(const char*& p, const char* const end, int& line);
+
+    /**
+     * Parses an element whose start-tag begins at p (which points to '<').
+     */
+    void parseElement(const char*& p, const char* const end, int& line);
+
+    /**
+     * Skips a comment starting at p (which points to "<!--").
+     */
+    void skipComment(const char*& p, const char* const end, int& line) const;
+
+    /**
+     * Points the parent of every descendant to the element which owns it.
+     * Needed once the tree is built since children are moved around while
+     * their parent vectors grow.
+     */
+    void setParents();
 
     XmlElement*                        mp_parent;
     XmlDocument*                       mp_document;
@@ -383,6 +414,18 @@ public:
     typedef std::vector<XmlElement>::const_iterator const_iterator;
 
     XmlDocument(const std::string &filename);
+
+    /**
+     * Parses the contents of a file which were read beforehand, for instance
+     * with readFile().  The file name is only used in error messages.
+     */
+    XmlDocument(const std::string& filename, const std::string& contents);
+
+    /**
+     * Returns the contents of the given file, or throws a FileNotFoundError
+     * if it cannot be opened.
+     */
+    static std::string readFile(const std::string& filename);
     
     XmlElement &root() {
         return m_elements[0];
@@ -404,6 +447,8 @@ public:
 
 private:
 
+    void parse(const std::string& buffer);
+
     const std::string       m_filename;
     std::vector<XmlElement> m_elements;
 };
@@ -0,0 +1,173 @@
+/*
+ * Copyright 2018 von Karman Institute for Fluid Dynamics (VKI)
+ *
+ * This file is part of MUlticomponent Thermodynamic And Transport
+ * properties for IONized gases in C++ (Mutation++) software package.
+ *
+ * Mutation++ is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as
+ * published by the Free Software Foundation, either version 3 of the
+ * License, or (at your option) any later version.
+ *
+ * Mutation++ is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with Mutation++.  If not, see
+ * <http://www.gnu.org/licenses/>.
+ */
+
+#include "mutation++.h"
+#include "TemporaryFile.h"
+#include <catch/catch.hpp>
+
+#include <algorithm>
+#include <fstream>
+#include <vector>
+
+using namespace Mutation;
+using namespace Mutation::Thermodynamics;
+using namespace Mutation::Utilities::IO;
+using namespace Catch;
+
+/**
+ * Returns the options of a carbon-air mixture with solid graphite.
+ */
+MixtureOptions carbonAirOptions()
+{
+    MixtureOptions opts;
+    opts.setSpeciesDescriptor("C(gr) N2 O2 N O NO CO CO2 CN C C2 C3");
+    opts.setThermodynamicDatabase("NASA-9");
+    return opts;
+}
+
+/**
+ * Checks that the tabulated solutions of the surface mass balance match the
+ * direct solution, and that they are interpolated exactly at the table nodes.
+ */
+TEST_CASE
+(
+    "Surface mass balance solutions are tabulated in B' tables",
+    "[thermodynamics]"
+)
+{
+    Mixture mix(carbonAirOptions());
+    Mixture cold(carbonAirOptions());
+    const int ns = mix.nSpecies();
+
+    std::vector<double> Yke(mix.nElements(), 0.0);
+    std::vector<double> Ykg(mix.nElements(), 0.0);
+    Yke[mix.elementIndex("N")] = 0.767;
+    Yke[mix.elementIndex("O")] = 0.233;
+    Ykg[mix.elementIndex("C")] = 0.4;
+    Ykg[mix.elementIndex("O")] = 0.6;
+
+    std::vector<double> T, P, Bg;
+    for (int i = 0; i < 13; ++i)
+        T.push_back(1000.0 + 250.0*i);
+    P.push_back(1000.0);
+    P.push_back(10000.0);
+    Bg.push_back(0.0);
+    Bg.push_back(1.0);
+
+    BprimeTable table(mix, T, P, Bg);
+    for (int ib = 0; ib < Bg.size(); ++ib)
+        for (int ip = 0; ip < P.size(); ++ip)
+            table.compute(mix, Yke.data(), Ykg.data(), ip, ib);
+
+    CHECK(!mix.equilSolver()->warmStart());
+
+    // Warm-started lines give the same solution as cold starts
+    std::vector<double> Xw(ns);
+    double Bc, hw;
+    for (int ib = 0; ib < Bg.size(); ++ib) {
+        for (int ip = 0; ip < P.size(); ++ip) {
+            for (int it = 0; it < T.size(); ++it) {
+                cold.surfaceMassBalance(
+                    Yke.data(), Ykg.data(), T[it], P[ip], Bg[ib], Bc, hw,
+                    Xw.data());
+                CHECK(table.Bc(it, ip, ib) == Approx(Bc).epsilon(1.0e-6));
+                CHECK(table.hw(it, ip, ib) ==
+                    Approx(hw).epsilon(1.0e-6).margin(1.0));
+                for (int i = 0; i < ns; ++i)
+                    CHECK(table.Xw(it, ip, ib)[i] ==
+                        Approx(Xw[i]).epsilon(1.0e-6).margin(1.0e-12));
+            }
+        }
+    }
+
+    // Round trip through a file
+    TemporaryFile file(".bprime");
+    file.close();
+    table.save(file.filename());
+    BprimeTable loaded(file.filename());
+
+    REQUIRE(loaded.nTemperatures() == T.size());
+    REQUIRE(loaded.nPressures() == P.size());
+    REQUIRE(loaded.nBlowingRates() == Bg.size());
+    REQUIRE(loaded.nSpecies() == ns);
+    for (int i = 0; i < ns; ++i)
+        CHECK(loaded.speciesName(i) == mix.speciesName(i));
+    CHECK(loaded.Bc(5, 1, 1) == table.Bc(5, 1, 1));
+    CHECK(loaded.Xw(7, 0, 1)[3] == table.Xw(7, 0, 1)[3]);
+
+    // Both schemes are exact at the nodes
+    for (int it = 0; it < T.size(); ++it) {
+        loaded.lookup(T[it], P[1], Bg[0], Bc, hw, Xw.data());
+        CHECK(Bc == Approx(table.Bc(it, 1, 0)));
+        CHECK(hw == Approx(table.hw(it, 1, 0)));
+        CHECK(Xw[1] == Approx(table.Xw(it, 1, 0)[1]));
+
+        loaded.lookup(
+            T[it], P[0], Bg[1], Bc, hw, NULL, BprimeTable::MONOTONE_CUBIC);
+        CHECK(Bc == Approx(table.Bc(it, 0, 1)));
+        CHECK(hw == Approx(table.hw(it, 0, 1)));
+    }
+
+    // Monotone cubic interpolation stays within the neighboring values
+    for (int it = 0; it < T.size()-1; ++it) {
+        loaded.lookup(
+            0.5*(T[it]+T[it+1]), P[0], Bg[0], Bc, hw, Xw.data(),
+            BprimeTable::MONOTONE_CUBIC);
+        const double Bc0 = table.Bc(it, 0, 0);
+        const double Bc1 = table.Bc(it+1, 0, 0);
+        CHECK(Bc >= std::min(Bc0, Bc1) - 1.0e-12);
+        CHECK(Bc <= std::max(Bc0, Bc1) + 1.0e-12);
+        for (int i = 0; i < ns; ++i)
+            CHECK(Xw[i] >= -1.0e-12);
+    }
+
+    // Values are clamped outside of the table
+    loaded.lookup(100.0, 1.0, -1.0, Bc, hw);
+    CHECK(Bc == Approx(table.Bc(0, 0, 0)));
+    loaded.lookup(1.0e5, 1.0e6, 10.0, Bc, hw);
+    CHECK(Bc == Approx(table.Bc(T.size()-1, 1, 1)));
+
+    // Linear in ln(p) between the pressures
+    double Bc0, Bc1, hw0, hw1;
+    loaded.lookup(T[4], P[0], Bg[1], Bc0, hw0);
+    loaded.lookup(T[4], P[1], Bg[1], Bc1, hw1);
+    loaded.lookup(T[4], std::sqrt(P[0]*P[1]), Bg[1], Bc, hw);
+    CHECK(Bc == Approx(0.5*(Bc0 + Bc1)));
+    CHECK(hw == Approx(0.5*(hw0 + hw1)));
+
+    CHECK_THROWS_AS(BprimeTable("missing.bprime"), FileNotFoundError);
+
+    // Grid sizes which do not fit in the file are rejected before allocating
+    // the table
+    const int bad_sizes[][4] = {
+        { int(T.size()), int(P.size()), 0, ns },
+        { int(T.size()), int(P.size()), int(Bg.size()), -1 },
+        { 100000, 100000, 100000, ns }
+    };
+    for (int i = 0; i < 3; ++i) {
+        std::fstream f(file.filename().c_str(),
+            std::ios::in | std::ios::out | std::ios::binary);
+        f.seekp(8 + sizeof(int));
+        f.write(reinterpret_cast<const char*>(bad_sizes[i]), 4*sizeof(int));
+        f.close();
+        CHECK_THROWS_AS(BprimeTable(file.filename()), FileParseError);
+    }
+}
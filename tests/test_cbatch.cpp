@@ -0,0 +1,109 @@
+/*
+ * Copyright 2018 von Karman Institute for Fluid Dynamics (VKI)
+ *
+ * This file is part of MUlticomponent Thermodynamic And Transport
+ * properties for IONized gases in C++ (Mutation++) software package.
+ *
+ * Mutation++ is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as
+ * published by the Free Software Foundation, either version 3 of the
+ * License, or (at your option) any later version.
+ *
+ * Mutation++ is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with Mutation++.  If not, see
+ * <http://www.gnu.org/licenses/>.
+ */
+
+#include "mutation++.h"
+#include "cbatch.h"
+#include <catch/catch.hpp>
+
+#include <cmath>
+#include <string>
+#include <vector>
+
+using namespace Mutation;
+using namespace Catch;
+
+TEST_CASE("mpp_batch functions evaluate strided arrays of states",
+    "[cbatch]")
+{
+    mpp_batch* p_batch = mpp_batch_create("air_5", "ChemNonEq1T", 2);
+    REQUIRE(p_batch != NULL);
+
+    MixtureOptions opts("air_5");
+    opts.setStateModel("ChemNonEq1T");
+    Mixture mix(opts);
+
+    const int ns = mix.nSpecies();
+    REQUIRE(mpp_batch_nspecies(p_batch) == ns);
+    REQUIRE(mpp_batch_ninputs(p_batch) == ns + 1);
+    for (int i = 0; i < ns; ++i)
+        CHECK(mpp_batch_species_name(p_batch, i) == mix.speciesName(i));
+    CHECK(mpp_batch_species_name(p_batch, ns) == NULL);
+
+    SECTION("Column ordered states give the same values as the mixture") {
+        // States stored column by column, as a Fortran or NumPy F array
+        const int n = 100;
+        std::vector<double> states((ns+1)*n, 0.0);
+        for (int i = 0; i < n; ++i) {
+            states[mix.speciesIndex("N2")*n + i] = 0.0767 - 0.0003*i;
+            states[mix.speciesIndex("O2")*n + i] = 0.0233;
+            states[mix.speciesIndex("N")*n + i]  = 0.0003*i;
+            states[ns*n + i] = 1000.0 + 50.0*i;
+        }
+
+        const char* list = "T,mu,omega";
+        const int nv = mpp_batch_nvalues(p_batch, list);
+        REQUIRE(nv == 2 + ns);
+
+        // Every other row of a larger output array
+        std::vector<double> values(2*n*nv, -1.0);
+        REQUIRE(mpp_batch_evaluate(
+            p_batch, list, 1, n, &states[0], 1, n, &values[0], 2*nv, 1) == 0);
+
+        std::vector<double> rhoi(ns), wdot(ns);
+        for (int i = 0; i < n; ++i) {
+            for (int k = 0; k < ns; ++k)
+                rhoi[k] = states[k*n + i];
+            mix.setState(&rhoi[0], &states[ns*n + i], 1);
+            mix.netProductionRates(&wdot[0]);
+
+            const double* const p_row = &values[2*i*nv];
+            CHECK(p_row[0] == Approx(mix.T()));
+            CHECK(p_row[1] == Approx(mix.viscosity()));
+            for (int k = 0; k < ns; ++k)
+                CHECK(p_row[2+k] == Approx(wdot[k]).margin(1.0e-10));
+            CHECK(p_row[nv] == -1.0);
+        }
+    }
+
+    SECTION("Unknown properties are reported") {
+        double state, value;
+        CHECK(mpp_batch_nvalues(p_batch, "T,foo") == -1);
+        CHECK(mpp_batch_evaluate(
+            p_batch, "foo", 1, 1, &state, 1, 1, &value, 1, 1) == -1);
+        CHECK(std::string(mpp_batch_error()).find("foo") != std::string::npos);
+    }
+
+    SECTION("Equilibrium compositions match the mixture") {
+        const double T[] = { 2000.0, 4000.0, 6000.0 };
+        const double P = ONEATM;
+        std::vector<double> X(3*ns);
+        REQUIRE(mpp_batch_equilibrate(
+            p_batch, 3, T, 1, &P, 0, &X[0], ns, 1) == 0);
+
+        for (int i = 0; i < 3; ++i) {
+            mix.equilibrate(T[i], P);
+            for (int k = 0; k < ns; ++k)
+                CHECK(X[i*ns+k] == Approx(mix.X()[k]).margin(1.0e-12));
+        }
+    }
+
+    mpp_batch_destroy(p_batch);
+}
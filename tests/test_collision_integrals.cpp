@@ -23,6 +23,14 @@
 #include <catch/catch.hpp>
 #include <eigen3/Eigen/Dense>
 
+#include <algorithm>
+#include <cstdio>
+#include <fstream>
+#include <sstream>
+#include <dirent.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
 using namespace Mutation;
 using namespace Mutation::Thermodynamics;
 using namespace Mutation::Transport;
@@ -526,3 +534,134 @@ TEST_CASE
     // Check that indeed the value is given
     CHECK(Q11->compute(1000.0) == 10.0);
 }
+
+/**
+ * Checks that collision integrals cached between state changes are updated
+ * whenever the state changes, and that the cached electron-heavy collision
+ * frequencies are consistent with the electron mean free path.
+ */
+TEST_CASE
+(
+    "Cached collision integrals follow the mixture state",
+    "[transport]"
+)
+{
+    Mixture mix("air_11");
+    CollisionDB& collisions = mix.collisionDB();
+
+    mix.equilibrate(10000.0, ONEATM);
+    const ArrayXd Q11_1 = collisions.Q11ei();
+
+    // A second call at the same state returns the same values
+    CHECK((collisions.Q11ei() == Q11_1).all());
+
+    // Changing the electron density changes the Coulomb integrals
+    mix.equilibrate(10000.0, 0.1*ONEATM);
+    const ArrayXd Q11_2 = collisions.Q11ei();
+    CHECK((Q11_2 != Q11_1).any());
+
+    // Returning to the first state restores the original values
+    mix.equilibrate(10000.0, ONEATM);
+    for (int i = 0; i < Q11_1.size(); ++i)
+        CHECK(collisions.Q11ei()(i) == Approx(Q11_1(i)));
+
+    CHECK(mix.electronHeavyCollisionFreq() == Approx(
+        mix.electronThermalSpeed()/mix.electronMeanFreePath()));
+}
+
+/**
+ * Returns the inode numbers of the files in the given directory.
+ */
+std::vector<ino_t> fileInodes(const std::string& dir)
+{
+    std::vector<ino_t> inodes;
+    DIR* p_dir = opendir(dir.c_str());
+    if (p_dir == NULL)
+        return inodes;
+
+    struct dirent* p_entry;
+    while ((p_entry = readdir(p_dir)) != NULL) {
+        struct stat st;
+        const std::string path = dir + "/" + p_entry->d_name;
+        if (stat(path.c_str(), &st) == 0 && S_ISREG(st.st_mode))
+            inodes.push_back(st.st_ino);
+    }
+    closedir(p_dir);
+
+    std::sort(inodes.begin(), inodes.end());
+    return inodes;
+}
+
+/**
+ * Returns the viscosity and thermal conductivity of air_11 in equilibrium.
+ */
+Vector2d airTransport()
+{
+    Mixture mix("air_11");
+    mix.equilibrate(8000.0, ONEATM);
+    return Vector2d(mix.viscosity(), mix.equilibriumThermalConductivity());
+}
+
+/**
+ * Checks that tabulated collision integrals are prebuilt when requested, that
+ * the tables are written to the table cache, and that later mixtures reload
+ * them from the cache.
+ */
+TEST_CASE
+(
+    "Collision integral tables are prebuilt and cached",
+    "[transport]"
+)
+{
+    // Work with a copy of the database which tabulates all integrals upfront
+    const std::string dir = "collision-table-cache";
+    const std::string cache = dir + "/cache";
+    mkdir(dir.c_str(), 0755);
+
+    IO::DataFileStream file(databaseFileName("collisions", "transport"));
+    std::stringstream ss;
+    ss << file.rdbuf();
+    std::string xml = ss.str();
+    const std::string option =
+        "<!--<tabulate Tmin=\"100\" Tmax=\"50000\" dT=\"100\" />-->";
+    REQUIRE(xml.find(option) != std::string::npos);
+    xml.replace(xml.find(option), option.size(),
+        "<tabulate Tmin=\"100\" Tmax=\"50000\" dT=\"100\" prebuild=\"true\"/>");
+    std::ofstream((dir + "/collisions.xml").c_str()) << xml;
+
+    GlobalOptions::workingDirectory(dir);
+    GlobalOptions::tableCache("");
+
+    // Reference values computed without the cache
+    const Vector2d ref = airTransport();
+    CHECK(fileInodes(cache).empty());
+
+    {
+        Mixture mix("air_11");
+        CHECK(mix.collisionDB().tabulate() > 0);
+    }
+
+    // The first mixture fills the cache with identical tables
+    GlobalOptions::tableCache(cache);
+    CHECK(airTransport() == ref);
+    const std::vector<ino_t> files = fileInodes(cache);
+    CHECK(files.size() > 0);
+
+    // The next ones reload them instead of writing new files
+    CHECK(airTransport() == ref);
+    CHECK(fileInodes(cache) == files);
+
+    // Clean up
+    DIR* p_dir = opendir(cache.c_str());
+    struct dirent* p_entry;
+    while (p_dir != NULL && (p_entry = readdir(p_dir)) != NULL)
+        std::remove((cache + "/" + p_entry->d_name).c_str());
+    if (p_dir != NULL)
+        closedir(p_dir);
+    rmdir(cache.c_str());
+    std::remove((dir + "/collisions.xml").c_str());
+    rmdir(dir.c_str());
+
+    GlobalOptions::workingDirectory("");
+    GlobalOptions::tableCache("");
+}
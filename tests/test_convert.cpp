@@ -76,3 +76,64 @@ TEST_CASE
         )
     )
 }
+
+TEST_CASE
+(
+    "Fused density conversions match the single conversions",
+    "[thermodynamic]"
+)
+{
+    MIXTURE_LOOP
+    (
+        const int ns = mix.nSpecies();
+        const int ne = mix.nElements();
+
+        // Two states: the equilibrium state and the same one at twice the
+        // density, which has the same fractions
+        Eigen::VectorXd rhoi(2*ns);
+        Eigen::VectorXd X(2*ns);
+        Eigen::VectorXd Y(2*ns);
+        Eigen::VectorXd C(2*ns);
+        Eigen::VectorXd Xe(2*ne);
+        Eigen::VectorXd ref(ns);
+        Eigen::VectorXd ref_e(ne);
+
+        EQUILIBRATE_LOOP
+        (
+            mix.densities(rhoi.data());
+            rhoi.tail(ns) = 2.0*rhoi.head(ns);
+
+            mix.convertDensities(
+                rhoi.data(), X.data(), Y.data(), C.data(), Xe.data(), 2);
+
+            for (int s = 0; s < 2; ++s) {
+                const double* const p_rho = rhoi.data() + s*ns;
+
+                mix.convert<Mutation::Thermodynamics::RHO_TO_CONC>(
+                    p_rho, ref.data());
+                CHECK(C.segment(s*ns, ns) == ref);
+
+                mix.convert<Mutation::Thermodynamics::RHO_TO_X>(
+                    p_rho, ref.data());
+                CHECK(X.segment(s*ns, ns) == ref);
+                CHECK(X.segment(s*ns, ns).isApprox(
+                    Map<const VectorXd>(mix.X(), ns)));
+
+                mix.convert<Mutation::Thermodynamics::RHO_TO_Y>(
+                    p_rho, ref.data());
+                CHECK(Y.segment(s*ns, ns) == ref);
+                CHECK(Y.segment(s*ns, ns).isApprox(
+                    Map<const VectorXd>(mix.Y(), ns)));
+
+                mix.convert<Mutation::Thermodynamics::X_TO_XE>(
+                    X.data() + s*ns, ref_e.data());
+                CHECK(Xe.segment(s*ne, ne) == ref_e);
+            }
+
+            // The sparse element sums match the dense element matrix
+            mix.elementMoles(rhoi.data(), ref_e.data());
+            CHECK(ref_e.isApprox(
+                mix.elementMatrix().transpose()*rhoi.head(ns)));
+        )
+    )
+}
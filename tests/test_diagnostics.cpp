@@ -0,0 +1,122 @@
+/*
+ * Copyright 2018 von Karman Institute for Fluid Dynamics (VKI)
+ *
+ * This file is part of MUlticomponent Thermodynamic And Transport
+ * properties for IONized gases in C++ (Mutation++) software package.
+ *
+ * Mutation++ is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as
+ * published by the Free Software Foundation, either version 3 of the
+ * License, or (at your option) any later version.
+ *
+ * Mutation++ is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with Mutation++.  If not, see
+ * <http://www.gnu.org/licenses/>.
+ */
+
+#include "mutation++.h"
+#include <catch/catch.hpp>
+
+#include <string>
+#include <vector>
+
+using namespace Mutation;
+using namespace Catch;
+
+/**
+ * Callback storing the messages it receives in a vector of strings.
+ */
+void storeMessage(
+    Diagnostics::Severity severity, Diagnostics::Event event,
+    const std::string& message, void* p_data)
+{
+    static_cast<std::vector<std::string>*>(p_data)->push_back(
+        std::string(Diagnostics::name(event)) + ": " + message);
+}
+
+/**
+ * Tests the counting, filtering and rate limiting of diagnostics messages.
+ */
+TEST_CASE
+(
+    "Diagnostics count events and limit messages",
+    "[diagnostics]"
+)
+{
+    std::vector<std::string> messages;
+    Diagnostics diagnostics;
+    diagnostics.setCallback(storeMessage, &messages);
+    diagnostics.setMessageLimit(2);
+
+    CHECK(diagnostics.total() == 0);
+    CHECK(diagnostics.last() == Diagnostics::NONE);
+
+    for (int i = 0; i < 5; ++i)
+        diagnostics.report(Diagnostics::TEMPERATURE_CLAMPED) << "T = " << i;
+
+    CHECK(diagnostics.count(Diagnostics::TEMPERATURE_CLAMPED) == 5);
+    CHECK(diagnostics.last() == Diagnostics::TEMPERATURE_CLAMPED);
+    REQUIRE(messages.size() == 2);
+    CHECK(messages[0] == "temperature-clamped: T = 0");
+    CHECK(messages[1] ==
+        "temperature-clamped: T = 1 (further messages of this type are "
+        "suppressed)");
+
+    // Events below the minimum severity are only counted
+    diagnostics.report(Diagnostics::NEWTON_NOT_CONVERGED) << "not written";
+    CHECK(diagnostics.count(Diagnostics::NEWTON_NOT_CONVERGED) == 1);
+    CHECK(diagnostics.total() == 6);
+    CHECK(messages.size() == 2);
+
+    diagnostics.setSeverity(Diagnostics::INFO);
+    diagnostics.report(Diagnostics::NEWTON_NOT_CONVERGED) << "written";
+    CHECK(messages.size() == 3);
+
+    diagnostics.setSeverity(Diagnostics::SILENT);
+    diagnostics.report(Diagnostics::MODEL_NOT_IMPLEMENTED);
+    CHECK(messages.size() == 3);
+
+    // Clearing the counters lets messages through again
+    diagnostics.clear();
+    diagnostics.setSeverity(Diagnostics::WARNING);
+    CHECK(diagnostics.total() == 0);
+    CHECK(diagnostics.count(Diagnostics::TEMPERATURE_CLAMPED) == 0);
+    diagnostics.report(Diagnostics::TEMPERATURE_CLAMPED) << "again";
+    CHECK(messages.size() == 4);
+}
+
+/**
+ * Checks that problems met while setting the state are reported to the
+ * diagnostics of the mixture rather than printed.
+ */
+TEST_CASE
+(
+    "Mixture reports unphysical states to its diagnostics",
+    "[diagnostics]"
+)
+{
+    std::vector<std::string> messages;
+    Mixture mix("air_5");
+    mix.diagnostics().setCallback(storeMessage, &messages);
+
+    // Energy far too low for the given densities
+    const double rhoi [] = { 0.0, 0.0, 0.0, 0.767, 0.233 };
+    const double rhoe = -1.0e10;
+    mix.setState(rhoi, &rhoe, 0);
+
+    CHECK(mix.T() == Approx(50.0));
+    CHECK(mix.diagnostics().count(Diagnostics::TEMPERATURE_CLAMPED) == 1);
+    CHECK(mix.diagnostics().last() == Diagnostics::TEMPERATURE_CLAMPED);
+    REQUIRE(messages.size() == 1);
+    CHECK(messages[0].find("temperature-clamped") == 0);
+
+    // A valid state adds nothing
+    mix.diagnostics().clear();
+    mix.equilibrate(3000.0, ONEATM);
+    CHECK(mix.diagnostics().total() == 0);
+}
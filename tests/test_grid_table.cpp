@@ -0,0 +1,188 @@
+/*
+ * Copyright 2018 von Karman Institute for Fluid Dynamics (VKI)
+ *
+ * This file is part of MUlticomponent Thermodynamic And Transport
+ * properties for IONized gases in C++ (Mutation++) software package.
+ *
+ * Mutation++ is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as
+ * published by the Free Software Foundation, either version 3 of the
+ * License, or (at your option) any later version.
+ *
+ * Mutation++ is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with Mutation++.  If not, see
+ * <http://www.gnu.org/licenses/>.
+ */
+
+
+#include "mutation++.h"
+#include "GridTable.h"
+#include "TemporaryFile.h"
+#include <catch/catch.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
+using namespace Mutation;
+using namespace Mutation::Utilities;
+using namespace Mutation::Utilities::IO;
+using namespace Catch;
+
+/**
+ * Fills the table with the two functions f(x) computes at each node.
+ */
+template <typename Function>
+void fillGrid(GridTable& table, Function f)
+{
+    std::vector<double> x(table.nAxes());
+    for (int n = 0; n < table.nNodes(); ++n) {
+        table.nodeCoordinates(n, &x[0]);
+        f(&x[0], table.values(n));
+    }
+}
+
+/**
+ * A multilinear and a quadratic function of the node coordinates of the axes
+ * (x, ln(y), z).
+ */
+void multilinear(const double* const p_x, double* const p_f)
+{
+    const double lny = std::log(p_x[1]);
+    p_f[0] = 1.0 + 2.0*p_x[0] - 0.5*lny + 3.0*p_x[2] + p_x[0]*lny*p_x[2];
+    p_f[1] = 2.0 + lny + p_x[0]*p_x[0];
+}
+
+/**
+ * Checks the interpolation schemes, batch lookups and file format of grid
+ * tables.
+ */
+TEST_CASE
+(
+    "Grid tables interpolate functions of up to three variables",
+    "[utilities]"
+)
+{
+    std::vector<GridAxis> axes;
+    axes.push_back(GridAxis(0.0, 2.0, 9));
+    axes.push_back(GridAxis(10.0, 1000.0, 11, GridAxis::LOGARITHMIC));
+    axes.push_back(GridAxis(-1.0, 1.0, 5));
+
+    GridTable table(axes, 2);
+    fillGrid(table, multilinear);
+
+    REQUIRE(table.nNodes() == 9*11*5);
+    CHECK(table.axis(1).node(0) == 10.0);
+    CHECK(table.axis(1).node(10) == 1000.0);
+    CHECK(table.axis(1).node(5) == Approx(100.0));
+
+    double f[2], exact[2];
+
+    SECTION("Multilinear functions are exact with linear interpolation") {
+        const double x[3] = { 0.3, 37.0, 0.71 };
+        table.lookup<GridLinear>(x, f);
+        multilinear(x, exact);
+        CHECK(f[0] == Approx(exact[0]));
+        CHECK(f[1] == Approx(exact[1]).epsilon(5.0e-3));
+    }
+
+    SECTION("Cubic schemes reproduce quadratics away from the ends") {
+        const double x[3] = { 0.8, 55.0, 0.1 };
+        multilinear(x, exact);
+        table.lookup<GridCubic>(x, f);
+        CHECK(f[1] == Approx(exact[1]));
+        table.lookup<GridMonotoneCubic>(x, f);
+        CHECK(f[1] == Approx(exact[1]).epsilon(1.0e-3));
+    }
+
+    SECTION("Points outside of the grid are clamped") {
+        const double x[3] = { -1.0, 1.0, 5.0 };
+        const double y[3] = { 0.0, 10.0, 1.0 };
+        table.lookup<GridCubic>(x, f);
+        multilinear(y, exact);
+        CHECK(f[0] == Approx(exact[0]));
+        CHECK(f[1] == Approx(exact[1]));
+    }
+
+    SECTION("Batch lookups give the same values as single lookups") {
+        const int n = 20;
+        std::vector<double> x(3*n), values(2*n);
+        for (int i = 0; i < n; ++i) {
+            x[3*i]   = 0.1*i;
+            x[3*i+1] = 10.0 + 49.0*i;
+            x[3*i+2] = -1.0 + 0.1*i;
+        }
+        table.lookup<GridMonotoneCubic>(&x[0], n, &values[0]);
+        for (int i = 0; i < n; ++i) {
+            table.lookup<GridMonotoneCubic>(&x[3*i], f);
+            CHECK(values[2*i] == f[0]);
+            CHECK(values[2*i+1] == f[1]);
+        }
+    }
+
+    SECTION("Tables are mapped from binary files") {
+        TemporaryFile file(".grid");
+        file.close();
+        table.save(file.filename());
+
+        const GridTable loaded(file.filename());
+        REQUIRE(loaded.nAxes() == 3);
+        REQUIRE(loaded.nFunctions() == 2);
+        CHECK(loaded.axis(1).spacing() == GridAxis::LOGARITHMIC);
+        CHECK(loaded.axis(2).min() == -1.0);
+        for (int n = 0; n < table.nNodes(); n += 7)
+            CHECK(loaded.values(n)[0] == table.values(n)[0]);
+
+        const double x[3] = { 1.3, 420.0, -0.2 };
+        double g[2];
+        table.lookup<GridCubic>(x, f);
+        loaded.lookup<GridCubic>(x, g);
+        CHECK(f[0] == g[0]);
+        CHECK(f[1] == g[1]);
+
+        CHECK_THROWS_AS(GridTable("missing.grid"), FileNotFoundError);
+    }
+}
+
+/**
+ * Checks that the monotone scheme does not overshoot steep data.
+ */
+TEST_CASE
+(
+    "Monotone grid interpolation does not overshoot",
+    "[utilities]"
+)
+{
+    std::vector<GridAxis> axes(1, GridAxis(0.0, 10.0, 11));
+    GridTable table(axes, 1);
+    for (int i = 0; i < 11; ++i)
+        table.values(i)[0] = (i < 5 ? 0.0 : 1.0);
+
+    // Needs enough nodes for the stencil
+    std::vector<GridAxis> small(1, GridAxis(0.0, 1.0, 3));
+    GridTable small_table(small, 1);
+    const double x0 = 0.5;
+    double f;
+    CHECK_THROWS_AS(
+        small_table.lookup<GridCubic>(&x0, &f), InvalidInputError);
+    small_table.lookup<GridLinear>(&x0, &f);
+
+    double fmin = 1.0, fmax = 0.0, fcubic_max = 0.0;
+    for (int i = 0; i <= 1000; ++i) {
+        const double x = 0.01*i;
+        table.lookup<GridMonotoneCubic>(&x, &f);
+        fmin = std::min(fmin, f);
+        fmax = std::max(fmax, f);
+        table.lookup<GridCubic>(&x, &f);
+        fcubic_max = std::max(fcubic_max, f);
+    }
+
+    CHECK(fmin == 0.0);
+    CHECK(fmax == 1.0);
+    CHECK(fcubic_max > 1.0);
+}
@@ -0,0 +1,100 @@
+/*
+ * Copyright 2018 von Karman Institute for Fluid Dynamics (VKI)
+ *
+ * This file is part of MUlticomponent Thermodynamic And Transport
+ * properties for IONized gases in C++ (Mutation++) software package.
+ *
+ * Mutation++ is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as
+ * published by the Free Software Foundation, either version 3 of the
+ * License, or (at your option) any later version.
+ *
+ * Mutation++ is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with Mutation++.  If not, see
+ * <http://www.gnu.org/licenses/>.
+ */
+
+
+#include "mutation++.h"
+#include "Interpolators.h"
+#include <catch/catch.hpp>
+
+#include <cmath>
+#include <vector>
+
+using namespace Mutation::Numerics;
+using namespace Catch;
+
+/**
+ * Fills a table of a collision integral-like function on a logarithmic
+ * temperature grid.
+ */
+void fillTable(std::vector<double>& x, std::vector<double>& y, double scale)
+{
+    x.resize(25);
+    y.resize(25);
+    for (int i = 0; i < 25; ++i) {
+        x[i] = 300.0*std::pow(20000.0/300.0, i/24.0);
+        y[i] = scale*std::pow(x[i], -0.25)*std::exp(200.0/x[i]);
+    }
+}
+
+/**
+ * Checks the barycentric evaluation of the Chebyshev interpolator against
+ * values of the Lagrange form it replaces, and the batched evaluations.
+ */
+TEST_CASE
+(
+    "Interpolators evaluate tabulated functions",
+    "[numerics]"
+)
+{
+    std::vector<double> x, y1, y2;
+    fillTable(x, y1, 5.0);
+    fillTable(x, y2, 2.0);
+
+    const ChebyshevInterpolator<double> cheb1(
+        Interpolator<double>::ARGS(&x[0], &y1[0], x.size()));
+    const ChebyshevInterpolator<double> cheb2(
+        Interpolator<double>::ARGS(&x[0], &y2[0], x.size()));
+
+    // Values of the previous O(n^2) Lagrange evaluation
+    const int nt = 8;
+    const double T[nt] = {
+        300.0, 450.0, 1000.0, 2500.0, 6000.0, 10150.0, 14000.0, 19999.0 };
+    const double Q[nt] = {
+        2.3400187927724927, 1.7040584593538819, 1.0907131951931008,
+        0.770102519921124, 0.5936549924703165, 0.5064825527996466,
+        0.47284014601138669, 0.42466881040293214 };
+
+    for (int i = 0; i < nt; ++i)
+        CHECK(cheb1(T[i]) == Approx(Q[i]).epsilon(1.0e-12));
+
+    // Many x values at once
+    std::vector<double> values(nt);
+    cheb1.evaluate(T, &values[0], nt);
+    for (int i = 0; i < nt; ++i)
+        CHECK(values[i] == cheb1(T[i]));
+
+    // Many interpolants on the same grid share the basis
+    std::vector<double> phi(cheb1.nPoints());
+    for (int i = 0; i < nt; ++i) {
+        cheb1.basis(T[i], &phi[0]);
+        CHECK(cheb1.interpolate(&phi[0]) == Approx(cheb1(T[i])));
+        CHECK(cheb2.interpolate(&phi[0]) == Approx(cheb2(T[i])));
+        CHECK(cheb2(T[i]) == Approx(0.4*Q[i]).epsilon(1.0e-12));
+    }
+
+    // The default batched evaluation of other interpolators
+    const MCHInterpolator<double> mch(
+        Interpolator<double>::ARGS(&x[0], &y1[0], x.size()));
+    mch.evaluate(T, &values[0], nt);
+    for (int i = 0; i < nt; ++i)
+        CHECK(values[i] == mch(T[i]));
+    CHECK(values[0] == y1[0]);
+}
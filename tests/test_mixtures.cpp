@@ -22,8 +22,12 @@
 #include <catch/catch.hpp>
 #include "mutation++.h"
 #include "Configuration.h"
+#include "TemporaryFile.h"
 
+#include <cmath>
 #include <memory>
+#include <thread>
+#include <vector>
 
 using namespace Catch;
 using namespace Mutation;
@@ -198,3 +202,125 @@ TEST_CASE("Loading tacot-air_35 mixture", "[loading][mixtures]")
 {
     checkLoadMixture("tacot-air_35", 35, 4, 0);
 }
+
+void loadSubsystems(Mixture* p_mix, int* p_pairs, int* p_reactions)
+{
+    *p_pairs = p_mix->nCollisionPairs();
+    *p_reactions = p_mix->nReactions();
+}
+
+void loadRateCoefficient(Mixture* p_mix, double* p_kf)
+{
+    p_mix->forwardRateCoefficients(p_kf);
+}
+
+// Optional subsystems are only loaded when they are used
+TEST_CASE("Mixture subsystems are loaded on first use", "[loading][mixtures]")
+{
+    // Temporary mechanisms are written in the current directory
+    GlobalOptions::workingDirectory("");
+
+    SECTION("Equilibrium does not need transport") {
+        MixtureOptions opts("air_11");
+        opts.setLoadTransport(false);
+        Mixture mix(opts);
+
+        std::vector<double> X(mix.nSpecies());
+        mix.equilibriumComposition(3000.0, ONEATM, &X[0]);
+        mix.equilibrate(3000.0, ONEATM);
+        CHECK(mix.density() > 0.0);
+        CHECK(mix.nReactions() == 22);
+
+        CHECK_THROWS_AS(mix.viscosity(), LogicError);
+        CHECK_THROWS_AS(mix.nCollisionPairs(), LogicError);
+        CHECK_THROWS_AS(mix.solveSurfaceBalance(), LogicError);
+    }
+
+    SECTION("Unknown algorithms are still found by the constructor") {
+        MixtureOptions opts("air_11");
+        opts.setViscosityAlgorithm("unknown");
+        CHECK_THROWS_AS(delete new Mixture(opts), InvalidInputError);
+    }
+
+    SECTION("Mechanism errors are thrown on every use") {
+        MixtureOptions opts("air_11");
+        opts.setMechanism("missing");
+        CHECK_THROWS_AS(delete new Mixture(opts), FileNotFoundError);
+
+        // The file is read by the constructor but only parsed on first use
+        SharedPtr<Mixture> mix;
+        {
+            Utilities::IO::TemporaryFile mech(".xml");
+            mech << "<reactions>\n</reactions>\n";
+            mech.close();
+            opts.setMechanism(mech.filename());
+            mix = SharedPtr<Mixture>(new Mixture(opts));
+        }
+        CHECK(mix->nSpecies() == 11);
+        CHECK_THROWS_AS(mix->nReactions(), FileParseError);
+        CHECK_THROWS_AS(mix->nReactions(), FileParseError);
+    }
+
+    SECTION("Subsystems are loaded once by concurrent threads") {
+        Mixture mix("air_11");
+        const int nthreads = 4;
+        std::vector<int> pairs(nthreads, 0), reactions(nthreads, 0);
+        std::vector<std::thread> threads;
+        for (int i = 0; i < nthreads; ++i)
+            threads.push_back(std::thread(
+                loadSubsystems, &mix, &pairs[i], &reactions[i]));
+        for (int i = 0; i < nthreads; ++i)
+            threads[i].join();
+
+        for (int i = 0; i < nthreads; ++i) {
+            CHECK(pairs[i] == 66);
+            CHECK(reactions[i] == 22);
+        }
+    }
+
+    SECTION("Mechanisms with different units are loaded concurrently") {
+        // The same rate constant given in cm and in the default SI units
+        Utilities::IO::TemporaryFile cgs(".xml"), si(".xml");
+        cgs << "<mechanism name=\"cgs\">\n"
+            << "  <arrhenius_units A=\"mol,cm,s,K\" E=\"kcal,mol,K\" />\n"
+            << "  <reaction formula=\"N2+O=NO+N\">\n"
+            << "    <arrhenius A=\"6.4E+11\" n=\"1.0\" T=\"38400.\" />\n"
+            << "  </reaction>\n</mechanism>\n";
+        cgs.close();
+        si << "<mechanism name=\"si\">\n"
+           << "  <reaction formula=\"N2+O=NO+N\">\n"
+           << "    <arrhenius A=\"6.4E+05\" n=\"1.0\" T=\"38400.\" />\n"
+           << "  </reaction>\n</mechanism>\n";
+        si.close();
+
+        const int nmix = 8;
+        std::vector<SharedPtr<Mixture> > mixtures;
+        for (int i = 0; i < nmix; ++i) {
+            MixtureOptions opts("air_11");
+            opts.setMechanism(i % 2 == 0 ? cgs.filename() : si.filename());
+            mixtures.push_back(SharedPtr<Mixture>(new Mixture(opts)));
+            mixtures.back()->equilibrate(5000.0, ONEATM);
+        }
+
+        std::vector<double> kf(nmix, 0.0);
+        std::vector<std::thread> threads;
+        for (int i = 0; i < nmix; ++i)
+            threads.push_back(std::thread(
+                loadRateCoefficient, &(*mixtures[i]), &kf[i]));
+        for (int i = 0; i < nmix; ++i)
+            threads[i].join();
+
+        const double expected = 6.4E+05 * 5000.0 * std::exp(-38400.0/5000.0);
+        for (int i = 0; i < nmix; ++i)
+            CHECK(kf[i] == Approx(expected));
+
+        // Units do not leak into mechanisms loaded afterwards
+        MixtureOptions opts("air_11");
+        opts.setMechanism(si.filename());
+        Mixture mix(opts);
+        mix.equilibrate(5000.0, ONEATM);
+        double k;
+        mix.forwardRateCoefficients(&k);
+        CHECK(k == Approx(expected));
+    }
+}
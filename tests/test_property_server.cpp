@@ -0,0 +1,178 @@
+/*
+ * Copyright 2018 von Karman Institute for Fluid Dynamics (VKI)
+ *
+ * This file is part of MUlticomponent Thermodynamic And Transport
+ * properties for IONized gases in C++ (Mutation++) software package.
+ *
+ * Mutation++ is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as
+ * published by the Free Software Foundation, either version 3 of the
+ * License, or (at your option) any later version.
+ *
+ * Mutation++ is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with Mutation++.  If not, see
+ * <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef _WIN32
+
+#include "mutation++.h"
+#include "PropertyClient.h"
+#include "PropertyServer.h"
+#include <catch/catch.hpp>
+
+#include <sstream>
+#include <thread>
+#include <vector>
+
+#include <unistd.h>
+
+using namespace Mutation;
+using namespace Catch;
+
+TEST_CASE("Property server evaluates batches like a local mixture",
+    "[server]")
+{
+    MixtureOptions opts("air_11");
+    opts.setStateModel("ChemNonEqTTv");
+    Mixture mix(opts);
+
+    const int ns = mix.nSpecies();
+    const int nin = mix.nMassEqns() + mix.nEnergyEqns();
+
+    // States with partially dissociated air at various temperatures
+    const int n = 1000;
+    std::vector<double> states(std::size_t(n)*nin, 0.0);
+    for (int i = 0; i < n; ++i) {
+        double* const p_state = &states[std::size_t(i)*nin];
+        const double rho = 0.01 + 0.001*(i % 10);
+        const double alpha = 0.5*double(i)/n;
+        p_state[mix.speciesIndex("N2")] = 0.767*rho*(1.0 - alpha);
+        p_state[mix.speciesIndex("O2")] = 0.233*rho*(1.0 - 2.0*alpha);
+        p_state[mix.speciesIndex("N")]  = 0.767*rho*alpha;
+        p_state[mix.speciesIndex("O")]  = 0.233*rho*2.0*alpha;
+        p_state[ns]   = 2000.0 + 8.0*i;
+        p_state[ns+1] = 1000.0 + 10.0*i;
+    }
+
+    std::stringstream path;
+    path << "/tmp/mpp_test_server_" << getpid() << ".sock";
+
+    PropertyServer server(opts, path.str(), 2);
+    std::thread thread(&PropertyServer::run, &server);
+
+    PropertyClient client(path.str());
+
+    SECTION("The client knows the mixture of the server") {
+        CHECK(client.nInputs() == nin);
+        REQUIRE(client.nSpecies() == ns);
+        for (int i = 0; i < ns; ++i)
+            CHECK(client.speciesName(i) == mix.speciesName(i));
+
+        // The mixture is named after its file
+        CHECK(client.mixtures() == std::vector<std::string>(1, "air_11"));
+    }
+
+    SECTION("Values match a local evaluation") {
+        const std::string list = "T,Tv,P,mu,lam_f,X,omega,Omega";
+        BatchProperties props(mix, list);
+        std::vector<double> expected(std::size_t(n)*props.nValues());
+        REQUIRE(props.evaluate(mix, &states[0], n, 1, &expected[0]) == 0);
+
+        std::vector<double> values;
+        CHECK(client.evaluate(list, &states[0], n, values) == 0);
+        REQUIRE(values.size() == expected.size());
+        for (int i = 0; i < values.size(); ++i)
+            CHECK(values[i] == Approx(expected[i]).epsilon(1.0e-12));
+    }
+
+    SECTION("Unknown properties are rejected") {
+        std::vector<double> values;
+        CHECK_THROWS_AS(
+            client.evaluate("T,foo", &states[0], n, values), Error);
+
+        // The connection is still usable
+        CHECK(client.evaluate("T", &states[0], 10, values) == 0);
+        REQUIRE(values.size() == 10);
+        CHECK(values[9] == Approx(states[9*nin+ns]));
+    }
+
+    SECTION("Statistics are kept for each connection") {
+        std::vector<double> values;
+        client.evaluate("rho", &states[0], n, values);
+        client.evaluate("rho,h", &states[0], 10, values);
+
+        PropertyClient other(path.str());
+        other.evaluate("P", &states[0], 5, values);
+
+        const PropertyProtocol::Statistics stats = client.statistics();
+        CHECK(stats.requests == 4);
+        CHECK(stats.states == n + 10);
+        CHECK(stats.failed == 0);
+        CHECK(stats.bytes_out >= (n + 20)*sizeof(double));
+
+        CHECK(other.statistics().states == 5);
+    }
+
+    server.stop();
+    thread.join();
+}
+
+TEST_CASE("Property server clients select one of several mixtures",
+    "[server]")
+{
+    std::vector<std::string> names;
+    names.push_back("air_5");
+    names.push_back("air_11");
+    std::vector<MixtureOptions> opts(names.begin(), names.end());
+
+    std::stringstream path;
+    path << "/tmp/mpp_test_server_" << getpid() << ".sock";
+
+    PropertyServer server(names, opts, path.str(), 2);
+    std::thread thread(&PropertyServer::run, &server);
+    CHECK(server.nMixtures() == 2);
+
+    for (int m = 0; m < 2; ++m) {
+        Mixture mix(opts[m]);
+        const int ns = mix.nSpecies();
+        const int nin = mix.nMassEqns() + mix.nEnergyEqns();
+
+        PropertyClient client(path.str(), names[m]);
+        CHECK(client.mixture() == names[m]);
+        CHECK(client.nInputs() == nin);
+        REQUIRE(client.nSpecies() == ns);
+        for (int i = 0; i < ns; ++i)
+            CHECK(client.speciesName(i) == mix.speciesName(i));
+
+        // Each client evaluates with the mixture it selected
+        std::vector<double> state(nin, 0.0);
+        state[mix.speciesIndex("N2")] = 0.767;
+        state[mix.speciesIndex("O2")] = 0.233;
+        state[ns] = 3000.0;
+        BatchProperties props(mix, "T,cp,mu");
+        std::vector<double> expected(props.nValues()), values;
+        REQUIRE(props.evaluate(mix, &state[0], 1, 1, &expected[0]) == 0);
+        CHECK(client.evaluate("T,cp,mu", &state[0], 1, values) == 0);
+        REQUIRE(values.size() == expected.size());
+        for (int i = 0; i < values.size(); ++i)
+            CHECK(values[i] == Approx(expected[i]).epsilon(1.0e-12));
+    }
+
+    // The first mixture is used by default
+    PropertyClient client(path.str());
+    CHECK(client.nSpecies() == 5);
+    CHECK(client.mixtures() == names);
+
+    CHECK_THROWS_AS(PropertyClient(path.str(), "air_7"), Error);
+
+    server.stop();
+    thread.join();
+}
+
+#endif // _WIN32
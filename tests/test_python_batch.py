@@ -0,0 +1,78 @@
+# Copyright 2018 von Karman Institute for Fluid Dynamics (VKI)
+#
+# This file is part of MUlticomponent Thermodynamic And Transport
+# properties for IONized gases in C++ (Mutation++) software package.
+#
+# Mutation++ is free software: you can redistribute it and/or modify
+# it under the terms of the GNU Lesser General Public License as
+# published by the Free Software Foundation, either version 3 of the
+# License, or (at your option) any later version.
+#
+# Mutation++ is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+# GNU Lesser General Public License for more details.
+#
+# You should have received a copy of the GNU Lesser General Public
+# License along with Mutation++.  If not, see
+# <http://www.gnu.org/licenses/>.
+
+"""Smoke test of the NumPy bindings to the C batch API.
+
+Run by CTest with MPP_LIBRARY set to the built library and the bindings on
+the PYTHONPATH.
+"""
+
+import unittest
+
+import numpy as np
+
+from mutationpp_batch import BatchMixture
+
+
+class BatchMixtureTest(unittest.TestCase):
+
+    def setUp(self):
+        self.mix = BatchMixture('air_5', 'ChemNonEq1T', threads=2)
+
+    def test_mixture(self):
+        self.assertEqual(
+            sorted(self.mix.species), sorted(['N', 'O', 'NO', 'N2', 'O2']))
+        self.assertEqual(self.mix.n_inputs, len(self.mix.species) + 1)
+        self.assertEqual(self.mix.n_values('T,mu'), 2)
+        self.assertRaises(RuntimeError, self.mix.n_values, 'T,foo')
+
+    def test_evaluate(self):
+        # Column ordered states are passed without a copy
+        n = 50
+        states = np.zeros((n, self.mix.n_inputs), order='F')
+        states[:, self.mix.species.index('N2')] = 0.0767
+        states[:, self.mix.species.index('O2')] = 0.0233
+        states[:, -1] = np.linspace(1000.0, 5000.0, n)
+
+        values, failed = self.mix.evaluate('T,mu', states)
+        self.assertEqual(failed, 0)
+        self.assertEqual(values.shape, (n, 2))
+        np.testing.assert_allclose(values[:, 0], states[:, -1])
+        self.assertTrue(np.all(values[:, 1] > 0.0))
+        self.assertTrue(np.all(np.diff(values[:, 1]) > 0.0))
+
+        # Values are written in place in a strided output array
+        out = np.full((2*n, 2), -1.0)
+        self.mix.evaluate('T,mu', states, out=out[::2])
+        np.testing.assert_array_equal(out[::2], values)
+        self.assertTrue(np.all(out[1::2] == -1.0))
+
+    def test_equilibrate(self):
+        X, failed = self.mix.equilibrate([2000.0, 4000.0, 6000.0], 101325.0)
+        self.assertEqual(failed, 0)
+        self.assertEqual(X.shape, (3, len(self.mix.species)))
+        np.testing.assert_allclose(X.sum(axis=1), 1.0)
+
+        # Dissociation increases with temperature
+        N = self.mix.species.index('N')
+        self.assertTrue(X[0, N] < X[1, N] < X[2, N])
+
+
+if __name__ == '__main__':
+    unittest.main()
@@ -88,3 +88,67 @@ TEST_CASE
     )
 }
 
+
+/*
+ * The batched temperature solver should find temperatures which reproduce the
+ * energies of a block of states given their conserved variables and perturbed
+ * initial guesses, without changing the current state of the mixture.  Note
+ * that energies are compared rather than temperatures since Tv is not
+ * determined by the energies when no species carries vibrational-electronic
+ * energy (e.g. argon at low temperature).
+ */
+TEST_CASE
+(
+    "solveTemperatures() recovers Tm from rho*Em for a block of states",
+    "[thermodynamics]"
+)
+{
+    const int t_var_set = 1;
+
+    MIXTURE_LOOP
+    (
+        const int ns = mix.nSpecies();
+        const int nt = mix.nEnergyEqns();
+        const int n  = 100;
+
+        VectorXd rhoi(n*ns);
+        VectorXd rhoe(n*nt);
+        VectorXd tmps(n*nt);
+        bool converged[n];
+
+        int k = 0;
+        EQUILIBRATE_LOOP
+        (
+            double rho = mix.density();
+            rhoi.segment(k*ns, ns) =
+                rho * Eigen::Map<const Eigen::ArrayXd>(mix.Y(), ns);
+
+            // Set a randomly perturbed temperature vector T +- 500K
+            for (int i = 0; i < nt; ++i)
+                tmps[k*nt+i] = double(rand()) / RAND_MAX * 1000.0 - 500.0 + T;
+            mix.setState(&rhoi[k*ns], &tmps[k*nt], t_var_set);
+
+            mix.mixtureEnergies(&rhoe[k*nt]);
+            rhoe.segment(k*nt, nt) *= rho;
+
+            // Initial guesses are within 10% of the solution
+            tmps.segment(k*nt, nt) *= (k % 2 == 0 ? 1.1 : 0.9);
+            k++;
+        )
+
+        double T = mix.T();
+        CHECK(mix.state()->solveTemperatures(
+            n, rhoi.data(), rhoe.data(), tmps.data(), converged) == n);
+        CHECK(mix.T() == T);
+
+        VectorXd energies(nt);
+        for (int k = 0; k < n; ++k) {
+            CHECK(converged[k]);
+            mix.setState(&rhoi[k*ns], &tmps[k*nt], t_var_set);
+            mix.mixtureEnergies(energies.data());
+            energies *= mix.density();
+            for (int i = 0; i < nt; ++i)
+                CHECK(energies[i] == Approx(rhoe[k*nt+i]));
+        }
+    )
+}
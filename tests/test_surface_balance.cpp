@@ -0,0 +1,348 @@
+/*
+ * Copyright 2018 von Karman Institute for Fluid Dynamics (VKI)
+ *
+ * This file is part of MUlticomponent Thermodynamic And Transport
+ * properties for IONized gases in C++ (Mutation++) software package.
+ *
+ * Mutation++ is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as
+ * published by the Free Software Foundation, either version 3 of the
+ * License, or (at your option) any later version.
+ *
+ * Mutation++ is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with Mutation++.  If not, see
+ * <http://www.gnu.org/licenses/>.
+ */
+
+#include "mutation++.h"
+#include "SurfaceProperties.h"
+#include "TemporaryFile.h"
+#include "WallProductionRates.h"
+#include "WallProductionTerms.h"
+#include "WallState.h"
+#include <catch/catch.hpp>
+
+#include <vector>
+
+using namespace Mutation;
+using namespace Mutation::GasSurfaceInteraction;
+using namespace Mutation::Utilities::IO;
+using namespace Catch;
+
+/**
+ * Writes a gas surface interaction file for an ablating carbon wall.
+ */
+void writeCarbonGSIFile(TemporaryFile& file)
+{
+    file << "<gsi gsi_mechanism=\"gamma\">\n"
+         << "  <surface_properties type=\"gamma\"> </surface_properties>\n"
+         << "  <diffusion_model> </diffusion_model>\n"
+         << "  <production_terms>\n"
+         << "    <surface_chemistry>\n"
+         << "      <reaction type=\"ablation\" formula=\"C-s + O => CO\">\n"
+         << "        <gamma_const> O:0.63 </gamma_const>\n"
+         << "      </reaction>\n"
+         << "      <reaction type=\"ablation\" formula=\"C-s + O2 => CO + O\">\n"
+         << "        <gamma_const> O2:0.5 </gamma_const>\n"
+         << "      </reaction>\n"
+         << "      <reaction type=\"ablation\" formula=\"C-s + N => CN\">\n"
+         << "        <gamma_const> N:0.3 </gamma_const>\n"
+         << "      </reaction>\n"
+         << "    </surface_chemistry>\n"
+         << "  </production_terms>\n"
+         << "</gsi>\n";
+    file.close();
+}
+
+/**
+ * Sets the wall state and the diffusion model of the mixture for a wall at
+ * temperature T and pressure P, below a gas of mole fractions X.
+ */
+void setWall(Mixture& mix, const std::vector<double>& X, double T, double P)
+{
+    std::vector<double> rhoi(mix.nSpecies());
+    for (int i = 0; i < mix.nSpecies(); ++i)
+        rhoi[i] = X[i]*P/(RU*T)*mix.speciesMw(i);
+    mix.setDiffusionModel(&X[0], 1.0e-3);
+    mix.setWallState(&rhoi[0], &T, 1);
+}
+
+/**
+ * Returns the partial densities of the wall state.
+ */
+std::vector<double> wallDensities(Mixture& mix)
+{
+    std::vector<double> rhoi(mix.nSpecies());
+    double T;
+    mix.getWallState(&rhoi[0], &T, 1);
+    return rhoi;
+}
+
+/**
+ * Checks that the surface balance can be solved from the solution and
+ * Jacobian of the previous time step, kept separately for each wall face.
+ */
+TEST_CASE
+(
+    "Surface balance is warm started from the memory of each face",
+    "[gsi]"
+)
+{
+    // The mechanism is written in the current directory
+    GlobalOptions::workingDirectory("");
+
+    TemporaryFile gsi_file(".xml");
+    writeCarbonGSIFile(gsi_file);
+
+    MixtureOptions opts;
+    opts.setSpeciesDescriptor("C O N O2 N2 CO NO CN C3 CO2");
+    opts.setThermodynamicDatabase("NASA-9");
+    opts.setGSIMechanism(gsi_file.filename());
+    Mixture mix(opts);
+    const int ns = mix.nSpecies();
+
+    std::vector<double> X(ns, 1.0e-4);
+    X[mix.speciesIndex("N2")] = 0.5;
+    X[mix.speciesIndex("O2")] = 0.1;
+    X[mix.speciesIndex("N")]  = 0.1;
+    X[mix.speciesIndex("O")]  = 0.3 - 6.0e-4;
+
+    SurfaceBalanceMemory memory;
+    CHECK(!memory.hasSolution());
+    CHECK(memory.iterations() == 0);
+
+    // The first solve starts from the wall state and evaluates the Jacobian
+    setWall(mix, X, 2500.0, 10000.0);
+    mix.solveSurfaceBalance(memory);
+
+    CHECK(memory.hasSolution());
+    CHECK(memory.hasJacobian());
+    CHECK(memory.jacobianUpdates() >= 1);
+    CHECK(memory.residualHistory().size() == memory.iterations() + 1);
+    CHECK(memory.residualHistory().back() <
+        1.0e-3*memory.residualHistory().front());
+
+    // Next time steps start from the previous solution and reuse its
+    // Jacobian, and agree with the solver without memory
+    for (int step = 1; step <= 5; ++step) {
+        const double T = 2500.0 + 2.0*step;
+        setWall(mix, X, T, 10000.0);
+        mix.solveSurfaceBalance();
+        std::vector<double> cold = wallDensities(mix);
+
+        setWall(mix, X, T, 10000.0);
+        mix.solveSurfaceBalance(memory);
+        std::vector<double> warm = wallDensities(mix);
+
+        CHECK(memory.jacobianUpdates() < memory.iterations());
+        CHECK(memory.residualHistory().back() <
+            1.0e-3*memory.residualHistory().front());
+        for (int i = 0; i < ns; ++i)
+            CHECK(warm[i] == Approx(cold[i]).epsilon(1.0e-6).margin(1.0e-12));
+    }
+
+    // The wall pressure is conserved by the solution
+    std::vector<double> rhoi = wallDensities(mix);
+    double T = 2510.0;
+    mix.setState(&rhoi[0], &T, 1);
+    CHECK(mix.P() == Approx(10000.0).epsilon(1.0e-8));
+
+    // Another face keeps its own memory
+    SurfaceBalanceMemory other;
+    setWall(mix, X, 3000.0, 10000.0);
+    mix.solveSurfaceBalance(other);
+    CHECK(other.jacobianUpdates() >= 1);
+    CHECK(memory.solution().size() == ns);
+    CHECK(!other.solution().isApprox(memory.solution()));
+
+    // A reset memory starts again from the wall state
+    memory.reset();
+    CHECK(!memory.hasSolution());
+    CHECK(!memory.hasJacobian());
+    setWall(mix, X, 2500.0, 10000.0);
+    mix.solveSurfaceBalance(memory);
+    CHECK(memory.jacobianUpdates() >= 1);
+}
+
+/**
+ * Checks the gamma rate laws against the impinging fluxes of the reactants.
+ */
+TEST_CASE
+(
+    "Gamma rate laws give the reaction probability times the impinging flux",
+    "[gsi]"
+)
+{
+    // The mechanism is written in the current directory
+    GlobalOptions::workingDirectory("");
+
+    TemporaryFile gsi_file(".xml");
+    gsi_file
+        << "<gsi gsi_mechanism=\"gamma\">\n"
+        << "  <surface_properties type=\"gamma\"> </surface_properties>\n"
+        << "  <diffusion_model> </diffusion_model>\n"
+        << "  <production_terms>\n"
+        << "    <surface_chemistry>\n"
+        << "      <reaction type=\"catalysis\" formula=\"N + N => N2\">\n"
+        << "        <gamma_const> N:0.1 </gamma_const>\n"
+        << "      </reaction>\n"
+        << "      <reaction type=\"catalysis\" formula=\"N + O => NO\">\n"
+        << "        <gamma_const> O:0.2, N:0.05 </gamma_const>\n"
+        << "      </reaction>\n"
+        << "      <reaction type=\"ablation\" formula=\"C-s + O => CO\">\n"
+        << "        <gamma_T pre_exp=\"0.63\" T=\"1160.0\"/>\n"
+        << "      </reaction>\n"
+        << "      <reaction type=\"ablation\" formula=\"C-s + O2 => CO + O\">\n"
+        << "        <gamma_const> O2:0.5 </gamma_const>\n"
+        << "      </reaction>\n"
+        << "    </surface_chemistry>\n"
+        << "  </production_terms>\n"
+        << "</gsi>\n";
+    gsi_file.close();
+
+    MixtureOptions opts;
+    opts.setSpeciesDescriptor("C O N O2 N2 CO NO CN C3 CO2");
+    opts.setThermodynamicDatabase("NASA-9");
+    opts.setGSIMechanism(gsi_file.filename());
+    Mixture mix(opts);
+    const int ns = mix.nSpecies();
+    const int iN = mix.speciesIndex("N");
+    const int iO = mix.speciesIndex("O");
+    const int iO2 = mix.speciesIndex("O2");
+    const int iN2 = mix.speciesIndex("N2");
+    const int iNO = mix.speciesIndex("NO");
+    const int iCO = mix.speciesIndex("CO");
+
+    // Either N or O limits the second reaction
+    for (int lim = 0; lim < 2; ++lim) {
+        std::vector<double> X(ns, 1.0e-4);
+        X[iN2] = 0.5;
+        X[iO2] = 0.1;
+        X[iN]  = (lim == 0 ? 0.1 : 0.3 - 6.0e-4);
+        X[iO]  = (lim == 0 ? 0.3 - 6.0e-4 : 0.1);
+
+        const double T = 1500.0 + 1000.0*lim;
+        setWall(mix, X, T, 10000.0);
+        std::vector<double> rhoi = wallDensities(mix);
+
+        std::vector<double> flux(ns);
+        for (int i = 0; i < ns; ++i)
+            flux[i] = std::sqrt(RU*T/(TWOPI*mix.speciesMw(i)))*
+                rhoi[i]/mix.speciesMw(i);
+
+        const double k1 = 0.1*flux[iN]/2.0;
+        const double k2 =
+            (flux[iN] < flux[iO] ? 0.05*flux[iN] : 0.2*flux[iO]);
+        const double k3 = 0.63*std::exp(-1160.0/T)*flux[iO];
+        const double k4 = 0.5*flux[iO2];
+
+        // Rates are positive for the species consumed at the wall
+        std::vector<double> expected(ns, 0.0);
+        expected[iN]  = 2.0*k1 + k2;
+        expected[iO]  = k2 + k3 - k4;
+        expected[iO2] = k4;
+        expected[iN2] = -k1;
+        expected[iNO] = -k2;
+        expected[iCO] = -k3 - k4;
+
+        std::vector<double> wdot(ns);
+        mix.surfaceProductionRates(&wdot[0]);
+        for (int i = 0; i < ns; ++i)
+            CHECK(wdot[i] == Approx(expected[i]*mix.speciesMw(i)));
+    }
+}
+
+/**
+ * Production term whose rate depends on the whole wall state, and which
+ * counts how many times it is computed.
+ */
+class CountingProductionTerm : public WallProductionTerms
+{
+public:
+    CountingProductionTerm(ARGS args) :
+        WallProductionTerms(args), m_wall_state(args.s_wall_state),
+        m_tag("counting"), m_calls(0)
+    { }
+
+    void productionRate(Eigen::VectorXd& v_rate) {
+        m_calls++;
+        v_rate = m_wall_state.getWallRhoi()*m_wall_state.getWallT()(0) +
+            Eigen::VectorXd::Constant(v_rate.size(), m_wall_state.getWallP());
+    }
+
+    const std::string& getWallProductionTermTag() const { return m_tag; }
+
+    int calls() const { return m_calls; }
+
+private:
+    const WallState& m_wall_state;
+    std::string m_tag;
+    int m_calls;
+};
+
+/**
+ * Checks that the production rates shared by the surface balance terms are
+ * computed once per wall state, and again after any wall state setter.
+ */
+TEST_CASE
+(
+    "Wall production rates are recomputed when the wall state changes",
+    "[gsi]"
+)
+{
+    Mixture mix("air_5");
+    const int ns = mix.nSpecies();
+
+    Utilities::IO::XmlElement node("<production_terms> </production_terms>");
+    DataSurfaceProperties surf_data = { mix, node };
+    SurfaceProperties surf_props(surf_data);
+    WallState wall_state(mix, surf_props);
+
+    std::vector<WallProductionTerms*> terms;
+    WallProductionRates rates(wall_state, terms, ns);
+
+    const std::string mechanism = "gamma";
+    double P = ONEATM;
+    DataWallProductionTerms data =
+        { mix, mix, mechanism, node, surf_props, wall_state, &rates, &P };
+    CountingProductionTerm term(data);
+    terms.push_back(&term);
+
+    std::vector<double> rhoi(ns, 0.1);
+    double T = 1000.0;
+    wall_state.setWallState(&rhoi[0], &T, 1);
+    wall_state.setWallP(P);
+
+    // The rate is computed once, however many times it is used
+    CHECK(rates.rate(0)[0] == Approx(0.1*T + P));
+    CHECK(rates.total()[0] == Approx(0.1*T + P));
+    CHECK(rates.rate(0)[0] == Approx(0.1*T + P));
+    CHECK(term.calls() == 1);
+
+    // Every setter invalidates it
+    rhoi[0] = 0.2;
+    wall_state.setWallRhoi(&rhoi[0]);
+    CHECK(rates.total()[0] == Approx(0.2*T + P));
+    CHECK(term.calls() == 2);
+
+    T = 2000.0;
+    wall_state.setWallT(&T);
+    CHECK(rates.rate(0)[0] == Approx(0.2*T + P));
+    CHECK(term.calls() == 3);
+
+    P = 1000.0;
+    wall_state.setWallP(P);
+    CHECK(rates.total()[0] == Approx(0.2*T + P));
+    CHECK(term.calls() == 4);
+
+    rhoi[0] = 0.3;
+    wall_state.setWallState(&rhoi[0], &T, 1);
+    CHECK(rates.rate(0)[0] == Approx(0.3*T + P));
+    CHECK(rates.total()[0] == Approx(0.3*T + P));
+    CHECK(term.calls() == 5);
+}
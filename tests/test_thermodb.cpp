@@ -123,6 +123,69 @@ TEST_CASE
     }
 }
 
+/**
+ * Checks that the species selected from a catalog are those which match the
+ * descriptor, in the same order.
+ */
+TEST_CASE
+(
+    "SpeciesCatalog selections match the species list descriptor",
+    "[thermodynamics][loading]"
+)
+{
+    std::list<Species> available;
+    available.push_back(Species("N"));
+    available.push_back(Species(available.back(), 0));
+    available.push_back(Species(available.front(), 1));
+    available.push_back(Species("O"));
+    available.push_back(Species("O2"));
+    available.push_back(Species("NO"));
+    available.push_back(Species("N2"));
+    available.push_back(Species("O")); // duplicate is ignored
+    available.push_back(Species("Ar"));
+    available.push_back(
+        Species("C(gr)", SOLID, Species::StoichList()("C", 1)));
+    available.push_back(Species("C"));
+    available.push_back(Species("CO"));
+    available.push_back(Species("e-"));
+
+    SpeciesCatalog catalog(available);
+    CHECK(catalog.nSpecies() == 12);
+    CHECK(catalog.speciesIndex("O") == 3);
+    CHECK(catalog.speciesIndex("N2") == 6);
+    CHECK(catalog.speciesIndex("N3") == -1);
+    CHECK(catalog.groundStateIndices("N").size() == 3);
+    CHECK(catalog.groundStateIndices("O2").size() == 1);
+    CHECK(catalog.groundStateIndices("N3").size() == 0);
+
+    const char* descriptors[] = {
+        "C(gr) N O e- \"N2\" NO O2",
+        "N(*) {solids with C} \"O\"",
+        "{gases with N O}",
+        "{all with C O} e- N",
+        "N2 N3"
+    };
+
+    for (int i = 0; i < 5; ++i) {
+        INFO(descriptors[i]);
+        SpeciesListDescriptor ld(descriptors[i]);
+
+        std::list<Species> expected;
+        for (int k = 0; k < catalog.nSpecies(); ++k)
+            if (ld.matches(catalog.species(k)))
+                expected.push_back(catalog.species(k));
+
+        std::list<Species> selected;
+        ld.select(catalog, selected);
+
+        REQUIRE(selected.size() == expected.size());
+        std::list<Species>::const_iterator it1 = selected.begin();
+        std::list<Species>::const_iterator it2 = expected.begin();
+        for ( ; it1 != selected.end(); ++it1, ++it2)
+            CHECK(it1->name() == it2->name());
+    }
+}
+
 // Flags for checkThermoDBLoad()
 int DEFAULTS   = 1;
 int AIR5       = 2;
@@ -265,3 +328,65 @@ TEST_CASE
 }
 
 
+/**
+ * Checks that the tabulated vibrational and electronic properties of the RRHO
+ * database match the analytic model.  The electronic properties are only
+ * compared loosely since the analytic path itself interpolates the Boltzmann
+ * factors.
+ */
+TEST_CASE
+(
+    "Tabulated RRHO energy modes match the analytic model",
+    "[thermodynamics]"
+)
+{
+    const std::string species = "e- N N+ O O+ NO N2 N2+ O2 O2+ NO+";
+    ThermoDB* exact = Utilities::Config::Factory<ThermoDB>::create("RRHO", 0);
+    ThermoDB* table = Utilities::Config::Factory<ThermoDB>::create("RRHO", 1);
+    exact->load(species);
+    table->load(species);
+
+    const int ns = exact->species().size();
+    std::vector<double> a(3*ns), b(3*ns);
+
+    for (double T = 60.0; T < 49000.0; T *= 1.1) {
+        const double Tv = 0.7*T + 30.0;
+
+        exact->cp(T, T, T, Tv, Tv, &a[0], NULL, NULL, &a[ns], &a[2*ns]);
+        table->cp(T, T, T, Tv, Tv, &b[0], NULL, NULL, &b[ns], &b[2*ns]);
+        for (int i = 0; i < ns; ++i) {
+            CHECK(b[i] == Approx(a[i]).epsilon(1.0e-2));
+            CHECK(b[ns+i] == Approx(a[ns+i]).margin(1.0e-6));
+            CHECK(b[2*ns+i] == Approx(a[2*ns+i]).margin(5.0e-2));
+        }
+
+        exact->enthalpy(T, T, T, Tv, Tv, &a[0], NULL, NULL, &a[ns], NULL, NULL);
+        table->enthalpy(T, T, T, Tv, Tv, &b[0], NULL, NULL, &b[ns], NULL, NULL);
+        for (int i = 0; i < ns; ++i) {
+            CHECK(b[i] == Approx(a[i]).margin(1.0e-2));
+            CHECK(b[ns+i] == Approx(a[ns+i]).margin(1.0e-6));
+        }
+
+        exact->entropy(T, T, T, Tv, Tv, ONEATM, &a[0], NULL, NULL, NULL, NULL);
+        table->entropy(T, T, T, Tv, Tv, ONEATM, &b[0], NULL, NULL, NULL, NULL);
+        for (int i = 0; i < ns; ++i)
+            CHECK(b[i] == Approx(a[i]).margin(1.0e-2));
+    }
+
+    delete exact;
+    delete table;
+
+    // The tables are requested through the mixture options
+    GlobalOptions::workingDirectory("");
+    MixtureOptions opts("air_11");
+    opts.setThermodynamicDatabase("RRHO");
+    Mixture analytic(opts);
+    opts.setThermodynamicTables(true);
+    Mixture tabulated(opts);
+
+    const double P = ONEATM, T = 5000.0;
+    analytic.equilibrate(T, P);
+    tabulated.equilibrate(T, P);
+    CHECK(tabulated.mixtureFrozenCpMass() ==
+        Approx(analytic.mixtureFrozenCpMass()).epsilon(1.0e-3));
+}
@@ -76,3 +76,175 @@ TEST_CASE
     )
 }
 
+
+/**
+ * Computes the derivatives of an energy transfer term with respect to the
+ * logarithm of the species densities, T, and Tv using central finite
+ * differences and restores the original state.
+ */
+void finiteDifferenceJacobian(
+    Mixture& mix, TransferModel* p_omega, const VectorXd& x, double* const p_fd)
+{
+    const int ns = mix.nSpecies();
+
+    for (int i = 0; i < ns+2; ++i) {
+        const double h = 1.0e-6*x[i];
+        VectorXd xp = x;
+
+        xp[i] = x[i] + h;
+        mix.setState(xp.data(), xp.data()+ns, 1);
+        const double fp = p_omega->source();
+
+        xp[i] = x[i] - h;
+        mix.setState(xp.data(), xp.data()+ns, 1);
+        const double fm = p_omega->source();
+
+        p_fd[i] = (fp - fm) / 2.0e-6;
+    }
+
+    mix.setState(x.data(), x.data()+ns, 1);
+}
+
+/**
+ * Returns the round-off noise of an energy transfer term at the given state,
+ * estimated from its spread over states which only differ in the last digits.
+ * Terms which are a small difference of large rates, such as the chemistry
+ * source of the argon collisional-radiative model, can be dominated by it.
+ */
+double sourceNoise(Mixture& mix, TransferModel* p_omega, const VectorXd& x)
+{
+    const int ns = mix.nSpecies();
+    const double f = p_omega->source();
+    double noise = 0.0;
+
+    for (int r = 1; r <= 4; ++r) {
+        VectorXd xp = x;
+        for (int i = 0; i < ns+2; ++i)
+            xp[i] *= 1.0 + ((7*i + 3*r) % 11 - 5)*1.0e-14;
+        mix.setState(xp.data(), xp.data()+ns, 1);
+        noise = std::max(noise, std::abs(p_omega->source() - f));
+    }
+
+    mix.setState(x.data(), x.data()+ns, 1);
+    return noise;
+}
+
+/**
+ * Returns the derivative of the logarithm of the electron-heavy collision
+ * frequency with respect to the logarithm of Tv.
+ */
+double electronFrequencyLogDerivative(Mixture& mix, const VectorXd& x)
+{
+    const int ns = mix.nSpecies();
+    double nu[2];
+
+    for (int s = 0; s < 2; ++s) {
+        VectorXd xp = x;
+        xp[ns+1] = x[ns+1]*(s == 0 ? 1.0 + 1.0e-6 : 1.0 - 1.0e-6);
+        mix.setState(xp.data(), xp.data()+ns, 1);
+
+        const ArrayXd& nuei = mix.collisionDB().nuei();
+        const ArrayXd& mass = mix.collisionDB().mass();
+        nu[s] = (nuei.tail(ns-1) / mass.tail(ns-1)).sum();
+    }
+
+    mix.setState(x.data(), x.data()+ns, 1);
+    return (nu[0] - nu[1]) / (nu[0] + nu[1]) / 1.0e-6;
+}
+
+/**
+ * Puts the current equilibrium composition out of thermal equilibrium and
+ * compares the analytic Jacobian of the energy transfer term with finite
+ * differences.  Derivatives are scaled by their variables before comparison.
+ */
+void checkTransferJacobian(
+    Mixture& mix, TransferModel* p_omega, const std::string& name)
+{
+    const int ns = mix.nSpecies();
+    VectorXd x(ns+2);
+    VectorXd jac(ns+2);
+    VectorXd fd(ns+2);
+
+    mix.densities(x.data());
+    x[ns] = mix.T();
+    x[ns+1] = 0.7*mix.T();
+    mix.setState(x.data(), x.data()+ns, 1);
+
+    p_omega->jacobian(jac.data());
+    jac = jac.cwiseProduct(x);
+    finiteDifferenceJacobian(mix, p_omega, x, fd.data());
+
+    // The Jacobian keeps the sqrt(Te) dependence of the electron collision
+    // frequency but holds the collision integrals constant, so their
+    // contribution is removed from the reference
+    if (name == "OmegaET" && mix.hasElectrons())
+        fd[ns+1] -= p_omega->source()*
+            (electronFrequencyLogDerivative(mix, x) - 0.5);
+
+    // Terms which do not apply to the mixture vanish identically
+    const double scale = fd.cwiseAbs().maxCoeff();
+    if (scale == 0.0) {
+        CHECK(jac.cwiseAbs().maxCoeff() == 0.0);
+        return;
+    }
+
+    // The temperature derivatives of the terms coupled to the chemistry go
+    // through the species Gibbs energies and enthalpies, which the cubic
+    // thermodynamic tables only reproduce to within a few 1e-4 of each other.
+    // The margin covers the round-off of the finite differences.
+    const double noise = sourceNoise(mix, p_omega, x) / 1.0e-6;
+
+    for (int k = 0; k < ns+2; ++k) {
+        INFO("T = " << x[ns] << ", P = " << mix.P() << ", column " << k);
+        CHECK(jac[k] == Approx(fd[k]).scale(0.0)
+            .epsilon(k < ns ? 1.0e-4 : 1.0e-3)
+            .margin(1.0e-5*scale + 10.0*noise));
+    }
+}
+
+TEST_CASE
+(
+    "Energy transfer Jacobians match finite differences",
+    "[transfer]"
+)
+{
+    const std::string transfer_terms [] = {
+        "OmegaCE", "OmegaCElec", "OmegaCV", "OmegaET", "OmegaI", "OmegaVT"
+    };
+
+    // Jacobians are taken with respect to T and Tv.  The mixtures use the
+    // thermodynamic tables whose Gibbs energies, enthalpies and heat
+    // capacities are interpolated consistently, unlike the linearly
+    // interpolated RRHO electronic partition functions.
+    const std::string names [] = {
+        "air5_RRHO_ChemNonEqTTv",
+        "air11_RRHO_ChemNonEqTTv",
+        "argon_CR_ChemNonEqTTv"
+    };
+
+    GlobalOptions::workingDirectory(TEST_DATA_FOLDER);
+
+    for (int m = 0; m < 3; ++m) {
+        SECTION(names[m]) {
+            MixtureOptions opts(names[m]);
+            opts.setThermodynamicTables(true);
+            Mixture mix(opts);
+
+            for (int i = 0; i < 6; ++i) {
+                SECTION(transfer_terms[i]) {
+                    TransferModel* p_omega =
+                         Utilities::Config::Factory<TransferModel>::create(
+                             transfer_terms[i], mix);
+
+                    EQUILIBRATE_LOOP
+                    (
+                        checkTransferJacobian(
+                            mix, p_omega, transfer_terms[i]);
+                    )
+
+                    delete p_omega;
+                }
+            }
+        }
+    }
+}
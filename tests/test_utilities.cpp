@@ -23,6 +23,22 @@
 #include <catch/catch.hpp>
 #include <eigen3/Eigen/Dense>
 
+#include <algorithm>
+#include <ctime>
+#include <fstream>
+#include <iomanip>
+#include <sstream>
+#include <vector>
+
+#ifndef _WIN32
+#include <cstring>
+#include <dirent.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <sys/wait.h>
+#include <unistd.h>
+#endif
+
 using namespace Mutation;
 using namespace Mutation::Utilities;
 using namespace Mutation::Utilities::IO;
@@ -179,6 +195,367 @@ TEST_CASE
 }
 
 
+#ifndef _WIN32
+/**
+ * Shares a table from this process and a forked child process, checking that
+ * both attach to the same read-only copy of the data.
+ */
+void checkSharedTable(const std::string& location)
+{
+    VectorXd data = VectorXd::LinSpaced(1000, 0.0, 1.0);
+    data[0] = getpid();
+    const size_t bytes = data.size()*sizeof(double);
+
+    GlobalOptions::sharedTables(location);
+    REQUIRE(SharedTable::enabled());
+
+    SharedTable* p_first = SharedTable::share("test", data.data(), bytes);
+    REQUIRE(p_first != NULL);
+    CHECK(p_first->size() == bytes);
+    CHECK(p_first->data() != data.data());
+    CHECK(std::memcmp(p_first->data(), data.data(), bytes) == 0);
+
+    // Sharing the same data again attaches to the same segment
+    SharedTable* p_second = SharedTable::share("test", data.data(), bytes);
+    REQUIRE(p_second != NULL);
+    CHECK(p_second->name() == p_first->name());
+    CHECK(std::memcmp(p_second->data(), data.data(), bytes) == 0);
+
+    // Different data is never attached to the same segment
+    data[1] = 2.0;
+    SharedTable* p_third = SharedTable::share("test", data.data(), bytes);
+    REQUIRE(p_third != NULL);
+    CHECK(p_third->name() != p_first->name());
+    data[1] = 1.0/999.0;
+
+    // Another process attaches to the segment created by this one
+    pid_t pid = fork();
+    if (pid == 0) {
+        SharedTable* p_child = SharedTable::share("test", data.data(), bytes);
+        _exit(p_child != NULL && p_child->name() == p_first->name() ? 0 : 1);
+    }
+    int status = -1;
+    waitpid(pid, &status, 0);
+    CHECK(WIFEXITED(status));
+    CHECK(WEXITSTATUS(status) == 0);
+
+    const std::string first_name = p_first->name();
+    delete p_first;
+    delete p_second;
+    delete p_third;
+
+    // Tables opened by key are reserved for the first process, which fills
+    // them while the others wait
+    std::stringstream key;
+    key << "test key " << getpid();
+    SharedTable* p_owner = SharedTable::open("test", key.str(), bytes);
+    REQUIRE(p_owner != NULL);
+    CHECK(!p_owner->published());
+
+    pid = fork();
+    if (pid == 0) {
+        SharedTable* p_child = SharedTable::open("test", key.str(), bytes);
+        _exit(p_child != NULL && p_child->published() &&
+            std::memcmp(p_child->data(), data.data(), bytes) == 0 ? 0 : 1);
+    }
+    usleep(100000);
+    p_owner->publish(data.data());
+    CHECK(p_owner->published());
+    CHECK(std::memcmp(p_owner->data(), data.data(), bytes) == 0);
+    waitpid(pid, &status, 0);
+    CHECK(WIFEXITED(status));
+    CHECK(WEXITSTATUS(status) == 0);
+
+    SharedTable* p_keyed = SharedTable::open("test", key.str(), bytes);
+    REQUIRE(p_keyed != NULL);
+    CHECK(p_keyed->published());
+    CHECK(p_keyed->name() == p_owner->name());
+    delete p_owner;
+    delete p_keyed;
+
+    // A table which is never published is released for the other processes
+    key << " abandoned";
+    p_owner = SharedTable::open("test", key.str(), bytes);
+    REQUIRE(p_owner != NULL);
+    delete p_owner;
+    p_owner = SharedTable::open("test", key.str(), bytes);
+    REQUIRE(p_owner != NULL);
+    CHECK(!p_owner->published());
+    delete p_owner;
+
+    // Remove the segments
+    CHECK(SharedTable::removeAll() >= 3);
+    SharedTable* p_again = SharedTable::share("test", data.data(), bytes);
+    REQUIRE(p_again != NULL);
+    CHECK(p_again->name() == first_name);
+    delete p_again;
+    CHECK(SharedTable::removeAll() >= 1);
+
+    GlobalOptions::sharedTables("");
+}
+
+/**
+ * Tests sharing of tables between processes.
+ */
+TEST_CASE
+(
+    "Shared tables",
+    "[utilities]"
+)
+{
+    GlobalOptions::sharedTables("");
+    double x = 1.0;
+    CHECK(SharedTable::share("test", &x, sizeof(double)) == NULL);
+
+    SECTION("Memory-mapped files") {
+        checkSharedTable(".");
+    }
+
+    SECTION("POSIX shared memory") {
+        checkSharedTable("shm");
+    }
+}
+
+/**
+ * Returns the names of the table files in the given directory.
+ */
+std::vector<std::string> tableFiles(const std::string& dir)
+{
+    std::vector<std::string> names;
+    DIR* p_dir = opendir(dir.c_str());
+    for (dirent* p_entry = readdir(p_dir); p_entry != NULL;
+         p_entry = readdir(p_dir)) {
+        const std::string name = p_entry->d_name;
+        if (name.compare(0, 4, "mpp-") == 0)
+            names.push_back(dir + "/" + name);
+    }
+    closedir(p_dir);
+    return names;
+}
+
+/**
+ * Tests that the collision integral and electronic partition function tables
+ * of a mixture are shared, and that segments left unpublished by a process
+ * which died are replaced.
+ */
+TEST_CASE
+(
+    "Mixture tables are shared between processes",
+    "[utilities]"
+)
+{
+    char dir [] = "/tmp/mpp-shared-XXXXXX";
+    REQUIRE(mkdtemp(dir) != NULL);
+
+    // Collision integrals are only tabulated when the database asks for it,
+    // so a copy of the database which does is put in the working directory
+    const std::string transport = std::string(dir) + "/transport";
+    const std::string database = transport + "/collisions.xml";
+    REQUIRE(mkdir(transport.c_str(), 0700) == 0);
+    {
+        GlobalOptions::workingDirectory("");
+        const std::string original =
+            databaseFileName("collisions.xml", "transport");
+        DataFileStream in(original);
+        REQUIRE(in.is_open());
+        std::ofstream out(database.c_str());
+        std::string line;
+        while (std::getline(in, line)) {
+            if (line.find("<!--<tabulate") != std::string::npos)
+                line = "<tabulate Tmin=\"100\" Tmax=\"50000\" dT=\"100\" />";
+            out << line << '\n';
+        }
+    }
+
+    GlobalOptions::workingDirectory(dir);
+    GlobalOptions::sharedTables("");
+    Mixture reference("air_11");
+    const double T = 5000.0, P = ONEATM;
+    reference.equilibrate(T, P);
+    const double mu = reference.viscosity();
+    const double cp = reference.mixtureFrozenCpMass();
+
+    GlobalOptions::sharedTables(dir);
+    {
+        Mixture mix("air_11");
+        mix.equilibrate(T, P);
+        CHECK(mix.viscosity() == mu);
+        CHECK(mix.mixtureFrozenCpMass() == cp);
+    }
+
+    // Both the collision integrals and the Boltzmann factors are shared
+    std::vector<std::string> names = tableFiles(dir);
+    bool collisions = false, elec = false;
+    for (int i = 0; i < names.size(); ++i) {
+        collisions |= (names[i].find("mpp-collisions-") != std::string::npos);
+        elec |= (names[i].find("mpp-rrho-elec-") != std::string::npos);
+    }
+    CHECK(collisions);
+    CHECK(elec);
+
+    // Turn the segments into ones created by a process which died before
+    // publishing them
+    pid_t pid = fork();
+    if (pid == 0)
+        _exit(0);
+    waitpid(pid, NULL, 0);
+
+    const int header [6] = { 0, 0, 0, 0, int(pid), 0 };
+    for (int i = 0; i < names.size(); ++i) {
+        std::fstream file(names[i].c_str(),
+            std::ios::in | std::ios::out | std::ios::binary);
+        file.write(reinterpret_cast<const char*>(header), sizeof(header));
+    }
+
+    // They are replaced without waiting for the owner to publish them
+    const std::time_t start = std::time(NULL);
+    {
+        Mixture mix("air_11");
+        mix.equilibrate(T, P);
+        CHECK(mix.viscosity() == mu);
+        CHECK(mix.mixtureFrozenCpMass() == cp);
+    }
+    CHECK(std::time(NULL) - start < 5);
+    CHECK(tableFiles(dir).size() == names.size());
+
+    names = tableFiles(dir);
+    for (int i = 0; i < names.size(); ++i)
+        std::remove(names[i].c_str());
+    std::remove(database.c_str());
+    rmdir(transport.c_str());
+    rmdir(dir);
+    GlobalOptions::sharedTables("");
+    GlobalOptions::workingDirectory("");
+}
+#endif
+
+
+/**
+ * Tests caching tables on disk.
+ */
+TEST_CASE
+(
+    "Table cache",
+    "[utilities]"
+)
+{
+    VectorXd data = VectorXd::LinSpaced(100, 0.0, 1.0);
+    VectorXd loaded = VectorXd::Zero(100);
+
+    GlobalOptions::tableCache("");
+    CHECK(!TableCache::save("test", "key", data.data(), data.size()));
+
+    GlobalOptions::tableCache(".");
+    REQUIRE(TableCache::enabled());
+    CHECK(!TableCache::load("test", "key", loaded.data(), loaded.size()));
+
+    REQUIRE(TableCache::save("test", "key", data.data(), data.size()));
+    CHECK(TableCache::load("test", "key", loaded.data(), loaded.size()));
+    CHECK(loaded == data);
+
+    // Tables are only loaded for the same key and size
+    loaded.setZero();
+    CHECK(!TableCache::load("test", "other", loaded.data(), loaded.size()));
+    CHECK(!TableCache::load("test", "key", loaded.data(), loaded.size()-1));
+    CHECK(loaded.isZero());
+
+    // A file found under the name of a key is only loaded for that very key,
+    // as two keys may have the same hash
+    REQUIRE(TableCache::save("test", "other", data.data(), data.size()));
+    REQUIRE(std::rename(TableCache::fileName("test", "other").c_str(),
+        TableCache::fileName("test", "key").c_str()) == 0);
+    CHECK(!TableCache::load("test", "key", loaded.data(), loaded.size()));
+    CHECK(loaded.isZero());
+
+    std::remove(TableCache::fileName("test", "key").c_str());
+    GlobalOptions::tableCache("");
+}
+
+/**
+ * Tests reading data files from disk or from the library.
+ */
+TEST_CASE
+(
+    "Embedded data files read like files on disk",
+    "[utilities]"
+)
+{
+    CHECK(embeddedDataPath("thermo/missing.xml").empty());
+    CHECK(!isEmbeddedDataPath("air_11.xml"));
+    CHECK(!DataFileStream(embeddedDataPath("thermo/missing.xml")).is_open());
+
+    // Disk files and embedded files are read the same way, including seeks
+    TemporaryFile file;
+    file << "0123456789";
+    file.close();
+
+    DataFileStream disk(file.filename());
+    REQUIRE(disk.is_open());
+    std::string text;
+    disk.seekg(4) >> text;
+    CHECK(text == "456789");
+
+    std::size_t n;
+    const EmbeddedFile* const files = embeddedFiles(n);
+    for (std::size_t i = 0; i < n; ++i) {
+        INFO(files[i].path);
+        const std::string path = embeddedDataPath(files[i].path);
+        REQUIRE(isEmbeddedDataPath(path));
+        CHECK(files[i].data[files[i].size] == 0);
+
+        DataFileStream embedded(path);
+        REQUIRE(embedded.is_open());
+        std::stringstream contents;
+        contents << embedded.rdbuf();
+        CHECK(contents.str() ==
+            std::string((const char*) files[i].data, files[i].size));
+
+        embedded.clear();
+        embedded.seekg(-1, std::ios::end);
+        CHECK(embedded.tellg() == std::streampos(files[i].size - 1));
+        CHECK(embedded.get() == files[i].data[files[i].size - 1]);
+
+        // The embedded file must match the one in the data directory
+        std::ifstream original(prependPath(
+            GlobalOptions::dataDirectory(), files[i].path).c_str(),
+            std::ios::in | std::ios::binary);
+        if (original.is_open()) {
+            std::stringstream expected;
+            expected << original.rdbuf();
+            CHECK(contents.str() == expected.str());
+        }
+    }
+
+    // Bundled files are read from the library before the data directory,
+    // unless they are given with a directory
+    GlobalOptions::workingDirectory("");
+    const bool bundled = (findEmbeddedFile("mixtures/air_11.xml") != NULL);
+    std::string mixture = databaseFileName("air_11", "mixtures");
+    CHECK(isEmbeddedDataPath(mixture) == bundled);
+    CHECK(DataFileStream(mixture).is_open());
+    CHECK(!isEmbeddedDataPath(databaseFileName(
+        prependPath(GlobalOptions::dataDirectory(), "mixtures/air_11"),
+        "mixtures")));
+
+    // They do not need the data directory
+    const std::string data_dir = GlobalOptions::dataDirectory();
+    GlobalOptions::dataDirectory(file.filename() + "-missing");
+    mixture = databaseFileName("air_11", "mixtures");
+    CHECK(isEmbeddedDataPath(mixture) == bundled);
+    CHECK(DataFileStream(mixture).is_open() == bundled);
+
+    // Files in the working directory come first
+    GlobalOptions::workingDirectory(data_dir);
+    CHECK(!isEmbeddedDataPath(databaseFileName("air_11", "mixtures")));
+    GlobalOptions::workingDirectory("");
+
+    const bool use_embedded = GlobalOptions::embeddedData();
+    GlobalOptions::embeddedData(false);
+    CHECK(!isEmbeddedDataPath(databaseFileName("air_11", "mixtures")));
+    GlobalOptions::embeddedData(use_embedded);
+    GlobalOptions::dataDirectory(data_dir);
+}
+
 /**
  * Tests the XML classes
  */
@@ -242,3 +619,80 @@ TEST_CASE
 
 }
 
+
+#ifndef _WIN32
+/**
+ * Returns the paths of all the XML files shipped in the data directory.
+ */
+std::vector<std::string> dataFiles()
+{
+    const std::string dirs [] = {
+        "mechanisms", "mixtures", "thermo", "transfer", "transport"
+    };
+
+    std::vector<std::string> files;
+    for (int i = 0; i < 5; ++i) {
+        const std::string dir = GlobalOptions::dataDirectory() + "/" + dirs[i];
+        DIR* p_dir = opendir(dir.c_str());
+        if (p_dir == NULL) continue;
+
+        struct dirent* p_entry;
+        while ((p_entry = readdir(p_dir)) != NULL) {
+            const std::string name = p_entry->d_name;
+            if (name.size() > 4 && name.substr(name.size()-4) == ".xml")
+                files.push_back(dir + "/" + name);
+        }
+        closedir(p_dir);
+    }
+
+    std::sort(files.begin(), files.end());
+    return files;
+}
+
+/**
+ * Makes sure every shipped data file can be parsed.
+ */
+TEST_CASE
+(
+    "XML parser loads all shipped data files",
+    "[utilities]"
+)
+{
+    const std::vector<std::string> files = dataFiles();
+    REQUIRE(files.size() > 0);
+
+    for (int i = 0; i < files.size(); ++i) {
+        INFO(files[i]);
+        XmlDocument doc(files[i]);
+        CHECK(!doc.root().tag().empty());
+    }
+}
+
+/**
+ * Reports the time needed to load each of the shipped data files.  Run with
+ * run_tests "[benchmark]".
+ */
+TEST_CASE
+(
+    "XML load time of shipped data files",
+    "[.][benchmark]"
+)
+{
+    const std::vector<std::string> files = dataFiles();
+    const int nloads = 20;
+
+    double total = 0.0;
+    for (int i = 0; i < files.size(); ++i) {
+        std::clock_t start = std::clock();
+        for (int k = 0; k < nloads; ++k)
+            XmlDocument doc(files[i]);
+        const double time =
+            double(std::clock() - start) / CLOCKS_PER_SEC / nloads * 1000.0;
+        total += time;
+
+        std::cout << std::setw(10) << std::fixed << std::setprecision(3)
+                  << time << " ms  " << files[i] << std::endl;
+    }
+    std::cout << std::setw(10) << total << " ms  total" << std::endl;
+}
+#endif
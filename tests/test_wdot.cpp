@@ -87,3 +87,163 @@ TEST_CASE
         )
     )
 }
+
+
+/**
+ * Compares the production rate Jacobians with respect to the species densities
+ * and temperatures to central finite differences, all derivatives being scaled
+ * by their variables.  The temperature derivatives are only checked when
+ * requested since tabulated thermodynamic properties are not differentiable.
+ */
+void checkProductionRateJacobians(Mixture& mix, bool check_temperature)
+{
+    const int ns = mix.nSpecies();
+    const int nt = mix.nEnergyEqns();
+
+    VectorXd rhoi(ns);
+    VectorXd tmps(nt);
+    VectorXd wp(ns);
+    VectorXd wm(ns);
+    VectorXd dT(ns);
+    VectorXd dTv(ns);
+    MatrixXd jac(ns, ns+1);
+    MatrixXd fd(ns, ns+1);
+
+    // Analytic Jacobians (row-major species Jacobian)
+    mix.densities(rhoi.data());
+    tmps.setConstant(mix.T());
+    Matrix<double, Dynamic, Dynamic, RowMajor> jrho(ns, ns);
+    mix.jacobianRho(jrho.data());
+    mix.jacobianTTv(dT.data(), dTv.data());
+    jac.leftCols(ns) = jrho*rhoi.asDiagonal();
+    jac.col(ns) = (dT + dTv)*mix.T();
+
+    // Finite differences in the log of the variables
+    for (int j = 0; j < ns+1; ++j) {
+        VectorXd xp(ns+1);
+        xp << rhoi, mix.T();
+        const double h = 1.0e-6*xp[j];
+        VectorXd x = xp;
+
+        xp[j] = x[j] + h;
+        mix.setState(xp.data(), VectorXd::Constant(nt, xp[ns]).eval().data(), 1);
+        mix.netProductionRates(wp.data());
+
+        xp[j] = x[j] - h;
+        mix.setState(xp.data(), VectorXd::Constant(nt, xp[ns]).eval().data(), 1);
+        mix.netProductionRates(wm.data());
+
+        fd.col(j) = (wp - wm) / 2.0e-6;
+    }
+    mix.setState(rhoi.data(), tmps.data(), 1);
+
+    for (int i = 0; i < ns; ++i) {
+        const double tol = 1.0e-5*fd.row(i).cwiseAbs().maxCoeff();
+        for (int j = 0; j < (check_temperature ? ns+1 : ns); ++j) {
+            INFO("T = " << mix.T() << ", P = " << mix.P()
+                 << ", row " << i << ", column " << j);
+            CHECK(jac(i,j) == Approx(fd(i,j)).epsilon(1.0e-5).margin(tol));
+        }
+    }
+}
+
+
+/**
+ * Compares the derivatives of the production rates of a two-temperature
+ * mixture with respect to Tv to central finite differences, after putting the
+ * current equilibrium composition out of thermal equilibrium.  Derivatives are
+ * scaled by Tv.
+ */
+void checkProductionRateTvJacobian(Mixture& mix)
+{
+    const int ns = mix.nSpecies();
+
+    VectorXd rhoi(ns);
+    VectorXd wp(ns);
+    VectorXd wm(ns);
+    VectorXd dT(ns);
+    VectorXd dTv(ns);
+    double tmps[2];
+
+    mix.densities(rhoi.data());
+    tmps[0] = mix.T();
+    tmps[1] = 0.7*mix.T();
+    mix.setState(rhoi.data(), tmps, 1);
+    mix.jacobianTTv(dT.data(), dTv.data());
+    const VectorXd jac = dTv*tmps[1];
+
+    const double Tv = tmps[1];
+    tmps[1] = Tv*(1.0 + 1.0e-6);
+    mix.setState(rhoi.data(), tmps, 1);
+    mix.netProductionRates(wp.data());
+
+    tmps[1] = Tv*(1.0 - 1.0e-6);
+    mix.setState(rhoi.data(), tmps, 1);
+    mix.netProductionRates(wm.data());
+
+    tmps[1] = Tv;
+    mix.setState(rhoi.data(), tmps, 1);
+    const VectorXd fd = (wp - wm) / 2.0e-6;
+
+    const double tol = 1.0e-5*fd.cwiseAbs().maxCoeff();
+    for (int i = 0; i < ns; ++i) {
+        INFO("T = " << tmps[0] << ", P = " << mix.P() << ", row " << i);
+        CHECK(jac[i] == Approx(fd[i]).epsilon(1.0e-3).margin(tol));
+    }
+}
+
+TEST_CASE
+(
+    "Species production rate Jacobians match finite differences",
+    "[kinetics]"
+)
+{
+    MIXTURE_LOOP
+    (
+        // Only single temperature models so that T derivatives are simple
+        if (mix.nEnergyEqns() != 1)
+            continue;
+
+        // RRHO electronic partition functions are tabulated
+        const bool check_temperature =
+            (_names_[i].find("NASA") != std::string::npos);
+
+        // Skip the temperature derivatives at the 6000 K NASA-9 range break
+        EQUILIBRATE_LOOP
+        (
+            checkProductionRateJacobians(
+                mix, check_temperature && mix.T() != 6000.0);
+        )
+    )
+}
+
+
+TEST_CASE
+(
+    "Species production rate Tv Jacobians match finite differences",
+    "[kinetics]"
+)
+{
+    // Two-temperature mixtures, with the thermodynamic tables so that the
+    // Gibbs energies are differentiable in Tv
+    const std::string names [] = {
+        "air5_RRHO_ChemNonEqTTv",
+        "air11_RRHO_ChemNonEqTTv",
+        "argon_CR_ChemNonEqTTv"
+    };
+
+    GlobalOptions::workingDirectory(TEST_DATA_FOLDER);
+
+    for (int m = 0; m < 3; ++m) {
+        SECTION(names[m]) {
+            MixtureOptions opts(names[m]);
+            opts.setThermodynamicTables(true);
+            Mixture mix(opts);
+
+            EQUILIBRATE_LOOP
+            (
+                checkProductionRateTvJacobian(mix);
+            )
+        }
+    }
+}